@@ -77,6 +77,12 @@ uint32_t libhashkit_murmur3(const char *key, size_t key_length);
 HASHKIT_API
 uint32_t libhashkit_jenkins(const char *key, size_t key_length);
 
+HASHKIT_API
+uint32_t libhashkit_xxh3(const char *key, size_t key_length);
+
+HASHKIT_API
+uint32_t libhashkit_crc32c(const char *key, size_t key_length);
+
 HASHKIT_API
 uint32_t libhashkit_md5(const char *key, size_t key_length);
 
@@ -57,6 +57,7 @@
 #include <libhashkit-1.0/digest.h>
 #include <libhashkit-1.0/function.h>
 #include <libhashkit-1.0/str_algorithm.h>
+#include <libhashkit-1.0/stream.h>
 #include <libhashkit-1.0/strerror.h>
 #include <libhashkit-1.0/string.h>
 
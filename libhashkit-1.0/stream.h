@@ -0,0 +1,83 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  HashKit library
+ *
+ *  Copyright (C) 2011-2012 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2009-2010 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  Incremental hashing.  Every built-in algorithm can be fed its input in
+  pieces and still produce the value hashkit_digest() gives for the whole
+  key.  Algorithms whose state depends on the total length (hsieh, murmur,
+  murmur3, jenkins, xxh3) keep the input in the buffer instead, so their
+  input is limited to HASHKIT_STREAM_BUFFER_SIZE bytes.
+*/
+#define HASHKIT_STREAM_BUFFER_SIZE 256
+
+struct hashkit_stream_st
+{
+  hashkit_hash_algorithm_t algorithm;
+  size_t length;
+  union {
+    uint32_t value32;
+    uint64_t value64;
+    uint64_t md5[12];
+  } state;
+  char buffer[HASHKIT_STREAM_BUFFER_SIZE];
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+HASHKIT_API
+hashkit_return_t hashkit_stream_init(hashkit_stream_st *self, hashkit_hash_algorithm_t hash_algorithm);
+
+HASHKIT_API
+hashkit_return_t hashkit_stream_update(hashkit_stream_st *self, const char *key, size_t key_length);
+
+HASHKIT_API
+uint32_t hashkit_stream_final(const hashkit_stream_st *self);
+
+/**
+  Hash key as if it had been appended to everything already fed to prefix,
+  leaving prefix untouched so that it can be reused for the next key.
+*/
+HASHKIT_API
+uint32_t hashkit_stream_digest(const hashkit_stream_st *prefix, const char *key, size_t key_length);
+
+#ifdef __cplusplus
+}
+#endif
@@ -70,6 +70,8 @@ typedef enum {
   HASHKIT_HASH_JENKINS,
   HASHKIT_HASH_MURMUR3,
   HASHKIT_HASH_CUSTOM,
+  HASHKIT_HASH_XXH3,
+  HASHKIT_HASH_CRC32C,
   HASHKIT_HASH_MAX
 } hashkit_hash_algorithm_t;
 
@@ -90,6 +92,7 @@ extern "C" {
 
 typedef struct hashkit_st hashkit_st;
 typedef struct hashkit_string_st hashkit_string_st;
+typedef struct hashkit_stream_st hashkit_stream_st;
 
 typedef uint32_t (*hashkit_hash_fn)(const char *key, size_t key_length, void *context);
 
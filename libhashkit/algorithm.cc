@@ -86,6 +86,16 @@ uint32_t libhashkit_jenkins(const char *key, size_t key_length)
   return hashkit_jenkins(key, key_length, NULL);
 }
 
+uint32_t libhashkit_xxh3(const char *key, size_t key_length)
+{
+  return hashkit_xxh3(key, key_length, NULL);
+}
+
+uint32_t libhashkit_crc32c(const char *key, size_t key_length)
+{
+  return hashkit_crc32c(key, key_length, NULL);
+}
+
 uint32_t libhashkit_md5(const char *key, size_t key_length)
 {
   return hashkit_md5(key, key_length, NULL);
@@ -63,4 +63,8 @@ uint32_t hashkit_murmur3(const char *key, size_t key_length, void *context);
 
 uint32_t hashkit_jenkins(const char *key, size_t key_length, void *context);
 
+uint32_t hashkit_xxh3(const char *key, size_t key_length, void *context);
+
+uint32_t hashkit_crc32c(const char *key, size_t key_length, void *context);
+
 uint32_t hashkit_md5(const char *key, size_t key_length, void *context);
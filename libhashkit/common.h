@@ -63,6 +63,14 @@ extern "C" {
 
 void md5_signature(const unsigned char *key, unsigned int length, unsigned char *result);
 
+/* The context is the md5 member of hashkit_stream_st::state */
+void md5_stream_init(void *context);
+void md5_stream_update(void *context, const unsigned char *key, unsigned int length);
+uint32_t md5_stream_final(const void *context);
+
+uint32_t crc32_stream_update(uint32_t crc, const char *key, size_t key_length);
+uint32_t crc32c_stream_update(uint32_t crc, const char *key, size_t key_length);
+
 int update_continuum(hashkit_st *hashkit);
 
 #ifdef __cplusplus
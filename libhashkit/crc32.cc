@@ -109,6 +109,14 @@ static const uint32_t crc32tab[256] = {
   0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
 };
 
+uint32_t crc32_stream_update(uint32_t crc, const char *key, size_t key_length)
+{
+  for (size_t x= 0; x < key_length; x++)
+     crc= (crc >> 8) ^ crc32tab[(crc ^ (uint64_t)key[x]) & 0xff];
+
+  return crc;
+}
+
 uint32_t hashkit_crc32(const char *key, size_t key_length, void *context)
 {
   uint64_t x;
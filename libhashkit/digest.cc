@@ -77,6 +77,10 @@ uint32_t libhashkit_digest(const char *key, size_t key_length, hashkit_hash_algo
 #endif
   case HASHKIT_HASH_JENKINS:
     return libhashkit_jenkins(key, key_length);
+  case HASHKIT_HASH_XXH3:
+    return libhashkit_xxh3(key, key_length);
+  case HASHKIT_HASH_CRC32C:
+    return libhashkit_crc32c(key, key_length);
   case HASHKIT_HASH_CUSTOM:
   case HASHKIT_HASH_MAX:
   default:
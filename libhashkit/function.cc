@@ -73,6 +73,14 @@ static hashkit_return_t _set_function(struct hashkit_st::hashkit_function_st *se
   case HASHKIT_HASH_CUSTOM:
     return HASHKIT_INVALID_ARGUMENT;
 
+  case HASHKIT_HASH_XXH3:
+    self->function= hashkit_xxh3;
+    break;
+
+  case HASHKIT_HASH_CRC32C:
+    self->function= hashkit_crc32c;
+    break;
+
   case HASHKIT_HASH_DEFAULT:
     self->function= hashkit_one_at_a_time;
     break;
@@ -178,6 +186,14 @@ static hashkit_hash_algorithm_t get_function_type(const hashkit_hash_fn function
   {
     return HASHKIT_HASH_JENKINS;
   }
+  else if (function == hashkit_xxh3)
+  {
+    return HASHKIT_HASH_XXH3;
+  }
+  else if (function == hashkit_crc32c)
+  {
+    return HASHKIT_HASH_CRC32C;
+  }
 
   return HASHKIT_HASH_CUSTOM;
 }
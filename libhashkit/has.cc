@@ -72,6 +72,8 @@ bool libhashkit_has_algorithm(const hashkit_hash_algorithm_t algo)
   case HASHKIT_HASH_CRC:
   case HASHKIT_HASH_JENKINS:
   case HASHKIT_HASH_CUSTOM:
+  case HASHKIT_HASH_XXH3:
+  case HASHKIT_HASH_CRC32C:
     return true;
 
   case HASHKIT_HASH_MAX:
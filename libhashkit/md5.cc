@@ -398,6 +398,31 @@ static void Decode (
       (((UINT4)input[j+2]) << 16) | (((UINT4)input[j+3]) << 24);
 }
 
+void md5_stream_init(void *context)
+{
+  assert(sizeof(MD5_CTX) <= sizeof(((hashkit_stream_st *)0)->state.md5));
+  MD5Init((MD5_CTX *)context);
+}
+
+void md5_stream_update(void *context, const unsigned char *key, unsigned int length)
+{
+  MD5Update((MD5_CTX *)context, key, length);
+}
+
+uint32_t md5_stream_final(const void *context)
+{
+  MD5_CTX copy;
+  unsigned char results[16];
+
+  memcpy(&copy, context, sizeof(copy));
+  MD5Final(results, &copy);
+
+  return ((uint32_t) (results[3] & 0xFF) << 24)
+    | ((uint32_t) (results[2] & 0xFF) << 16)
+    | ((uint32_t) (results[1] & 0xFF) << 8)
+    | (results[0] & 0xFF);
+}
+
 uint32_t hashkit_md5(const char *key, size_t key_length, void *context)
 {
   unsigned char results[16];
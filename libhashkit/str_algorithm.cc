@@ -52,6 +52,8 @@ const char * libhashkit_string_hash(hashkit_hash_algorithm_t type)
   case HASHKIT_HASH_MURMUR3: return "MURMUR3";
   case HASHKIT_HASH_JENKINS: return "JENKINS";
   case HASHKIT_HASH_CUSTOM: return "CUSTOM";
+  case HASHKIT_HASH_XXH3: return "XXH3";
+  case HASHKIT_HASH_CRC32C: return "CRC32C";
   default:
   case HASHKIT_HASH_MAX: return "INVALID";
   }
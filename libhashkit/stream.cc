@@ -0,0 +1,305 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  HashKit library
+ *
+ *  Copyright (C) 2012 Data Differential, http://datadifferential.com/
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <libhashkit/common.h>
+
+#include <string.h>
+
+/* These mirror the one shot versions in fnv_32.cc and fnv_64.cc */
+static const uint32_t FNV_32_INIT= 2166136261UL;
+static const uint32_t FNV_32_PRIME= 16777619;
+static const uint64_t FNV_64_INIT= 0xcbf29ce484222325;
+static const uint64_t FNV_64_PRIME= 0x100000001b3;
+
+static inline bool stream_is_buffered(const hashkit_hash_algorithm_t algorithm)
+{
+  switch (algorithm)
+  {
+  case HASHKIT_HASH_HSIEH:
+  case HASHKIT_HASH_MURMUR:
+  case HASHKIT_HASH_MURMUR3:
+  case HASHKIT_HASH_JENKINS:
+  case HASHKIT_HASH_XXH3:
+    return true;
+
+  case HASHKIT_HASH_DEFAULT:
+  case HASHKIT_HASH_MD5:
+  case HASHKIT_HASH_CRC:
+  case HASHKIT_HASH_FNV1_64:
+  case HASHKIT_HASH_FNV1A_64:
+  case HASHKIT_HASH_FNV1_32:
+  case HASHKIT_HASH_FNV1A_32:
+  case HASHKIT_HASH_CRC32C:
+  case HASHKIT_HASH_CUSTOM:
+  case HASHKIT_HASH_MAX:
+    break;
+  }
+
+  return false;
+}
+
+static void stream_feed(hashkit_stream_st *self, const char *key, size_t key_length)
+{
+  switch (self->algorithm)
+  {
+  case HASHKIT_HASH_DEFAULT:
+    {
+      uint32_t value= self->state.value32;
+      for (size_t x= 0; x < key_length; x++)
+      {
+        value += (uint32_t)key[x];
+        value += (value << 10);
+        value ^= (value >> 6);
+      }
+      self->state.value32= value;
+    }
+    break;
+
+  case HASHKIT_HASH_MD5:
+    md5_stream_update(self->state.md5, (const unsigned char *)key, (unsigned int)key_length);
+    break;
+
+  case HASHKIT_HASH_CRC:
+    self->state.value32= crc32_stream_update(self->state.value32, key, key_length);
+    break;
+
+  case HASHKIT_HASH_FNV1_64:
+    for (size_t x= 0; x < key_length; x++)
+    {
+      self->state.value64 *= FNV_64_PRIME;
+      self->state.value64 ^= (uint64_t)key[x];
+    }
+    break;
+
+  case HASHKIT_HASH_FNV1A_64:
+    // hashkit_fnv1a_64() has always done its arithmetic in 32 bits
+    for (size_t x= 0; x < key_length; x++)
+    {
+      self->state.value32 ^= (uint32_t)key[x];
+      self->state.value32 *= (uint32_t)FNV_64_PRIME;
+    }
+    break;
+
+  case HASHKIT_HASH_FNV1_32:
+    for (size_t x= 0; x < key_length; x++)
+    {
+      self->state.value32 *= FNV_32_PRIME;
+      self->state.value32 ^= (uint32_t)key[x];
+    }
+    break;
+
+  case HASHKIT_HASH_FNV1A_32:
+    for (size_t x= 0; x < key_length; x++)
+    {
+      self->state.value32 ^= (uint32_t)key[x];
+      self->state.value32 *= FNV_32_PRIME;
+    }
+    break;
+
+  case HASHKIT_HASH_CRC32C:
+    self->state.value32= crc32c_stream_update(self->state.value32, key, key_length);
+    break;
+
+  case HASHKIT_HASH_HSIEH:
+  case HASHKIT_HASH_MURMUR:
+  case HASHKIT_HASH_MURMUR3:
+  case HASHKIT_HASH_JENKINS:
+  case HASHKIT_HASH_XXH3:
+    memcpy(self->buffer +self->length, key, key_length);
+    break;
+
+  case HASHKIT_HASH_CUSTOM:
+  case HASHKIT_HASH_MAX:
+    break;
+  }
+
+  self->length+= key_length;
+}
+
+static uint32_t stream_finish(const hashkit_stream_st *self)
+{
+  switch (self->algorithm)
+  {
+  case HASHKIT_HASH_DEFAULT:
+    {
+      uint32_t value= self->state.value32;
+      value += (value << 3);
+      value ^= (value >> 11);
+      value += (value << 15);
+
+      return value;
+    }
+
+  case HASHKIT_HASH_MD5:
+    return md5_stream_final(self->state.md5);
+
+  case HASHKIT_HASH_CRC:
+    return ((~self->state.value32) >> 16) & 0x7fff;
+
+  case HASHKIT_HASH_FNV1_64:
+    return (uint32_t)self->state.value64;
+
+  case HASHKIT_HASH_FNV1A_64:
+  case HASHKIT_HASH_FNV1_32:
+  case HASHKIT_HASH_FNV1A_32:
+    return self->state.value32;
+
+  case HASHKIT_HASH_CRC32C:
+    return ~self->state.value32;
+
+  case HASHKIT_HASH_HSIEH:
+  case HASHKIT_HASH_MURMUR:
+  case HASHKIT_HASH_MURMUR3:
+  case HASHKIT_HASH_JENKINS:
+  case HASHKIT_HASH_XXH3:
+    return libhashkit_digest(self->buffer, self->length, self->algorithm);
+
+  case HASHKIT_HASH_CUSTOM:
+  case HASHKIT_HASH_MAX:
+    break;
+  }
+
+  return 0;
+}
+
+hashkit_return_t hashkit_stream_init(hashkit_stream_st *self, hashkit_hash_algorithm_t hash_algorithm)
+{
+  if (self == NULL)
+  {
+    return HASHKIT_INVALID_ARGUMENT;
+  }
+
+  if (hash_algorithm == HASHKIT_HASH_CUSTOM or libhashkit_has_algorithm(hash_algorithm) == false)
+  {
+    return HASHKIT_INVALID_ARGUMENT;
+  }
+
+  self->algorithm= hash_algorithm;
+  self->length= 0;
+
+  switch (hash_algorithm)
+  {
+  case HASHKIT_HASH_MD5:
+    md5_stream_init(self->state.md5);
+    break;
+
+  case HASHKIT_HASH_CRC:
+  case HASHKIT_HASH_CRC32C:
+    self->state.value32= UINT32_MAX;
+    break;
+
+  case HASHKIT_HASH_FNV1_64:
+    self->state.value64= FNV_64_INIT;
+    break;
+
+  case HASHKIT_HASH_FNV1A_64:
+    self->state.value32= (uint32_t)FNV_64_INIT;
+    break;
+
+  case HASHKIT_HASH_FNV1_32:
+  case HASHKIT_HASH_FNV1A_32:
+    self->state.value32= FNV_32_INIT;
+    break;
+
+  case HASHKIT_HASH_DEFAULT:
+  case HASHKIT_HASH_HSIEH:
+  case HASHKIT_HASH_MURMUR:
+  case HASHKIT_HASH_MURMUR3:
+  case HASHKIT_HASH_JENKINS:
+  case HASHKIT_HASH_XXH3:
+  case HASHKIT_HASH_CUSTOM:
+  case HASHKIT_HASH_MAX:
+    self->state.value64= 0;
+    break;
+  }
+
+  return HASHKIT_SUCCESS;
+}
+
+hashkit_return_t hashkit_stream_update(hashkit_stream_st *self, const char *key, size_t key_length)
+{
+  if (self == NULL or (key == NULL and key_length))
+  {
+    return HASHKIT_INVALID_ARGUMENT;
+  }
+
+  if (stream_is_buffered(self->algorithm) and self->length +key_length > HASHKIT_STREAM_BUFFER_SIZE)
+  {
+    return HASHKIT_INVALID_ARGUMENT;
+  }
+
+  stream_feed(self, key, key_length);
+
+  return HASHKIT_SUCCESS;
+}
+
+uint32_t hashkit_stream_final(const hashkit_stream_st *self)
+{
+  if (self == NULL)
+  {
+    return 0;
+  }
+
+  return stream_finish(self);
+}
+
+uint32_t hashkit_stream_digest(const hashkit_stream_st *prefix, const char *key, size_t key_length)
+{
+  if (prefix == NULL)
+  {
+    return 0;
+  }
+
+  hashkit_stream_st self;
+  self.algorithm= prefix->algorithm;
+  self.length= prefix->length;
+  self.state= prefix->state;
+
+  if (stream_is_buffered(prefix->algorithm))
+  {
+    if (prefix->length +key_length > HASHKIT_STREAM_BUFFER_SIZE)
+    {
+      return 0;
+    }
+    memcpy(self.buffer, prefix->buffer, prefix->length);
+  }
+
+  stream_feed(&self, key, key_length);
+
+  return stream_finish(&self);
+}
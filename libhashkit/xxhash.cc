@@ -0,0 +1,327 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  HashKit library
+ *
+ *  Copyright (C) 2012 Data Differential, http://datadifferential.com/
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+  XXH3 64 bit, seed 0 and the default secret, as specified by xxHash 0.8
+  (https://github.com/Cyan4973/xxHash).  Scalar code only; keys are short
+  enough that the 16 byte mixing paths dominate.
+*/
+
+#include "libhashkit/common.h"
+
+#include <string.h>
+
+#define XXH_PRIME32_1 0x9E3779B1U
+#define XXH_PRIME32_2 0x85EBCA77U
+#define XXH_PRIME32_3 0xC2B2AE3DU
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+#define XXH_PRIME_MX1 0x165667919E3779F9ULL
+#define XXH_PRIME_MX2 0x9FB21C651E98DF25ULL
+
+#define XXH_STRIPE_LEN 64
+#define XXH_SECRET_CONSUME_RATE 8
+#define XXH_ACC_NB 8
+#define XXH_MIDSIZE_MAX 240
+#define XXH_SECRET_SIZE_MIN 136
+
+static const uint8_t xxh3_secret[192]= {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static inline uint32_t read32(const uint8_t *p)
+{
+#ifdef WORDS_BIGENDIAN
+  return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+#else
+  uint32_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+#endif
+}
+
+static inline uint64_t read64(const uint8_t *p)
+{
+#ifdef WORDS_BIGENDIAN
+  return uint64_t(read32(p)) | (uint64_t(read32(p + 4)) << 32);
+#else
+  uint64_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+#endif
+}
+
+static inline uint64_t rotl64(uint64_t value, int bits)
+{
+  return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t swap64(uint64_t value)
+{
+  return ((value << 56) & 0xff00000000000000ULL) |
+    ((value << 40) & 0x00ff000000000000ULL) |
+    ((value << 24) & 0x0000ff0000000000ULL) |
+    ((value << 8) & 0x000000ff00000000ULL) |
+    ((value >> 8) & 0x00000000ff000000ULL) |
+    ((value >> 24) & 0x0000000000ff0000ULL) |
+    ((value >> 40) & 0x000000000000ff00ULL) |
+    ((value >> 56) & 0x00000000000000ffULL);
+}
+
+/* Both halves of the 128 bit product, xored together */
+static inline uint64_t mul128_fold64(uint64_t lhs, uint64_t rhs)
+{
+#ifdef __SIZEOF_INT128__
+  __uint128_t product= __uint128_t(lhs) * rhs;
+  return uint64_t(product) ^ uint64_t(product >> 64);
+#else
+  uint64_t lo_lo= (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+  uint64_t hi_lo= (lhs >> 32) * (rhs & 0xFFFFFFFF);
+  uint64_t lo_hi= (lhs & 0xFFFFFFFF) * (rhs >> 32);
+  uint64_t hi_hi= (lhs >> 32) * (rhs >> 32);
+  uint64_t cross= (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+  uint64_t upper= (hi_lo >> 32) + (cross >> 32) + hi_hi;
+  uint64_t lower= (cross << 32) | (lo_lo & 0xFFFFFFFF);
+  return lower ^ upper;
+#endif
+}
+
+static inline uint64_t xxh64_avalanche(uint64_t hash)
+{
+  hash^= hash >> 33;
+  hash*= XXH_PRIME64_2;
+  hash^= hash >> 29;
+  hash*= XXH_PRIME64_3;
+  hash^= hash >> 32;
+  return hash;
+}
+
+static inline uint64_t xxh3_avalanche(uint64_t hash)
+{
+  hash^= hash >> 37;
+  hash*= XXH_PRIME_MX1;
+  hash^= hash >> 32;
+  return hash;
+}
+
+static inline uint64_t xxh3_rrmxmx(uint64_t hash, uint64_t length)
+{
+  hash^= rotl64(hash, 49) ^ rotl64(hash, 24);
+  hash*= XXH_PRIME_MX2;
+  hash^= (hash >> 35) + length;
+  hash*= XXH_PRIME_MX2;
+  return hash ^ (hash >> 28);
+}
+
+static inline uint64_t xxh3_mix16(const uint8_t *input, const uint8_t *secret)
+{
+  return mul128_fold64(read64(input) ^ read64(secret), read64(input + 8) ^ read64(secret + 8));
+}
+
+static inline uint64_t xxh3_0to16(const uint8_t *input, size_t length)
+{
+  if (length > 8)
+  {
+    uint64_t low= read64(input) ^ (read64(xxh3_secret + 24) ^ read64(xxh3_secret + 32));
+    uint64_t high= read64(input + length - 8) ^ (read64(xxh3_secret + 40) ^ read64(xxh3_secret + 48));
+    return xxh3_avalanche(length + swap64(low) + high + mul128_fold64(low, high));
+  }
+
+  if (length >= 4)
+  {
+    uint64_t combined= read32(input + length - 4) + (uint64_t(read32(input)) << 32);
+    uint64_t keyed= combined ^ (read64(xxh3_secret + 8) ^ read64(xxh3_secret + 16));
+    return xxh3_rrmxmx(keyed, length);
+  }
+
+  if (length)
+  {
+    uint32_t combined= (uint32_t(input[0]) << 16) | (uint32_t(input[length >> 1]) << 24) |
+      uint32_t(input[length - 1]) | (uint32_t(length) << 8);
+    uint64_t keyed= uint64_t(combined) ^ uint64_t(read32(xxh3_secret) ^ read32(xxh3_secret + 4));
+    return xxh64_avalanche(keyed);
+  }
+
+  return xxh64_avalanche(read64(xxh3_secret + 56) ^ read64(xxh3_secret + 64));
+}
+
+static inline uint64_t xxh3_17to128(const uint8_t *input, size_t length)
+{
+  uint64_t acc= length * XXH_PRIME64_1;
+
+  if (length > 32)
+  {
+    if (length > 64)
+    {
+      if (length > 96)
+      {
+        acc+= xxh3_mix16(input + 48, xxh3_secret + 96);
+        acc+= xxh3_mix16(input + length - 64, xxh3_secret + 112);
+      }
+      acc+= xxh3_mix16(input + 32, xxh3_secret + 64);
+      acc+= xxh3_mix16(input + length - 48, xxh3_secret + 80);
+    }
+    acc+= xxh3_mix16(input + 16, xxh3_secret + 32);
+    acc+= xxh3_mix16(input + length - 32, xxh3_secret + 48);
+  }
+  acc+= xxh3_mix16(input, xxh3_secret);
+  acc+= xxh3_mix16(input + length - 16, xxh3_secret + 16);
+
+  return xxh3_avalanche(acc);
+}
+
+static uint64_t xxh3_129to240(const uint8_t *input, size_t length)
+{
+  uint64_t acc= length * XXH_PRIME64_1;
+  size_t rounds= length / 16;
+
+  for (size_t x= 0; x < 8; x++)
+  {
+    acc+= xxh3_mix16(input + 16 * x, xxh3_secret + 16 * x);
+  }
+  acc= xxh3_avalanche(acc);
+
+  for (size_t x= 8; x < rounds; x++)
+  {
+    acc+= xxh3_mix16(input + 16 * x, xxh3_secret + 16 * (x - 8) + 3);
+  }
+  acc+= xxh3_mix16(input + length - 16, xxh3_secret + XXH_SECRET_SIZE_MIN - 17);
+
+  return xxh3_avalanche(acc);
+}
+
+static inline void xxh3_accumulate_512(uint64_t *acc, const uint8_t *input, const uint8_t *secret)
+{
+  for (size_t lane= 0; lane < XXH_ACC_NB; lane++)
+  {
+    uint64_t value= read64(input + lane * 8);
+    uint64_t keyed= value ^ read64(secret + lane * 8);
+    acc[lane ^ 1]+= value;
+    acc[lane]+= (keyed & 0xFFFFFFFF) * (keyed >> 32);
+  }
+}
+
+static inline void xxh3_scramble(uint64_t *acc, const uint8_t *secret)
+{
+  for (size_t lane= 0; lane < XXH_ACC_NB; lane++)
+  {
+    uint64_t value= acc[lane];
+    value^= value >> 47;
+    value^= read64(secret + lane * 8);
+    acc[lane]= value * XXH_PRIME32_1;
+  }
+}
+
+static uint64_t xxh3_long(const uint8_t *input, size_t length)
+{
+  uint64_t acc[XXH_ACC_NB]= { XXH_PRIME32_3, XXH_PRIME64_1, XXH_PRIME64_2, XXH_PRIME64_3,
+                              XXH_PRIME64_4, XXH_PRIME32_2, XXH_PRIME64_5, XXH_PRIME32_1 };
+  const size_t stripes_per_block= (sizeof(xxh3_secret) - XXH_STRIPE_LEN) / XXH_SECRET_CONSUME_RATE;
+  const size_t block_length= XXH_STRIPE_LEN * stripes_per_block;
+  const size_t blocks= (length - 1) / block_length;
+
+  for (size_t block= 0; block < blocks; block++)
+  {
+    for (size_t stripe= 0; stripe < stripes_per_block; stripe++)
+    {
+      xxh3_accumulate_512(acc, input + block * block_length + stripe * XXH_STRIPE_LEN,
+                          xxh3_secret + stripe * XXH_SECRET_CONSUME_RATE);
+    }
+    xxh3_scramble(acc, xxh3_secret + sizeof(xxh3_secret) - XXH_STRIPE_LEN);
+  }
+
+  const size_t stripes= ((length - 1) - block_length * blocks) / XXH_STRIPE_LEN;
+  for (size_t stripe= 0; stripe < stripes; stripe++)
+  {
+    xxh3_accumulate_512(acc, input + blocks * block_length + stripe * XXH_STRIPE_LEN,
+                        xxh3_secret + stripe * XXH_SECRET_CONSUME_RATE);
+  }
+  xxh3_accumulate_512(acc, input + length - XXH_STRIPE_LEN,
+                      xxh3_secret + sizeof(xxh3_secret) - XXH_STRIPE_LEN - 7);
+
+  uint64_t result= length * XXH_PRIME64_1;
+  for (size_t x= 0; x < 4; x++)
+  {
+    result+= mul128_fold64(acc[2 * x] ^ read64(xxh3_secret + 11 + 16 * x),
+                           acc[2 * x + 1] ^ read64(xxh3_secret + 11 + 16 * x + 8));
+  }
+
+  return xxh3_avalanche(result);
+}
+
+static uint64_t xxh3_64(const char *key, size_t key_length)
+{
+  const uint8_t *input= (const uint8_t *)key;
+
+  if (key_length <= 16)
+  {
+    return xxh3_0to16(input, key_length);
+  }
+
+  if (key_length <= 128)
+  {
+    return xxh3_17to128(input, key_length);
+  }
+
+  if (key_length <= XXH_MIDSIZE_MAX)
+  {
+    return xxh3_129to240(input, key_length);
+  }
+
+  return xxh3_long(input, key_length);
+}
+
+uint32_t hashkit_xxh3(const char *key, size_t key_length, void *)
+{
+  uint64_t hash= xxh3_64(key, key_length);
+
+  return uint32_t(hash ^ (hash >> 32));
+}
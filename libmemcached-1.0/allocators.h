@@ -59,6 +59,9 @@ void memcached_get_memory_allocators(const memcached_st *ptr,
 LIBMEMCACHED_API
 void *memcached_get_memory_allocators_context(const memcached_st *ptr);
 
+LIBMEMCACHED_API
+memcached_return_t memcached_slab_stat(const memcached_st *ptr, memcached_slab_stat_st *stat);
+
 #ifdef __cplusplus
 }
 #endif
@@ -106,6 +106,54 @@ LIBMEMCACHED_API
                                                              time_t expiration,
                                                              uint64_t *value);
 
+LIBMEMCACHED_API
+  memcached_return_t memcached_increment_multi_with_initial(memcached_st *ptr,
+                                                        const char * const *keys,
+                                                        const size_t *key_length,
+                                                        const uint64_t *offset,
+                                                        const uint64_t *initial,
+                                                        const time_t *expiration,
+                                                        size_t number_of_keys,
+                                                        uint64_t *values,
+                                                        memcached_return_t *results);
+
+LIBMEMCACHED_API
+  memcached_return_t memcached_increment_multi_with_initial_by_key(memcached_st *ptr,
+                                                               const char *group_key,
+                                                               size_t group_key_length,
+                                                               const char * const *keys,
+                                                               const size_t *key_length,
+                                                               const uint64_t *offset,
+                                                               const uint64_t *initial,
+                                                               const time_t *expiration,
+                                                               size_t number_of_keys,
+                                                               uint64_t *values,
+                                                               memcached_return_t *results);
+
+LIBMEMCACHED_API
+  memcached_return_t memcached_decrement_multi_with_initial(memcached_st *ptr,
+                                                        const char * const *keys,
+                                                        const size_t *key_length,
+                                                        const uint64_t *offset,
+                                                        const uint64_t *initial,
+                                                        const time_t *expiration,
+                                                        size_t number_of_keys,
+                                                        uint64_t *values,
+                                                        memcached_return_t *results);
+
+LIBMEMCACHED_API
+  memcached_return_t memcached_decrement_multi_with_initial_by_key(memcached_st *ptr,
+                                                               const char *group_key,
+                                                               size_t group_key_length,
+                                                               const char * const *keys,
+                                                               const size_t *key_length,
+                                                               const uint64_t *offset,
+                                                               const uint64_t *initial,
+                                                               const time_t *expiration,
+                                                               size_t number_of_keys,
+                                                               uint64_t *values,
+                                                               memcached_return_t *results);
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,6 +47,21 @@ LIBMEMCACHED_API
 memcached_return_t memcached_exist_by_key(memcached_st *memc,
                                           const char *group_key, size_t group_key_length,
                                           const char *key, size_t key_length);
+
+LIBMEMCACHED_API
+memcached_return_t memcached_exist_multi(memcached_st *memc,
+                                         const char * const *keys,
+                                         const size_t *key_length,
+                                         size_t number_of_keys,
+                                         memcached_return_t *results);
+
+LIBMEMCACHED_API
+memcached_return_t memcached_exist_multi_by_key(memcached_st *memc,
+                                                const char *group_key, size_t group_key_length,
+                                                const char * const *keys,
+                                                const size_t *key_length,
+                                                size_t number_of_keys,
+                                                memcached_return_t *results);
 #ifdef __cplusplus
 }
 #endif
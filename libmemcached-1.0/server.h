@@ -106,6 +106,9 @@ in_port_t memcached_server_port(const memcached_instance_st * self);
 LIBMEMCACHED_API
 in_port_t memcached_server_srcport(const memcached_instance_st * self);
 
+LIBMEMCACHED_API
+memcached_socket_t memcached_server_fd(const memcached_instance_st * self);
+
 LIBMEMCACHED_API
 void memcached_instance_next_retry(const memcached_instance_st * self, const time_t absolute_time);
 
@@ -44,3 +44,19 @@ struct memcached_allocator_t {
   memcached_realloc_fn realloc;
   void *context;
 };
+
+/*
+  Counters of the slab behind MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR, see
+  memcached_slab_stat().
+*/
+struct memcached_slab_stat_st {
+  uint64_t allocations; // Blocks handed out from the size classes
+  uint64_t frees; // Blocks given back to them
+  uint64_t large_allocations; // Requests too big for a size class
+  uint64_t pages; // Pages taken from the allocators
+  size_t reserved; // Bytes in those pages
+  size_t in_use; // Bytes of the blocks handed out
+  size_t requested; // Bytes asked for in those blocks
+  size_t high_water; // Most bytes ever in use at once
+  double fragmentation; // Share of reserved bytes not holding requested data
+};
@@ -65,6 +65,7 @@ struct memcached_st {
     bool tcp_keepalive:1;
     bool is_aes:1;
     bool is_fetching_version:1;
+    bool replica_read_least_loaded:1;
     bool not_used:1;
   } flags;
 
@@ -76,6 +77,8 @@ struct memcached_st {
   uint32_t number_of_hosts;
   memcached_instance_st *servers;
   memcached_instance_st *last_disconnected_server;
+  memcached_instance_st *pending_instances; // Servers with outstanding responses, see libmemcached/instance.hpp
+  memcached_instance_st *dirty_instances; // Servers with buffered writes
   int32_t snd_timeout;
   int32_t rcv_timeout;
   uint32_t server_failure_limit;
@@ -93,19 +96,37 @@ struct memcached_st {
   void *user_data;
   uint64_t query_id;
   uint32_t number_of_replicas;
+  uint32_t hedge_read_percentile;
+  struct memcached_hedge_st *hedge;
+  struct memcached_batch_st *batch;
   memcached_result_st result;
 
   struct {
     bool weighted_;
+    bool ring_64bit_;
     uint32_t continuum_count; // Ketama
     uint32_t continuum_points_counter; // Ketama
     time_t next_distribution_rebuild; // Ketama
     struct memcached_continuum_item_st *continuum; // Ketama
+    struct memcached_continuum_lookup_st *lookup; // Ketama
+    struct memcached_continuum_cache_st *cache; // Ketama
   } ketama;
 
   struct memcached_virtual_bucket_t *virtual_bucket;
+  struct memcached_rendezvous_st *rendezvous;
+  struct memcached_maglev_st *maglev;
+  uint32_t (*route)(const struct memcached_st *, const char *, size_t); // See memcached_route_install()
+  struct hashkit_stream_st *namespace_hash;
+  struct memcached_snapshot_st *snapshot; // Shared tables being routed with, see libmemcached/snapshot.hpp
+  struct memcached_snapshot_slot_st *snapshot_slot;
+
+  struct {
+    uint32_t epsilon;
+    uint32_t total;
+  } bounded_load;
 
   struct memcached_allocator_t allocators;
+  struct memcached_slab_st *slab; // MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR
 
   memcached_clone_fn on_clone;
   memcached_cleanup_fn on_cleanup;
@@ -114,6 +135,7 @@ struct memcached_st {
   memcached_callback_st *callbacks;
   struct memcached_sasl_st sasl;
   struct memcached_error_t *error_messages;
+  struct memcached_error_ring_st *error_ring;
   struct memcached_array_st *_namespace;
   struct {
     uint32_t initial_pool_size;
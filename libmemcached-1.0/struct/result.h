@@ -50,7 +50,9 @@ struct memcached_result_st {
   struct {
     bool is_allocated:1;
     bool is_initialized:1;
+    bool is_slab:1;
   } options;
+  char item_value[MEMCACHED_RESULT_INLINE_SIZE];
   /* Add result callback function */
 };
 
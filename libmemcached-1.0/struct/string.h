@@ -55,5 +55,7 @@ struct memcached_string_st {
   struct {
     bool is_allocated:1;
     bool is_initialized:1;
+    bool is_slab:1; // string came from the root's slab
+    bool is_inline:1; // string belongs to the object holding this one
   } options;
 };
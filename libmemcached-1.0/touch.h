@@ -54,6 +54,23 @@ memcached_return_t memcached_touch_by_key(memcached_st *ptr,
                                           const char *key, size_t key_length,
                                           time_t expiration);
 
+LIBMEMCACHED_API
+memcached_return_t memcached_touch_multi(memcached_st *ptr,
+                                         const char * const *keys,
+                                         const size_t *key_length,
+                                         size_t number_of_keys,
+                                         time_t expiration,
+                                         memcached_return_t *results);
+
+LIBMEMCACHED_API
+memcached_return_t memcached_touch_multi_by_key(memcached_st *ptr,
+                                                const char *group_key, size_t group_key_length,
+                                                const char * const *keys,
+                                                const size_t *key_length,
+                                                size_t number_of_keys,
+                                                time_t expiration,
+                                                memcached_return_t *results);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ struct memcached_analysis_st;
 struct memcached_result_st;
 struct memcached_array_st;
 struct memcached_error_t;
+struct memcached_slab_stat_st;
 
 // All of the flavors of memcache_server_st
 struct memcached_server_st;
@@ -68,6 +69,7 @@ typedef struct memcached_analysis_st memcached_analysis_st;
 typedef struct memcached_result_st memcached_result_st;
 typedef struct memcached_array_st memcached_array_st;
 typedef struct memcached_error_t memcached_error_t;
+typedef struct memcached_slab_stat_st memcached_slab_stat_st;
 
 // All of the flavors of memcache_server_st
 typedef struct memcached_server_st memcached_server_st;
@@ -77,6 +77,11 @@ enum memcached_behavior_t {
   MEMCACHED_BEHAVIOR_REMOVE_FAILED_SERVERS,
   MEMCACHED_BEHAVIOR_DEAD_TIMEOUT,
   MEMCACHED_BEHAVIOR_SERVER_TIMEOUT_LIMIT,
+  MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE,
+  MEMCACHED_BEHAVIOR_REPLICA_READ_LEAST_LOADED,
+  MEMCACHED_BEHAVIOR_KETAMA_64BIT,
+  MEMCACHED_BEHAVIOR_BOUNDED_LOAD,
+  MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR,
   MEMCACHED_BEHAVIOR_MAX
 };
 
@@ -51,6 +51,8 @@ enum memcached_hash_t {
   MEMCACHED_HASH_JENKINS,
   MEMCACHED_HASH_MURMUR3,
   MEMCACHED_HASH_CUSTOM,
+  MEMCACHED_HASH_XXH3,
+  MEMCACHED_HASH_CRC32C,
   MEMCACHED_HASH_MAX
 };
 
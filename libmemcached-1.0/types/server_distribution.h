@@ -46,6 +46,10 @@ enum memcached_server_distribution_t {
   MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY,
   MEMCACHED_DISTRIBUTION_CONSISTENT_WEIGHTED,
   MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET,
+  MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP,
+  MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS,
+  MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON,
+  MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV,
   MEMCACHED_DISTRIBUTION_CONSISTENT_MAX
 };
 
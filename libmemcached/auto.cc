@@ -383,3 +383,195 @@ memcached_return_t memcached_decrement_with_initial_by_key(memcached_st *shell,
 
   return rc;
 }
+
+struct memcached_auto_batch_st {
+  protocol_binary_command command;
+  const uint64_t *offset;
+  const uint64_t *initial;
+  const time_t *expiration;
+};
+
+static memcached_return_t batch_incr_decr_send(memcached_batch_st& batch,
+                                               memcached_instance_st* instance,
+                                               const size_t index)
+{
+  const memcached_auto_batch_st *arithmetic= static_cast<const memcached_auto_batch_st *>(batch.context);
+  const char *key= batch.keys[index];
+  const size_t key_length= batch.key_length[index];
+
+  protocol_binary_request_incr request= {};
+
+  initialize_binary_request(instance, request.message.header);
+
+  request.message.header.request.opcode= arithmetic->command;
+  request.message.header.request.opaque= htonl(uint32_t(index));
+  request.message.header.request.keylen= htons((uint16_t)(key_length + memcached_array_size(instance->root->_namespace)));
+  request.message.header.request.extlen= 20;
+  request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+  request.message.header.request.bodylen= htonl((uint32_t)(key_length + memcached_array_size(instance->root->_namespace) +request.message.header.request.extlen));
+  request.message.body.delta= memcached_htonll(arithmetic->offset[index]);
+  request.message.body.initial= memcached_htonll(arithmetic->initial ? arithmetic->initial[index] : 0);
+  request.message.body.expiration= htonl((uint32_t)(arithmetic->expiration ? arithmetic->expiration[index] : 0));
+
+  libmemcached_io_vector_st vector[]=
+  {
+    { NULL, 0 },
+    { request.bytes, sizeof(request.bytes) },
+    { memcached_array_string(instance->root->_namespace), memcached_array_size(instance->root->_namespace) },
+    { key, key_length }
+  };
+
+  return memcached_batch_write(batch, index, vector, 4, batch.values != NULL);
+}
+
+static memcached_return_t increment_decrement_multi_with_initial_by_key(protocol_binary_command command,
+                                                                        Memcached *memc,
+                                                                        const char *group_key,
+                                                                        size_t group_key_length,
+                                                                        const char * const *keys,
+                                                                        const size_t *key_length,
+                                                                        const uint64_t *offset,
+                                                                        const uint64_t *initial,
+                                                                        const time_t *expiration,
+                                                                        size_t number_of_keys,
+                                                                        uint64_t *values,
+                                                                        memcached_return_t *results)
+{
+  memcached_batch_st batch;
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_batch_init(batch, memc, group_key, group_key_length,
+                                                keys, key_length, number_of_keys, results)))
+  {
+    return rc;
+  }
+
+  if (memcached_is_encrypted(memc))
+  {
+    rc= memcached_set_error(*memc, MEMCACHED_NOT_SUPPORTED, MEMCACHED_AT, 
+                            memcached_literal_param("Operation not allowed while encyrption is enabled"));
+  }
+  else if (memcached_is_binary(memc) == false)
+  {
+    rc= memcached_set_error(*memc, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
+                            memcached_literal_param("memcached_increment_multi_with_initial() is not supported via the ASCII protocol"));
+  }
+  else if (offset == NULL)
+  {
+    rc= memcached_set_error(*memc, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
+                            memcached_literal_param("offset must not be NULL"));
+  }
+
+  if (memcached_failed(rc))
+  {
+    memcached_batch_free(batch);
+    return rc;
+  }
+
+  /*
+    The quiet opcodes only answer on failure, which also drops the new
+    value of the counter, so they are only used when nobody asked for it.
+  */
+  for (size_t x= 0; values and x < number_of_keys; ++x)
+  {
+    values[x]= UINT64_MAX;
+  }
+
+  if (values and memcached_is_replying(memc))
+  {
+    batch.values= values;
+  }
+  else
+  {
+    command= command == PROTOCOL_BINARY_CMD_INCREMENT ? PROTOCOL_BINARY_CMD_INCREMENTQ : PROTOCOL_BINARY_CMD_DECREMENTQ;
+  }
+
+  memcached_auto_batch_st arithmetic= { command, offset, initial, expiration };
+  batch.context= &arithmetic;
+
+  rc= memcached_batch_execute(batch, batch_incr_decr_send, NULL);
+  memcached_batch_free(batch);
+
+  return rc;
+}
+
+memcached_return_t memcached_increment_multi_with_initial(memcached_st *memc,
+                                                          const char * const *keys,
+                                                          const size_t *key_length,
+                                                          const uint64_t *offset,
+                                                          const uint64_t *initial,
+                                                          const time_t *expiration,
+                                                          size_t number_of_keys,
+                                                          uint64_t *values,
+                                                          memcached_return_t *results)
+{
+  return memcached_increment_multi_with_initial_by_key(memc, NULL, 0,
+                                                       keys, key_length,
+                                                       offset, initial, expiration,
+                                                       number_of_keys, values, results);
+}
+
+memcached_return_t memcached_increment_multi_with_initial_by_key(memcached_st *shell,
+                                                                 const char *group_key,
+                                                                 size_t group_key_length,
+                                                                 const char * const *keys,
+                                                                 const size_t *key_length,
+                                                                 const uint64_t *offset,
+                                                                 const uint64_t *initial,
+                                                                 const time_t *expiration,
+                                                                 size_t number_of_keys,
+                                                                 uint64_t *values,
+                                                                 memcached_return_t *results)
+{
+  LIBMEMCACHED_MEMCACHED_INCREMENT_WITH_INITIAL_START();
+  Memcached* memc= memcached2Memcached(shell);
+  memcached_return_t rc= increment_decrement_multi_with_initial_by_key(PROTOCOL_BINARY_CMD_INCREMENT,
+                                                                       memc,
+                                                                       group_key, group_key_length,
+                                                                       keys, key_length,
+                                                                       offset, initial, expiration,
+                                                                       number_of_keys, values, results);
+  LIBMEMCACHED_MEMCACHED_INCREMENT_WITH_INITIAL_END();
+
+  return rc;
+}
+
+memcached_return_t memcached_decrement_multi_with_initial(memcached_st *memc,
+                                                          const char * const *keys,
+                                                          const size_t *key_length,
+                                                          const uint64_t *offset,
+                                                          const uint64_t *initial,
+                                                          const time_t *expiration,
+                                                          size_t number_of_keys,
+                                                          uint64_t *values,
+                                                          memcached_return_t *results)
+{
+  return memcached_decrement_multi_with_initial_by_key(memc, NULL, 0,
+                                                       keys, key_length,
+                                                       offset, initial, expiration,
+                                                       number_of_keys, values, results);
+}
+
+memcached_return_t memcached_decrement_multi_with_initial_by_key(memcached_st *shell,
+                                                                 const char *group_key,
+                                                                 size_t group_key_length,
+                                                                 const char * const *keys,
+                                                                 const size_t *key_length,
+                                                                 const uint64_t *offset,
+                                                                 const uint64_t *initial,
+                                                                 const time_t *expiration,
+                                                                 size_t number_of_keys,
+                                                                 uint64_t *values,
+                                                                 memcached_return_t *results)
+{
+  LIBMEMCACHED_MEMCACHED_INCREMENT_WITH_INITIAL_START();
+  Memcached* memc= memcached2Memcached(shell);
+  memcached_return_t rc= increment_decrement_multi_with_initial_by_key(PROTOCOL_BINARY_CMD_DECREMENT,
+                                                                       memc,
+                                                                       group_key, group_key_length,
+                                                                       keys, key_length,
+                                                                       offset, initial, expiration,
+                                                                       number_of_keys, values, results);
+  LIBMEMCACHED_MEMCACHED_INCREMENT_WITH_INITIAL_END();
+
+  return rc;
+}
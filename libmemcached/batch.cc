@@ -0,0 +1,590 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+static bool opcode_is_quiet(const uint8_t opcode)
+{
+  switch (opcode)
+  {
+  case PROTOCOL_BINARY_CMD_GETQ:
+  case PROTOCOL_BINARY_CMD_GETKQ:
+  case PROTOCOL_BINARY_CMD_SETQ:
+  case PROTOCOL_BINARY_CMD_ADDQ:
+  case PROTOCOL_BINARY_CMD_REPLACEQ:
+  case PROTOCOL_BINARY_CMD_DELETEQ:
+  case PROTOCOL_BINARY_CMD_INCREMENTQ:
+  case PROTOCOL_BINARY_CMD_DECREMENTQ:
+  case PROTOCOL_BINARY_CMD_APPENDQ:
+  case PROTOCOL_BINARY_CMD_PREPENDQ:
+  case PROTOCOL_BINARY_CMD_GATQ:
+  case PROTOCOL_BINARY_CMD_GATKQ:
+    return true;
+
+  default:
+    break;
+  }
+
+  return false;
+}
+
+static void batch_fail(memcached_batch_st& batch, const uint32_t server_key,
+                       memcached_instance_st* instance, const memcached_return_t rc)
+{
+  batch.servers[server_key].rc= rc;
+  memcached_io_reset(instance);
+}
+
+static memcached_return_t batch_activate(memcached_batch_st& batch, const uint32_t server_key,
+                                         memcached_instance_st*& instance)
+{
+  memcached_batch_server_st& server= batch.servers[server_key];
+  instance= memcached_instance_fetch(batch.root, server_key);
+
+  if (server.rc != MEMCACHED_SUCCESS or server.active)
+  {
+    return server.rc;
+  }
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_connect(instance)))
+  {
+    server.rc= rc;
+    return rc;
+  }
+
+  /* Anything still pending from an earlier buffered command is not ours */
+  if (memcached_server_response_count(instance))
+  {
+    char buffer[MEMCACHED_DEFAULT_COMMAND_SIZE];
+
+    if (batch.root->flags.no_block)
+    {
+      (void)memcached_io_write(instance);
+    }
+
+    while (memcached_server_response_count(instance))
+    {
+      (void)memcached_response(instance, buffer, sizeof(buffer), &batch.root->result);
+    }
+  }
+
+  server.active= true;
+
+  return MEMCACHED_SUCCESS;
+}
+
+static memcached_return_t batch_skip(memcached_instance_st* instance, uint32_t length)
+{
+  char hole[SMALL_STRING_LEN];
+  while (length > 0)
+  {
+    size_t nr= (length > SMALL_STRING_LEN) ? SMALL_STRING_LEN : length;
+
+    memcached_return_t rc;
+    if (memcached_failed(rc= memcached_safe_read(instance, hole, nr)))
+    {
+      return rc;
+    }
+    length-= uint32_t(nr);
+  }
+
+  return MEMCACHED_SUCCESS;
+}
+
+static memcached_return_t batch_binary_read(memcached_batch_st& batch, const uint32_t server_key,
+                                            memcached_instance_st* instance)
+{
+  protocol_binary_response_header header;
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_safe_read(instance, header.bytes, sizeof(header.bytes))))
+  {
+    return rc;
+  }
+
+  if (header.response.magic != PROTOCOL_BINARY_RES)
+  {
+    return memcached_set_error(*instance, MEMCACHED_UNKNOWN_READ_FAILURE, MEMCACHED_AT);
+  }
+
+  if (opcode_is_quiet(header.response.opcode) == false)
+  {
+    memcached_server_response_decrement(instance);
+  }
+
+  uint32_t bodylen= ntohl(header.response.bodylen);
+  uint32_t index= ntohl(header.response.opaque);
+
+  if (header.response.opcode != PROTOCOL_BINARY_CMD_NOOP and
+      index < batch.number_of_keys and batch.server_key[index] == server_key)
+  {
+    uint16_t status= ntohs(header.response.status);
+    batch.results[index]= memcached_binary_status(status);
+
+    if (status == PROTOCOL_BINARY_RESPONSE_SUCCESS and batch.values and bodylen == sizeof(uint64_t))
+    {
+      uint64_t value;
+      if (memcached_failed(rc= memcached_safe_read(instance, &value, sizeof(value))))
+      {
+        return rc;
+      }
+      batch.values[index]= memcached_ntohll(value);
+      bodylen= 0;
+    }
+  }
+
+  if (memcached_failed(rc= batch_skip(instance, bodylen)))
+  {
+    return rc;
+  }
+
+  return header.response.opcode == PROTOCOL_BINARY_CMD_NOOP ? MEMCACHED_END : MEMCACHED_SUCCESS;
+}
+
+/*
+  Read whatever the server owes us. In the binary protocol only the replies
+  that were counted (non-quiet requests and the final NOOP) keep us here,
+  the replies to quiet requests are picked up on the way. In ASCII every
+  reply belongs to the next key of the server's group that expects one.
+*/
+static void batch_drain(memcached_batch_st& batch, const uint32_t server_key,
+                        memcached_instance_st* instance)
+{
+  memcached_batch_server_st& server= batch.servers[server_key];
+
+  while (server.rc == MEMCACHED_SUCCESS and memcached_server_response_count(instance))
+  {
+    memcached_return_t rc;
+    if (memcached_is_binary(batch.root))
+    {
+      rc= batch_binary_read(batch, server_key, instance);
+      if (rc != MEMCACHED_SUCCESS and rc != MEMCACHED_END)
+      {
+        batch_fail(batch, server_key, instance, rc);
+      }
+    }
+    else if (server.cursor < server.end)
+    {
+      size_t index= batch.order[server.cursor++];
+      if (batch.results[index] != MEMCACHED_IN_PROGRESS)
+      {
+        continue;
+      }
+
+      if (memcached_fatal(rc= batch.reply(batch, instance, index)))
+      {
+        batch_fail(batch, server_key, instance, rc);
+      }
+      else
+      {
+        batch.results[index]= rc;
+      }
+    }
+    else
+    {
+      batch_fail(batch, server_key, instance,
+                 memcached_set_error(*instance, MEMCACHED_PROTOCOL_ERROR, MEMCACHED_AT,
+                                     memcached_literal_param("More replies pending than requests sent")));
+    }
+  }
+}
+
+static bool batch_noop(memcached_instance_st* instance, const bool flush)
+{
+  protocol_binary_request_noop request= {};
+  initialize_binary_request(instance, request.message.header);
+  request.message.header.request.opcode= PROTOCOL_BINARY_CMD_NOOP;
+  request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+  request.message.header.request.opaque= htonl(MEMCACHED_BATCH_REPLICA);
+
+  libmemcached_io_vector_st vector[]=
+  {
+    { request.bytes, sizeof(request.bytes) }
+  };
+
+  if (memcached_io_writev(instance, vector, 1, flush) == false)
+  {
+    return false;
+  }
+  memcached_server_response_increment(instance);
+
+  return true;
+}
+
+/*
+  Keep the number of unread replies bounded so neither side stalls. Quiet
+  requests count as well: a hit still streams its value back, and with
+  nothing counted outstanding batch_drain() would not read it until the
+  final NOOP. So once enough of them are pending a counted NOOP is sent
+  behind them and the server is drained up to it.
+*/
+static void batch_watermark(memcached_batch_st& batch, const uint32_t server_key,
+                            memcached_instance_st* instance)
+{
+  memcached_batch_server_st& server= batch.servers[server_key];
+
+  if (server.rc != MEMCACHED_SUCCESS)
+  {
+    return;
+  }
+
+  if (memcached_server_response_count(instance) +server.quiet < batch.root->io_msg_watermark and
+      (server.quiet == 0 or instance->io_bytes_sent < batch.root->io_bytes_watermark))
+  {
+    return;
+  }
+
+  if (server.quiet)
+  {
+    server.quiet= 0;
+    if (batch_noop(instance, false) == false)
+    {
+      batch_fail(batch, server_key, instance, memcached_set_error(*instance, MEMCACHED_WRITE_FAILURE, MEMCACHED_AT));
+      return;
+    }
+  }
+
+  if (memcached_io_write(instance) == false)
+  {
+    batch_fail(batch, server_key, instance, memcached_set_error(*instance, MEMCACHED_WRITE_FAILURE, MEMCACHED_AT));
+    return;
+  }
+
+  batch_drain(batch, server_key, instance);
+}
+
+memcached_return_t memcached_batch_init(memcached_batch_st& batch, Memcached* ptr,
+                                        const char *group_key, size_t group_key_length,
+                                        const char * const *keys, const size_t *key_length,
+                                        size_t number_of_keys,
+                                        memcached_return_t *results)
+{
+  batch.root= ptr;
+  batch.group_key= NULL;
+  batch.group_key_length= 0;
+  batch.keys= keys;
+  batch.key_length= key_length;
+  batch.number_of_keys= 0;
+  batch.results= results;
+  batch.values= NULL;
+  batch.quiet= MEMCACHED_SUCCESS;
+  batch.context= NULL;
+  batch.reply= NULL;
+  batch.order= NULL;
+  batch.server_key= NULL;
+  batch.servers= NULL;
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= initialize_query(ptr, true)))
+  {
+    return rc;
+  }
+
+  if (memcached_is_udp(ptr))
+  {
+    return memcached_set_error(*ptr, MEMCACHED_NOT_SUPPORTED, MEMCACHED_AT,
+                               memcached_literal_param("Batched operations need replies and cannot be sent over UDP"));
+  }
+
+  if (keys == NULL or key_length == NULL or results == NULL)
+  {
+    return memcached_set_error(*ptr, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
+                               memcached_literal_param("keys, key_length and results must not be NULL"));
+  }
+
+  if (number_of_keys >= MEMCACHED_BATCH_REPLICA)
+  {
+    return memcached_set_error(*ptr, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
+                               memcached_literal_param("Too many keys for a single batch"));
+  }
+
+  if (number_of_keys == 0)
+  {
+    return MEMCACHED_SUCCESS;
+  }
+
+  uint32_t server_count= memcached_server_count(ptr);
+  batch.server_key= libmemcached_xcalloc(ptr, number_of_keys, uint32_t);
+  batch.order= libmemcached_xcalloc(ptr, number_of_keys, size_t);
+  batch.servers= libmemcached_xcalloc(ptr, server_count, memcached_batch_server_st);
+
+  if (batch.server_key == NULL or batch.order == NULL or batch.servers == NULL)
+  {
+    memcached_batch_free(batch);
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+  batch.number_of_keys= number_of_keys;
+
+  bool is_group_key_set= false;
+  uint32_t master_server_key= 0;
+  if (group_key and group_key_length)
+  {
+    master_server_key= memcached_generate_hash_with_redistribution(ptr, group_key, group_key_length);
+    is_group_key_set= true;
+    batch.group_key= group_key;
+    batch.group_key_length= group_key_length;
+  }
+
+  /* Count the keys of each server, keys that fail validation get no server */
+  for (size_t x= 0; x < number_of_keys; ++x)
+  {
+    if (memcached_failed(results[x]= memcached_key_test(*ptr, keys +x, key_length +x, 1)))
+    {
+      batch.server_key[x]= server_count;
+      continue;
+    }
+
+    if (is_group_key_set)
+    {
+      batch.server_key[x]= master_server_key;
+    }
+    else
+    {
+      batch.server_key[x]= memcached_generate_hash_with_redistribution(ptr, keys[x], key_length[x]);
+    }
+    batch.servers[batch.server_key[x]].end++;
+  }
+
+  size_t offset= 0;
+  for (uint32_t x= 0; x < server_count; ++x)
+  {
+    size_t count= batch.servers[x].end;
+    batch.servers[x].rc= MEMCACHED_SUCCESS;
+    batch.servers[x].active= false;
+    batch.servers[x].quiet= 0;
+    batch.servers[x].begin= batch.servers[x].cursor= batch.servers[x].end= offset;
+    offset+= count;
+  }
+
+  for (size_t x= 0; x < number_of_keys; ++x)
+  {
+    if (batch.server_key[x] < server_count)
+    {
+      batch.order[batch.servers[batch.server_key[x]].end++]= x;
+    }
+  }
+
+  return MEMCACHED_SUCCESS;
+}
+
+void memcached_batch_free(memcached_batch_st& batch)
+{
+  libmemcached_free(batch.root, batch.order);
+  libmemcached_free(batch.root, batch.server_key);
+  libmemcached_free(batch.root, batch.servers);
+  batch.order= NULL;
+  batch.server_key= NULL;
+  batch.servers= NULL;
+}
+
+memcached_return_t memcached_batch_write(memcached_batch_st& batch, const size_t index,
+                                         libmemcached_io_vector_st vector[], const size_t count,
+                                         const bool reply)
+{
+  uint32_t server_key= batch.server_key[index];
+
+  memcached_instance_st* instance;
+  memcached_return_t rc;
+  if (memcached_failed(rc= batch_activate(batch, server_key, instance)))
+  {
+    return rc;
+  }
+
+  if (memcached_io_writev(instance, vector, count, false) == false)
+  {
+    rc= memcached_set_error(*instance, MEMCACHED_WRITE_FAILURE, MEMCACHED_AT);
+    batch_fail(batch, server_key, instance, rc);
+    return rc;
+  }
+
+  if (reply)
+  {
+    memcached_server_response_increment(instance);
+  }
+  else if (memcached_is_binary(batch.root))
+  {
+    batch.servers[server_key].quiet++;
+  }
+  else
+  {
+    batch.results[index]= batch.quiet;
+  }
+
+  batch_watermark(batch, server_key, instance);
+
+  return batch.servers[server_key].rc;
+}
+
+void memcached_batch_write_replicas(memcached_batch_st& batch, const size_t index,
+                                    libmemcached_io_vector_st vector[], const size_t count)
+{
+  const char *key= batch.group_key ? batch.group_key : batch.keys[index];
+  size_t key_length= batch.group_key ? batch.group_key_length : batch.key_length[index];
+
+  for (uint32_t x= 1; x <= batch.root->number_of_replicas; ++x)
+  {
+    uint32_t server_key= memcached_generate_replica(batch.root, key, key_length, batch.server_key[index], x);
+
+    memcached_instance_st* replica;
+    if (memcached_success(batch_activate(batch, server_key, replica)))
+    {
+      if (memcached_io_writev(replica, vector, count, false) == false)
+      {
+        batch_fail(batch, server_key, replica, memcached_set_error(*replica, MEMCACHED_WRITE_FAILURE, MEMCACHED_AT));
+        continue;
+      }
+
+      if (memcached_is_binary(batch.root))
+      {
+        batch.servers[server_key].quiet++;
+      }
+      batch_watermark(batch, server_key, replica);
+    }
+  }
+}
+
+memcached_return_t memcached_batch_execute(memcached_batch_st& batch,
+                                           memcached_batch_send_fn send,
+                                           memcached_batch_reply_fn reply)
+{
+  Memcached *ptr= batch.root;
+  uint32_t server_count= memcached_server_count(ptr);
+
+  if (batch.number_of_keys == 0)
+  {
+    return MEMCACHED_SUCCESS;
+  }
+
+  batch.reply= reply;
+
+  /* The replies are ours, memcached_purge() hands them to us instead of throwing them away */
+  memcached_batch_st *outer= ptr->batch;
+  ptr->batch= &batch;
+
+  for (uint32_t x= 0; x < server_count; ++x)
+  {
+    memcached_instance_st* instance= memcached_instance_fetch(ptr, x);
+
+    for (size_t position= batch.servers[x].begin; position < batch.servers[x].end; ++position)
+    {
+      size_t index= batch.order[position];
+      batch.results[index]= MEMCACHED_IN_PROGRESS;
+
+      if (batch.servers[x].rc == MEMCACHED_SUCCESS)
+      {
+        memcached_return_t rc= send(batch, instance, index);
+        if (memcached_failed(rc) and batch.servers[x].rc == MEMCACHED_SUCCESS)
+        {
+          batch.results[index]= rc;
+        }
+      }
+    }
+  }
+
+  for (uint32_t x= 0; x < server_count; ++x)
+  {
+    if (batch.servers[x].active == false or batch.servers[x].rc != MEMCACHED_SUCCESS)
+    {
+      continue;
+    }
+
+    memcached_instance_st* instance= memcached_instance_fetch(ptr, x);
+    bool success;
+    if (memcached_is_binary(ptr))
+    {
+      batch.servers[x].quiet= 0;
+      success= batch_noop(instance, true);
+    }
+    else
+    {
+      success= memcached_io_write(instance);
+    }
+
+    if (success == false)
+    {
+      batch_fail(batch, x, instance, memcached_set_error(*instance, MEMCACHED_WRITE_FAILURE, MEMCACHED_AT));
+    }
+  }
+
+  for (uint32_t x= 0; x < server_count; ++x)
+  {
+    if (batch.servers[x].active)
+    {
+      batch_drain(batch, x, memcached_instance_fetch(ptr, x));
+    }
+  }
+
+  ptr->batch= outer;
+
+  memcached_return_t rc= MEMCACHED_SUCCESS;
+  for (size_t x= 0; x < batch.number_of_keys; ++x)
+  {
+    if (batch.results[x] == MEMCACHED_IN_PROGRESS)
+    {
+      memcached_return_t server_rc= batch.servers[batch.server_key[x]].rc;
+      batch.results[x]= memcached_success(server_rc) ? batch.quiet : server_rc;
+    }
+
+    if (batch.results[x] != MEMCACHED_SUCCESS)
+    {
+      rc= MEMCACHED_SOME_ERRORS;
+    }
+  }
+
+  return rc;
+}
+
+bool memcached_batch_purge(memcached_batch_st& batch, memcached_instance_st* instance)
+{
+  uint32_t server_key= uint32_t(instance -memcached_instance_list(batch.root));
+  if (server_key >= memcached_server_count(batch.root) or batch.servers[server_key].active == false)
+  {
+    return true;
+  }
+
+  /* Everything counted has to be on the wire before we wait for its reply */
+  if (memcached_io_write(instance) == false)
+  {
+    batch_fail(batch, server_key, instance, memcached_set_error(*instance, MEMCACHED_WRITE_FAILURE, MEMCACHED_AT));
+    return false;
+  }
+
+  batch_drain(batch, server_key, instance);
+
+  return batch.servers[server_key].rc == MEMCACHED_SUCCESS;
+}
@@ -0,0 +1,111 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  Pipelined multi-key operations.
+
+  Keys are grouped by the server they hash to, every request of a group is
+  written into that server's buffer and each server is then sent a single
+  NOOP. In the binary protocol the opaque of a request carries the index
+  of its key, so the (mostly quiet) replies can be matched back to the
+  caller's results[] array; everything that has not answered by the time the
+  NOOP comes back gets batch.quiet. ASCII replies are matched by order.
+  Quiet requests count toward io_msg_watermark: every so many of them a
+  counted NOOP is slipped in and the server drained up to it, so that the
+  values of hits never pile up unread.
+*/
+
+#define MEMCACHED_BATCH_REPLICA UINT32_MAX
+
+struct memcached_batch_st;
+
+typedef memcached_return_t (*memcached_batch_send_fn)(memcached_batch_st&, memcached_instance_st*, const size_t);
+typedef memcached_return_t (*memcached_batch_reply_fn)(memcached_batch_st&, memcached_instance_st*, const size_t);
+
+struct memcached_batch_server_st {
+  memcached_return_t rc;
+  bool active;
+  size_t begin;
+  size_t end;
+  size_t cursor;
+  size_t quiet;
+};
+
+struct memcached_batch_st {
+  Memcached *root;
+  const char *group_key;
+  size_t group_key_length;
+  const char * const *keys;
+  const size_t *key_length;
+  size_t number_of_keys;
+  memcached_return_t *results;
+  uint64_t *values;
+  memcached_return_t quiet;
+  const void *context;
+  memcached_batch_reply_fn reply;
+  size_t *order;
+  uint32_t *server_key;
+  memcached_batch_server_st *servers;
+};
+
+memcached_return_t memcached_batch_init(memcached_batch_st&, Memcached*,
+                                        const char *group_key, size_t group_key_length,
+                                        const char * const *keys, const size_t *key_length,
+                                        size_t number_of_keys,
+                                        memcached_return_t *results);
+
+void memcached_batch_free(memcached_batch_st&);
+
+memcached_return_t memcached_batch_write(memcached_batch_st&, const size_t index,
+                                         libmemcached_io_vector_st vector[], const size_t count,
+                                         const bool reply);
+
+void memcached_batch_write_replicas(memcached_batch_st&, const size_t index,
+                                    libmemcached_io_vector_st vector[], const size_t count);
+
+memcached_return_t memcached_batch_execute(memcached_batch_st&,
+                                           memcached_batch_send_fn send,
+                                           memcached_batch_reply_fn reply);
+
+/*
+  Called by memcached_purge() while a batch is executing, when one of its
+  servers reaches io_msg_watermark or io_bytes_watermark. The replies are
+  read into the batch's results rather than thrown away.
+*/
+bool memcached_batch_purge(memcached_batch_st&, memcached_instance_st*);
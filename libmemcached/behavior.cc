@@ -55,6 +55,10 @@ bool memcached_is_consistent_distribution(const Memcached* memc)
   case MEMCACHED_DISTRIBUTION_MODULA:
   case MEMCACHED_DISTRIBUTION_RANDOM:
   case MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV:
   case MEMCACHED_DISTRIBUTION_CONSISTENT_MAX:
     break;
   }
@@ -206,6 +210,22 @@ memcached_return_t memcached_behavior_set(memcached_st *shell,
   case MEMCACHED_BEHAVIOR_KETAMA_HASH:
     return memcached_behavior_set_distribution_hash(ptr, (memcached_hash_t)(data));
 
+  case MEMCACHED_BEHAVIOR_KETAMA_64BIT:
+    memcached_set_64bit_ketama(ptr, bool(data));
+    return run_distribution(ptr);
+
+  case MEMCACHED_BEHAVIOR_BOUNDED_LOAD:
+    if (data > UINT16_MAX)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
+                                 memcached_literal_param("MEMCACHED_BEHAVIOR_BOUNDED_LOAD must be no more than 65535 percent"));
+    }
+    ptr->bounded_load.epsilon= uint32_t(data);
+    break;
+
+  case MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR:
+    return memcached_slab_enable(ptr, bool(data));
+
   case MEMCACHED_BEHAVIOR_CACHE_LOOKUPS:
     return memcached_set_error(*ptr, MEMCACHED_DEPRECATED, MEMCACHED_AT,
                                       memcached_literal_param("MEMCACHED_BEHAVIOR_CACHE_LOOKUPS has been deprecated."));
@@ -262,6 +282,7 @@ memcached_return_t memcached_behavior_set(memcached_st *shell,
 
   case MEMCACHED_BEHAVIOR_HASH_WITH_PREFIX_KEY:
     ptr->flags.hash_with_namespace= bool(data);
+    memcached_route_install(ptr);
     break;
 
   case MEMCACHED_BEHAVIOR_NOREPLY:
@@ -284,6 +305,20 @@ memcached_return_t memcached_behavior_set(memcached_st *shell,
       ptr->flags.randomize_replica_read= bool(data);
       break;
 
+  case MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE:
+      if (data >= 100)
+      {
+        return memcached_set_error(*ptr, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
+                                   memcached_literal_param("MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE must be less than 100"));
+      }
+      ptr->hedge_read_percentile= uint32_t(data);
+      break;
+
+  case MEMCACHED_BEHAVIOR_REPLICA_READ_LEAST_LOADED:
+      srandom((uint32_t) time(NULL));
+      ptr->flags.replica_read_least_loaded= bool(data);
+      break;
+
   case MEMCACHED_BEHAVIOR_CORK:
       return memcached_set_error(*ptr, MEMCACHED_DEPRECATED, MEMCACHED_AT,
                                  memcached_literal_param("MEMCACHED_BEHAVIOR_CORK is now incorporated into the driver by default."));
@@ -374,6 +409,15 @@ uint64_t memcached_behavior_get(memcached_st *shell,
   case MEMCACHED_BEHAVIOR_KETAMA_HASH:
     return hashkit_get_function(&ptr->hashkit);
 
+  case MEMCACHED_BEHAVIOR_KETAMA_64BIT:
+    return memcached_is_64bit_ketama(ptr);
+
+  case MEMCACHED_BEHAVIOR_BOUNDED_LOAD:
+    return ptr->bounded_load.epsilon;
+
+  case MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR:
+    return memcached_slab_is_enabled(ptr);
+
   case MEMCACHED_BEHAVIOR_REMOVE_FAILED_SERVERS:
   case MEMCACHED_BEHAVIOR_SERVER_FAILURE_LIMIT:
     return ptr->server_failure_limit;
@@ -494,6 +538,12 @@ uint64_t memcached_behavior_get(memcached_st *shell,
   case MEMCACHED_BEHAVIOR_RANDOMIZE_REPLICA_READ:
     return ptr->flags.randomize_replica_read;
 
+  case MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE:
+    return ptr->hedge_read_percentile;
+
+  case MEMCACHED_BEHAVIOR_REPLICA_READ_LEAST_LOADED:
+    return ptr->flags.replica_read_least_loaded;
+
   case MEMCACHED_BEHAVIOR_CORK:
 #ifdef HAVE_MSG_MORE
     return true;
@@ -545,6 +595,16 @@ memcached_return_t memcached_behavior_set_distribution(memcached_st *shell, memc
     case MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET:
       break;
 
+    case MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP:
+      break;
+
+    case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS:
+    case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON:
+      break;
+
+    case MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV:
+      break;
+
     default:
     case MEMCACHED_DISTRIBUTION_CONSISTENT_MAX:
       return memcached_set_error(*ptr, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
@@ -577,6 +637,7 @@ memcached_return_t memcached_behavior_set_key_hash(memcached_st *shell, memcache
   {
     if (hashkit_success(hashkit_set_function(&ptr->hashkit, (hashkit_hash_algorithm_t)type)))
     {
+      memcached_route_install(ptr);
       return MEMCACHED_SUCCESS;
     }
 
@@ -650,6 +711,9 @@ const char *libmemcached_string_behavior(const memcached_behavior_t flag)
   case MEMCACHED_BEHAVIOR_DEAD_TIMEOUT: return "MEMCACHED_BEHAVIOR_DEAD_TIMEOUT";
   case MEMCACHED_BEHAVIOR_KETAMA_WEIGHTED: return "MEMCACHED_BEHAVIOR_KETAMA_WEIGHTED";
   case MEMCACHED_BEHAVIOR_KETAMA_HASH: return "MEMCACHED_BEHAVIOR_KETAMA_HASH";
+  case MEMCACHED_BEHAVIOR_KETAMA_64BIT: return "MEMCACHED_BEHAVIOR_KETAMA_64BIT";
+  case MEMCACHED_BEHAVIOR_BOUNDED_LOAD: return "MEMCACHED_BEHAVIOR_BOUNDED_LOAD";
+  case MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR: return "MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR";
   case MEMCACHED_BEHAVIOR_BINARY_PROTOCOL: return "MEMCACHED_BEHAVIOR_BINARY_PROTOCOL";
   case MEMCACHED_BEHAVIOR_SND_TIMEOUT: return "MEMCACHED_BEHAVIOR_SND_TIMEOUT";
   case MEMCACHED_BEHAVIOR_RCV_TIMEOUT: return "MEMCACHED_BEHAVIOR_RCV_TIMEOUT";
@@ -664,6 +728,8 @@ const char *libmemcached_string_behavior(const memcached_behavior_t flag)
   case MEMCACHED_BEHAVIOR_REMOVE_FAILED_SERVERS: return "MEMCACHED_BEHAVIOR_REMOVE_FAILED_SERVERS";
   case MEMCACHED_BEHAVIOR_NUMBER_OF_REPLICAS: return "MEMCACHED_BEHAVIOR_NUMBER_OF_REPLICAS";
   case MEMCACHED_BEHAVIOR_RANDOMIZE_REPLICA_READ: return "MEMCACHED_BEHAVIOR_RANDOMIZE_REPLICA_READ";
+  case MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE: return "MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE";
+  case MEMCACHED_BEHAVIOR_REPLICA_READ_LEAST_LOADED: return "MEMCACHED_BEHAVIOR_REPLICA_READ_LEAST_LOADED";
   case MEMCACHED_BEHAVIOR_CORK: return "MEMCACHED_BEHAVIOR_CORK";
   case MEMCACHED_BEHAVIOR_TCP_KEEPALIVE: return "MEMCACHED_BEHAVIOR_TCP_KEEPALIVE";
   case MEMCACHED_BEHAVIOR_TCP_KEEPIDLE: return "MEMCACHED_BEHAVIOR_TCP_KEEPIDLE";
@@ -684,6 +750,10 @@ const char *libmemcached_string_distribution(const memcached_server_distribution
   case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY: return "MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY";
   case MEMCACHED_DISTRIBUTION_CONSISTENT_WEIGHTED: return "MEMCACHED_DISTRIBUTION_CONSISTENT_WEIGHTED";
   case MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET: return "MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET";
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP: return "MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP";
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS: return "MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS";
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON: return "MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON";
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV: return "MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV";
   default:
   case MEMCACHED_DISTRIBUTION_CONSISTENT_MAX: return "INVALID memcached_server_distribution_t";
   }
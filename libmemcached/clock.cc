@@ -0,0 +1,94 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+#if defined(HAVE_CLOCK_GETTIME) && HAVE_CLOCK_GETTIME
+# if defined(CLOCK_MONOTONIC_COARSE)
+#  define MEMCACHED_CLOCK_ID CLOCK_MONOTONIC_COARSE
+# elif defined(CLOCK_MONOTONIC)
+#  define MEMCACHED_CLOCK_ID CLOCK_MONOTONIC
+# endif
+#endif
+
+#ifdef MEMCACHED_CLOCK_ID
+struct memcached_clock_base_st {
+  bool is_monotonic;
+  time_t offset;
+};
+
+static memcached_clock_base_st clock_base_init(void)
+{
+  memcached_clock_base_st base= { false, 0 };
+
+  struct timespec ts;
+  struct timeval tv;
+  if (clock_gettime(MEMCACHED_CLOCK_ID, &ts) == 0 and gettimeofday(&tv, NULL) == 0)
+  {
+    base.offset= tv.tv_sec - ts.tv_sec;
+    base.is_monotonic= true;
+  }
+
+  return base;
+}
+
+/*
+  Taken by a static initializer while the library is loaded, so no once
+  primitive (and no pthread, which the win32 build does not have) is
+  needed.
+*/
+static const memcached_clock_base_st clock_base= clock_base_init();
+#endif
+
+time_t memcached_clock_now(void)
+{
+#ifdef MEMCACHED_CLOCK_ID
+  struct timespec ts;
+  if (clock_base.is_monotonic and clock_gettime(MEMCACHED_CLOCK_ID, &ts) == 0)
+  {
+    return ts.tv_sec +clock_base.offset;
+  }
+#endif
+
+  struct timeval tv;
+  if (gettimeofday(&tv, NULL) == 0)
+  {
+    return tv.tv_sec;
+  }
+
+  return time(NULL);
+}
@@ -139,8 +139,11 @@ memcached_instance_st* memcached_instance_fetch(memcached_st *ptr, uint32_t serv
 # include "libmemcached/socket.hpp"
 # include "libmemcached/connect.hpp"
 # include "libmemcached/allocators.hpp"
+# include "libmemcached/slab.hpp"
+# include "libmemcached/clock.hpp"
 # include "libmemcached/hash.hpp"
 # include "libmemcached/quit.hpp"
+# include "libmemcached/hedge.hpp"
 # include "libmemcached/instance.hpp"
 # include "libmemcached/server_instance.h"
 # include "libmemcached/server.hpp"
@@ -148,6 +151,7 @@ memcached_instance_st* memcached_instance_fetch(memcached_st *ptr, uint32_t serv
 # include "libmemcached/behavior.hpp"
 # include "libmemcached/sasl.hpp"
 # include "libmemcached/server_list.hpp"
+# include "libmemcached/batch.hpp"
 #endif
 
 #include "libmemcached/internal.h"
@@ -174,6 +178,9 @@ memcached_instance_st* memcached_instance_fetch(memcached_st *ptr, uint32_t serv
 #endif
 
 #include "libmemcached/continuum.hpp"
+#include "libmemcached/rendezvous.hpp"
+#include "libmemcached/maglev.hpp"
+#include "libmemcached/snapshot.hpp"
 
 #if !defined(__GNUC__) || (__GNUC__ == 2 && __GNUC_MINOR__ < 96)
 
@@ -198,19 +205,33 @@ extern "C" {
 memcached_return_t run_distribution(memcached_st *ptr);
 
 #ifdef __cplusplus
-static inline void memcached_server_response_increment(memcached_instance_st* instance)
+static inline void memcached_instance_response_increment(memcached_instance_st* instance)
 {
-  instance->events(POLLIN);
   instance->cursor_active_++;
+  memcached_instance_pending_update(instance);
+}
+
+static inline void memcached_instance_response_decrement(memcached_instance_st* instance)
+{
+  instance->cursor_active_--;
+  memcached_instance_pending_update(instance);
+}
+
+static inline void memcached_instance_response_reset(memcached_instance_st* instance)
+{
+  instance->cursor_active_= 0;
+  memcached_instance_pending_update(instance);
 }
-#endif
 
-#define memcached_server_response_decrement(A) (A)->cursor_active_--
-#define memcached_server_response_reset(A) (A)->cursor_active_=0
+static inline void memcached_server_response_increment(memcached_instance_st* instance)
+{
+  instance->events(POLLIN);
+  memcached_instance_response_increment(instance);
+}
 
-#define memcached_instance_response_increment(A) (A)->cursor_active_++
-#define memcached_instance_response_decrement(A) (A)->cursor_active_--
-#define memcached_instance_response_reset(A) (A)->cursor_active_=0
+#define memcached_server_response_decrement(A) memcached_instance_response_decrement(A)
+#define memcached_server_response_reset(A) memcached_instance_response_reset(A)
+#endif
 
 #ifdef __cplusplus
 }
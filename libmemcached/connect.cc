@@ -664,8 +664,7 @@ static memcached_return_t network_connect(memcached_instance_st* server)
 */
 static memcached_return_t backoff_handling(memcached_instance_st* server, bool& in_timeout)
 {
-  struct timeval curr_time;
-  bool _gettime_success= (gettimeofday(&curr_time, NULL) == 0);
+  time_t now= memcached_clock_now();
 
   /* 
     If we hit server_failure_limit then something is completely wrong about the server.
@@ -683,9 +682,9 @@ static memcached_return_t backoff_handling(memcached_instance_st* server, bool&
       set_last_disconnected_host(server);
 
       // Retry dead servers if requested
-      if (_gettime_success and server->root->dead_timeout > 0)
+      if (server->root->dead_timeout > 0)
       {
-        server->next_retry= curr_time.tv_sec +server->root->dead_timeout;
+        server->next_retry= now +server->root->dead_timeout;
 
         // We only retry dead servers once before assuming failure again
         server->server_failure_counter= server->root->server_failure_limit -1;
@@ -714,7 +713,7 @@ static memcached_return_t backoff_handling(memcached_instance_st* server, bool&
     /*
       If next_retry is less then our current time, then we reset and try everything again.
     */
-    if (_gettime_success and server->next_retry < curr_time.tv_sec)
+    if (server->next_retry < now)
     {
       server->state= MEMCACHED_SERVER_STATE_NEW;
       server->server_timeout_counter= 0;
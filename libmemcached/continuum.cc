@@ -0,0 +1,763 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+/*
+  Points are ordered by value, then by low word on a 64 bit ring, then by
+  server, so a continuum built from scratch and one patched by remove/merge
+  come out identical.
+*/
+struct continuum_wide_item_st
+{
+  uint32_t value;
+  uint32_t low;
+  uint32_t index;
+};
+
+static inline bool continuum_less(uint32_t first_value, uint32_t first_low, uint32_t first_index,
+                                  uint32_t second_value, uint32_t second_low, uint32_t second_index)
+{
+  if (first_value != second_value)
+  {
+    return first_value < second_value;
+  }
+
+  if (first_low != second_low)
+  {
+    return first_low < second_low;
+  }
+
+  return first_index < second_index;
+}
+
+static inline int continuum_compare(uint32_t first_value, uint32_t first_low, uint32_t first_index,
+                                    uint32_t second_value, uint32_t second_low, uint32_t second_index)
+{
+  if (continuum_less(first_value, first_low, first_index, second_value, second_low, second_index))
+  {
+    return -1;
+  }
+  else if (continuum_less(second_value, second_low, second_index, first_value, first_low, first_index))
+  {
+    return 1;
+  }
+
+  return 0;
+}
+
+static int continuum_item_cmp(const void *t1, const void *t2)
+{
+  const memcached_continuum_item_st *ct1= (const memcached_continuum_item_st *)t1;
+  const memcached_continuum_item_st *ct2= (const memcached_continuum_item_st *)t2;
+
+  return continuum_compare(ct1->value, 0, ct1->index, ct2->value, 0, ct2->index);
+}
+
+static int continuum_wide_item_cmp(const void *t1, const void *t2)
+{
+  const continuum_wide_item_st *ct1= (const continuum_wide_item_st *)t1;
+  const continuum_wide_item_st *ct2= (const continuum_wide_item_st *)t2;
+
+  return continuum_compare(ct1->value, ct1->low, ct1->index, ct2->value, ct2->low, ct2->index);
+}
+
+static int continuum_point_cmp(const void *t1, const void *t2)
+{
+  const memcached_continuum_point_st *ct1= (const memcached_continuum_point_st *)t1;
+  const memcached_continuum_point_st *ct2= (const memcached_continuum_point_st *)t2;
+
+  return continuum_compare(ct1->value, ct1->low, ct1->sequence, ct2->value, ct2->low, ct2->sequence);
+}
+
+/* Unweighted runs use every point they hold. */
+static inline bool continuum_run_uses(const memcached_continuum_run_st& run, uint32_t point)
+{
+  if (run.sequences)
+  {
+    return run.sequences[point] < run.wanted;
+  }
+
+  return point < run.wanted;
+}
+
+static void continuum_run_reset(memcached_st *ptr, memcached_continuum_run_st& run)
+{
+  libmemcached_free(ptr, run.hostname);
+  libmemcached_free(ptr, run.values);
+  libmemcached_free(ptr, run.sequences);
+  libmemcached_free(ptr, run.lows);
+  memset(&run, 0, sizeof(memcached_continuum_run_st));
+}
+
+void memcached_continuum_cache_destroy(memcached_st *ptr, memcached_continuum_cache_st *cache)
+{
+  if (cache)
+  {
+    for (uint32_t x= 0; x < cache->count; x++)
+    {
+      continuum_run_reset(ptr, cache->runs[x]);
+    }
+    libmemcached_free(ptr, cache->runs);
+    libmemcached_free(ptr, cache->lows);
+    libmemcached_free(ptr, cache);
+  }
+}
+
+void memcached_continuum_cache_free(memcached_st *ptr)
+{
+  memcached_continuum_cache_destroy(ptr, ptr->ketama.cache);
+  ptr->ketama.cache= NULL;
+}
+
+template <class T>
+static bool continuum_copy(memcached_st *ptr, T*& destination, const T *source, size_t count)
+{
+  destination= NULL;
+  if (source == NULL or count == 0)
+  {
+    return true;
+  }
+
+  if ((destination= (T *)libmemcached_malloc(ptr, count * sizeof(T))) == NULL)
+  {
+    return false;
+  }
+  memcpy(destination, source, count * sizeof(T));
+
+  return true;
+}
+
+/*
+  Deep copy of a cache, for a handle that is about to patch a continuum it
+  shares.  The lows array only exists while update_continuum() runs and is
+  not copied.
+*/
+memcached_continuum_cache_st *memcached_continuum_cache_clone(memcached_st *ptr,
+                                                              const memcached_continuum_cache_st *source)
+{
+  memcached_continuum_cache_st *cache= libmemcached_xcalloc(ptr, 1, memcached_continuum_cache_st);
+  if (cache == NULL)
+  {
+    return NULL;
+  }
+
+  cache->is_spy= source->is_spy;
+  cache->is_weighted= source->is_weighted;
+  cache->is_64bit= source->is_64bit;
+  cache->function= source->function;
+  cache->context= source->context;
+
+  if (source->count and (cache->runs= libmemcached_xcalloc(ptr, source->count, memcached_continuum_run_st)) == NULL)
+  {
+    memcached_continuum_cache_destroy(ptr, cache);
+    return NULL;
+  }
+  cache->count= source->count;
+
+  for (uint32_t x= 0; x < source->count; x++)
+  {
+    const memcached_continuum_run_st& from= source->runs[x];
+    memcached_continuum_run_st& run= cache->runs[x];
+
+    run.port= from.port;
+    run.hashed= from.hashed;
+    run.live= from.live;
+    run.wanted= from.wanted;
+    if (continuum_copy(ptr, run.hostname, from.hostname, from.hostname ? strlen(from.hostname) +1 : 0) == false or
+        continuum_copy(ptr, run.values, from.values, from.hashed) == false or
+        continuum_copy(ptr, run.sequences, from.sequences, from.hashed) == false or
+        continuum_copy(ptr, run.lows, from.lows, from.hashed) == false)
+    {
+      memcached_continuum_cache_destroy(ptr, cache);
+      return NULL;
+    }
+  }
+
+  return cache;
+}
+
+memcached_return_t memcached_continuum_cache_prepare(memcached_st *ptr, bool& rebuild)
+{
+  bool is_spy= ptr->distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY;
+  bool is_weighted= memcached_is_weighted_ketama(ptr);
+  bool is_64bit= memcached_is_64bit_ketama(ptr);
+
+  memcached_continuum_cache_st *cache= ptr->ketama.cache;
+  if (cache and (cache->is_spy != is_spy or
+                 cache->is_weighted != is_weighted or
+                 cache->is_64bit != is_64bit or
+                 cache->function != ptr->hashkit.base_hash.function or
+                 cache->context != ptr->hashkit.base_hash.context))
+  {
+    memcached_continuum_cache_free(ptr);
+    cache= NULL;
+  }
+
+  if (cache == NULL)
+  {
+    cache= libmemcached_xcalloc(ptr, 1, memcached_continuum_cache_st);
+    if (cache == NULL)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+    cache->is_spy= is_spy;
+    cache->is_weighted= is_weighted;
+    cache->is_64bit= is_64bit;
+    cache->function= ptr->hashkit.base_hash.function;
+    cache->context= ptr->hashkit.base_hash.context;
+    ptr->ketama.cache= cache;
+    rebuild= true;
+  }
+
+  // Servers are only ever appended, new runs start out empty and are merged
+  // in like a server coming back.
+  uint32_t server_count= memcached_server_count(ptr);
+  if (cache->count != server_count)
+  {
+    if (server_count < cache->count)
+    {
+      for (uint32_t x= server_count; x < cache->count; x++)
+      {
+        continuum_run_reset(ptr, cache->runs[x]);
+      }
+      rebuild= true;
+    }
+
+    memcached_continuum_run_st *runs= libmemcached_xrealloc(ptr, cache->runs, server_count, memcached_continuum_run_st);
+    if (runs == NULL and server_count)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+
+    for (uint32_t x= cache->count; x < server_count; x++)
+    {
+      memset(&runs[x], 0, sizeof(memcached_continuum_run_st));
+    }
+    cache->runs= runs;
+    cache->count= server_count;
+  }
+
+  for (uint32_t host_index= 0; host_index < server_count; host_index++)
+  {
+    memcached_continuum_run_st& run= cache->runs[host_index];
+    const memcached_instance_st* instance= memcached_instance_list(ptr) +host_index;
+
+    if (run.hostname and run.port == instance->port() and strcmp(run.hostname, instance->_hostname) == 0)
+    {
+      continue;
+    }
+
+    if (run.live)
+    {
+      rebuild= true;
+    }
+    continuum_run_reset(ptr, run);
+
+    size_t hostname_length= strlen(instance->_hostname) +1;
+    run.hostname= (char *)libmemcached_malloc(ptr, hostname_length);
+    if (run.hostname == NULL)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+    memcpy(run.hostname, instance->_hostname, hostname_length);
+    run.port= instance->port();
+  }
+
+  return MEMCACHED_SUCCESS;
+}
+
+static void continuum_scratch_free(memcached_st *ptr)
+{
+  libmemcached_free(ptr, ptr->ketama.continuum);
+  ptr->ketama.continuum= NULL;
+  ptr->ketama.continuum_count= 0;
+
+  if (ptr->ketama.cache)
+  {
+    libmemcached_free(ptr, ptr->ketama.cache->lows);
+    ptr->ketama.cache->lows= NULL;
+  }
+}
+
+/*
+  Between updates the continuum only lives in the lookup table.  This makes
+  room for points in the sorted array update_continuum() works on, and
+  unpacks the lookup table into it when the continuum is to be patched
+  rather than rebuilt.
+*/
+memcached_return_t memcached_continuum_reserve(memcached_st *ptr, uint32_t points, bool rebuild)
+{
+  memcached_continuum_cache_st *cache= ptr->ketama.cache;
+  const memcached_continuum_lookup_st *lookup= rebuild ? NULL : ptr->ketama.lookup;
+
+  uint32_t existing= lookup ? lookup->count : 0;
+  if (points < existing)
+  {
+    points= existing;
+  }
+
+  continuum_scratch_free(ptr);
+  ptr->ketama.continuum= libmemcached_xrealloc(ptr, NULL, points ? points : 1, memcached_continuum_item_st);
+  if (cache->is_64bit)
+  {
+    cache->lows= libmemcached_xrealloc(ptr, NULL, points ? points : 1, uint32_t);
+  }
+
+  if (ptr->ketama.continuum == NULL or (cache->is_64bit and cache->lows == NULL))
+  {
+    continuum_scratch_free(ptr);
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+  ptr->ketama.continuum_count= points;
+
+  for (uint32_t x= 0; x < existing; x++)
+  {
+    ptr->ketama.continuum[x].value= lookup->values[x];
+    ptr->ketama.continuum[x].index= memcached_continuum_lookup_index(lookup, x);
+    if (cache->lows)
+    {
+      cache->lows[x]= lookup->lows ? lookup->lows[x] : 0;
+    }
+  }
+  ptr->ketama.continuum_points_counter= existing;
+
+  return MEMCACHED_SUCCESS;
+}
+
+/* Builds the lookup table from the sorted array and lets the array go. */
+memcached_return_t memcached_continuum_pack(memcached_st *ptr)
+{
+  memcached_return_t rc= memcached_continuum_lookup_build(ptr, ptr->ketama.continuum,
+                                                         ptr->ketama.cache->lows,
+                                                         ptr->ketama.continuum_points_counter);
+  continuum_scratch_free(ptr);
+
+  return rc;
+}
+
+/*
+  points holds room for "count" points, the caller has filled in the ones
+  from run.hashed on.  They are sorted together with what the run already
+  had.
+*/
+memcached_return_t memcached_continuum_run_append(memcached_st *ptr, memcached_continuum_run_st& run,
+                                                  memcached_continuum_point_st *points, uint32_t count)
+{
+  memcached_continuum_cache_st *cache= ptr->ketama.cache;
+
+  for (uint32_t x= 0; x < run.hashed; x++)
+  {
+    points[x].value= run.values[x];
+    points[x].low= run.lows ? run.lows[x] : 0;
+    points[x].sequence= run.sequences ? run.sequences[x] : x;
+  }
+  qsort(points, count, sizeof(memcached_continuum_point_st), continuum_point_cmp);
+
+  uint32_t *values= libmemcached_xrealloc(ptr, run.values, count, uint32_t);
+  if (values == NULL)
+  {
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+  run.values= values;
+
+  if (cache->is_weighted)
+  {
+    uint32_t *sequences= libmemcached_xrealloc(ptr, run.sequences, count, uint32_t);
+    if (sequences == NULL)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+    run.sequences= sequences;
+  }
+
+  if (cache->is_64bit)
+  {
+    uint32_t *lows= libmemcached_xrealloc(ptr, run.lows, count, uint32_t);
+    if (lows == NULL)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+    run.lows= lows;
+  }
+
+  for (uint32_t x= 0; x < count; x++)
+  {
+    run.values[x]= points[x].value;
+    if (run.sequences)
+    {
+      run.sequences[x]= points[x].sequence;
+    }
+    if (run.lows)
+    {
+      run.lows[x]= points[x].low;
+    }
+  }
+  run.hashed= count;
+
+  return MEMCACHED_SUCCESS;
+}
+
+/* FNV-1a, kept apart from the key hash so the low word is independent of it. */
+uint32_t memcached_continuum_low_hash(const char *key, size_t key_length, uint32_t alignment)
+{
+  uint32_t hash= 2166136261UL;
+  for (size_t x= 0; x < key_length; x++)
+  {
+    hash^= uint8_t(key[x]);
+    hash*= 16777619;
+  }
+  hash^= alignment;
+  hash*= 16777619;
+
+  return hash;
+}
+
+memcached_return_t memcached_continuum_rebuild(memcached_st *ptr)
+{
+  memcached_continuum_cache_st *cache= ptr->ketama.cache;
+
+  uint32_t points= 0;
+  for (uint32_t host_index= 0; host_index < cache->count; host_index++)
+  {
+    points+= cache->runs[host_index].wanted;
+  }
+
+  continuum_wide_item_st *wide= NULL;
+  if (cache->is_64bit)
+  {
+    wide= libmemcached_xcalloc(ptr, points, continuum_wide_item_st);
+    if (wide == NULL and points)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+  }
+
+  uint32_t continuum_index= 0;
+  for (uint32_t host_index= 0; host_index < cache->count; host_index++)
+  {
+    memcached_continuum_run_st& run= cache->runs[host_index];
+    for (uint32_t x= 0; x < run.hashed; x++)
+    {
+      if (continuum_run_uses(run, x) == false)
+      {
+        continue;
+      }
+
+      if (wide)
+      {
+        wide[continuum_index].value= run.values[x];
+        wide[continuum_index].low= run.lows[x];
+        wide[continuum_index++].index= host_index;
+      }
+      else
+      {
+        ptr->ketama.continuum[continuum_index].index= host_index;
+        ptr->ketama.continuum[continuum_index++].value= run.values[x];
+      }
+    }
+    run.live= run.wanted;
+  }
+  ptr->ketama.continuum_points_counter= continuum_index;
+
+  if (wide)
+  {
+    qsort(wide, continuum_index, sizeof(continuum_wide_item_st), continuum_wide_item_cmp);
+    for (uint32_t x= 0; x < continuum_index; x++)
+    {
+      ptr->ketama.continuum[x].index= wide[x].index;
+      ptr->ketama.continuum[x].value= wide[x].value;
+      cache->lows[x]= wide[x].low;
+    }
+    libmemcached_free(ptr, wide);
+  }
+  else
+  {
+    qsort(ptr->ketama.continuum, continuum_index, sizeof(memcached_continuum_item_st), continuum_item_cmp);
+  }
+
+  return MEMCACHED_SUCCESS;
+}
+
+void memcached_continuum_remove(memcached_st *ptr)
+{
+  memcached_continuum_cache_st *cache= ptr->ketama.cache;
+
+  bool is_removing= false;
+  for (uint32_t host_index= 0; host_index < cache->count; host_index++)
+  {
+    if (cache->runs[host_index].live and cache->runs[host_index].wanted == 0)
+    {
+      is_removing= true;
+    }
+  }
+
+  if (is_removing == false)
+  {
+    return;
+  }
+
+  uint32_t continuum_index= 0;
+  for (uint32_t x= 0; x < ptr->ketama.continuum_points_counter; x++)
+  {
+    if (cache->runs[ptr->ketama.continuum[x].index].wanted)
+    {
+      if (cache->lows)
+      {
+        cache->lows[continuum_index]= cache->lows[x];
+      }
+      ptr->ketama.continuum[continuum_index++]= ptr->ketama.continuum[x];
+    }
+  }
+  ptr->ketama.continuum_points_counter= continuum_index;
+
+  for (uint32_t host_index= 0; host_index < cache->count; host_index++)
+  {
+    if (cache->runs[host_index].wanted == 0)
+    {
+      cache->runs[host_index].live= 0;
+    }
+  }
+}
+
+/*
+  Merges the server's run into the continuum from the back, so the points
+  already in place only move once.  The caller has made room for them.
+*/
+void memcached_continuum_merge(memcached_st *ptr, uint32_t host_index)
+{
+  memcached_continuum_cache_st *cache= ptr->ketama.cache;
+  memcached_continuum_run_st& run= cache->runs[host_index];
+  memcached_continuum_item_st *continuum= ptr->ketama.continuum;
+  uint32_t *lows= cache->lows;
+
+  uint32_t existing= ptr->ketama.continuum_points_counter;
+  uint32_t position= existing +run.wanted;
+  uint32_t point= run.hashed;
+
+  while (point)
+  {
+    if (continuum_run_uses(run, point -1) == false)
+    {
+      point--;
+      continue;
+    }
+
+    uint32_t value= run.values[point -1];
+    uint32_t low= run.lows ? run.lows[point -1] : 0;
+
+    if (existing and continuum_less(value, low, host_index,
+                                    continuum[existing -1].value, lows ? lows[existing -1] : 0, continuum[existing -1].index))
+    {
+      --position;
+      --existing;
+      continuum[position]= continuum[existing];
+      if (lows)
+      {
+        lows[position]= lows[existing];
+      }
+    }
+    else
+    {
+      --position;
+      continuum[position].index= host_index;
+      continuum[position].value= value;
+      if (lows)
+      {
+        lows[position]= low;
+      }
+      point--;
+    }
+  }
+
+  ptr->ketama.continuum_points_counter+= run.wanted;
+  run.live= run.wanted;
+}
+
+static uint32_t continuum_lookup_bits(uint32_t count)
+{
+  uint32_t bits= 1;
+  while (bits < MEMCACHED_CONTINUUM_LOOKUP_MAX_BITS and (uint32_t(1) << bits) * MEMCACHED_CONTINUUM_LOOKUP_RUN < count)
+  {
+    bits++;
+  }
+
+  return bits;
+}
+
+static size_t continuum_lookup_length(uint32_t count, uint32_t bits, bool has_lows, bool is_narrow)
+{
+  size_t prefix_count= (size_t(1) << bits) +1;
+  size_t value_count= size_t(count) +MEMCACHED_CONTINUUM_LOOKUP_PAD;
+  size_t low_count= has_lows ? count : 0;
+
+  // The 16 bit indexes go last so every other array stays aligned.
+  return sizeof(memcached_continuum_lookup_st)
+    + (prefix_count + value_count + low_count) * sizeof(uint32_t)
+    + count * (is_narrow ? sizeof(uint16_t) : sizeof(uint32_t));
+}
+
+static memcached_continuum_lookup_st *continuum_lookup_create(memcached_st *ptr, uint32_t count, uint32_t bits,
+                                                              bool has_lows, bool is_narrow)
+{
+  memcached_continuum_lookup_st *lookup= (memcached_continuum_lookup_st *)libmemcached_malloc(ptr, continuum_lookup_length(count, bits, has_lows, is_narrow));
+  if (lookup == NULL)
+  {
+    return NULL;
+  }
+
+  size_t prefix_count= (size_t(1) << bits) +1;
+  size_t value_count= size_t(count) +MEMCACHED_CONTINUUM_LOOKUP_PAD;
+  size_t low_count= has_lows ? count : 0;
+
+  lookup->count= count;
+  lookup->shift= 32 - bits;
+  lookup->prefix= (uint32_t *)(lookup +1);
+  lookup->values= lookup->prefix +prefix_count;
+  lookup->lows= has_lows ? lookup->values +value_count : NULL;
+  lookup->indexes16= NULL;
+  lookup->indexes= NULL;
+  if (is_narrow)
+  {
+    lookup->indexes16= (uint16_t *)(lookup->values +value_count +low_count);
+  }
+  else
+  {
+    lookup->indexes= lookup->values +value_count +low_count;
+  }
+
+  return lookup;
+}
+
+memcached_continuum_lookup_st *memcached_continuum_lookup_clone(memcached_st *ptr,
+                                                                const memcached_continuum_lookup_st *source)
+{
+  uint32_t bits= 32 - source->shift;
+  bool has_lows= source->lows != NULL;
+  bool is_narrow= source->indexes16 != NULL;
+
+  memcached_continuum_lookup_st *lookup= continuum_lookup_create(ptr, source->count, bits, has_lows, is_narrow);
+  if (lookup)
+  {
+    size_t length= continuum_lookup_length(source->count, bits, has_lows, is_narrow);
+    memcpy(lookup +1, source +1, length - sizeof(memcached_continuum_lookup_st));
+  }
+
+  return lookup;
+}
+
+/*
+  The previous table stays in place until the new one has been allocated,
+  since it is the only copy of the continuum.
+*/
+memcached_return_t memcached_continuum_lookup_build(memcached_st *ptr,
+                                                    const memcached_continuum_item_st *continuum,
+                                                    const uint32_t *lows,
+                                                    uint32_t count)
+{
+  if (count == 0)
+  {
+    memcached_continuum_lookup_free(ptr);
+    return MEMCACHED_SUCCESS;
+  }
+
+  uint32_t largest_index= 0;
+  for (uint32_t x= 0; x < count; x++)
+  {
+    if (continuum[x].index > largest_index)
+    {
+      largest_index= continuum[x].index;
+    }
+  }
+  bool is_narrow= largest_index <= UINT16_MAX;
+
+  uint32_t bits= continuum_lookup_bits(count);
+  size_t prefix_count= (size_t(1) << bits) +1;
+  size_t value_count= size_t(count) +MEMCACHED_CONTINUUM_LOOKUP_PAD;
+
+  memcached_continuum_lookup_st *lookup= continuum_lookup_create(ptr, count, bits, lows != NULL, is_narrow);
+  if (lookup == NULL)
+  {
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+
+  for (uint32_t x= 0; x < count; x++)
+  {
+    lookup->values[x]= continuum[x].value;
+    if (lookup->lows)
+    {
+      lookup->lows[x]= lows[x];
+    }
+
+    if (is_narrow)
+    {
+      lookup->indexes16[x]= uint16_t(continuum[x].index);
+    }
+    else
+    {
+      lookup->indexes[x]= continuum[x].index;
+    }
+  }
+
+  for (size_t x= count; x < value_count; x++)
+  {
+    lookup->values[x]= UINT32_MAX;
+  }
+
+  // prefix[bucket] is the first point whose top bits are at least bucket.
+  uint32_t position= 0;
+  for (size_t bucket= 0; bucket < prefix_count -1; bucket++)
+  {
+    while (position < count and (lookup->values[position] >> lookup->shift) < bucket)
+    {
+      position++;
+    }
+    lookup->prefix[bucket]= position;
+  }
+  lookup->prefix[prefix_count -1]= count;
+
+  memcached_continuum_lookup_free(ptr);
+  ptr->ketama.lookup= lookup;
+
+  return MEMCACHED_SUCCESS;
+}
+
+void memcached_continuum_lookup_free(memcached_st *ptr)
+{
+  libmemcached_free(ptr, ptr->ketama.lookup);
+  ptr->ketama.lookup= NULL;
+}
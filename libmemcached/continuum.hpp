@@ -38,9 +38,218 @@
 
 #pragma once
 
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+# include <arm_neon.h>
+#endif
+
 /* string value */
 struct memcached_continuum_item_st
 {
   uint32_t index;
   uint32_t value;
 };
+
+/*
+  Lookup layout of the ketama continuum.
+
+  Between updates this is the only copy of the continuum.  update_continuum()
+  unpacks it into a sorted array of memcached_continuum_item_st, patches or
+  rebuilds that, packs it back and frees the array.  The point values and the
+  server indexes live in separate arrays so the search only touches values,
+  and a radix table indexed by the top bits of the hash gives the run of
+  values sharing that prefix.  Runs are sized to
+  average MEMCACHED_CONTINUUM_LOOKUP_RUN points, so a lookup is one load from
+  the prefix table followed by a vector scan of one or two cache lines.
+
+  The values array is padded with UINT32_MAX so the scan may read past the
+  end of a run without a bounds check.  Server indexes are stored in 16 bits
+  unless there are more servers than that holds.
+
+  With MEMCACHED_BEHAVIOR_KETAMA_64BIT every point and key also carries a
+  second, independent 32 bit hash, the low word of its 64 bit position.  The
+  high word is the classic ketama value, so keys only land somewhere else
+  when their high word collides with a point's.
+*/
+#define MEMCACHED_CONTINUUM_LOOKUP_RUN 4
+#define MEMCACHED_CONTINUUM_LOOKUP_SCAN 16
+#define MEMCACHED_CONTINUUM_LOOKUP_PAD 4
+#define MEMCACHED_CONTINUUM_LOOKUP_MAX_BITS 20
+
+struct memcached_continuum_lookup_st
+{
+  uint32_t count;
+  uint32_t shift;
+  uint32_t *prefix;
+  uint32_t *values;
+  uint32_t *lows; // 64 bit rings only
+  uint16_t *indexes16;
+  uint32_t *indexes;
+};
+
+/*
+  Per-server point cache for the ketama continuum.
+
+  Each server keeps the points it has been hashed to, ordered by value.  A
+  weighted server also keeps the sequence each point was generated in, so it
+  can use the first "wanted" of them without hashing again.  When auto eject
+  takes a server out or lets it back in, or a server is added,
+  update_continuum() removes or merges that one run instead of hashing every
+  server and sorting the whole continuum.  A run is thrown away when the
+  server at its position, the distribution or the hash changes.
+*/
+struct memcached_continuum_point_st
+{
+  uint32_t value;
+  uint32_t low;
+  uint32_t sequence;
+};
+
+struct memcached_continuum_run_st
+{
+  char *hostname;
+  in_port_t port;
+  uint32_t hashed; // Points in the run
+  uint32_t live; // Points the server has in the continuum
+  uint32_t wanted; // Points the server should have in the continuum
+  uint32_t *values;
+  uint32_t *sequences; // Weighted rings only
+  uint32_t *lows; // 64 bit rings only
+};
+
+struct memcached_continuum_cache_st
+{
+  bool is_spy;
+  bool is_weighted;
+  bool is_64bit;
+  hashkit_hash_fn function;
+  void *context;
+  uint32_t count;
+  struct memcached_continuum_run_st *runs;
+  uint32_t *lows; // Low words of ketama.continuum during an update, 64 bit rings only
+};
+
+#ifdef __cplusplus
+
+memcached_return_t memcached_continuum_cache_prepare(memcached_st *ptr, bool& rebuild);
+
+void memcached_continuum_cache_free(memcached_st *ptr);
+
+void memcached_continuum_cache_destroy(memcached_st *ptr, memcached_continuum_cache_st *cache);
+
+memcached_continuum_cache_st *memcached_continuum_cache_clone(memcached_st *ptr,
+                                                              const memcached_continuum_cache_st *source);
+
+memcached_return_t memcached_continuum_reserve(memcached_st *ptr, uint32_t points, bool rebuild);
+
+memcached_return_t memcached_continuum_pack(memcached_st *ptr);
+
+memcached_return_t memcached_continuum_run_append(memcached_st *ptr, memcached_continuum_run_st& run,
+                                                  memcached_continuum_point_st *points, uint32_t count);
+
+uint32_t memcached_continuum_low_hash(const char *key, size_t key_length, uint32_t alignment);
+
+memcached_return_t memcached_continuum_rebuild(memcached_st *ptr);
+
+void memcached_continuum_remove(memcached_st *ptr);
+
+void memcached_continuum_merge(memcached_st *ptr, uint32_t host_index);
+
+memcached_return_t memcached_continuum_lookup_build(memcached_st *ptr,
+                                                    const memcached_continuum_item_st *continuum,
+                                                    const uint32_t *lows,
+                                                    uint32_t count);
+
+memcached_continuum_lookup_st *memcached_continuum_lookup_clone(memcached_st *ptr,
+                                                                const memcached_continuum_lookup_st *source);
+
+void memcached_continuum_lookup_free(memcached_st *ptr);
+
+/* Number of the four values at position that are below hash. */
+static inline uint32_t memcached_continuum_lookup_rank4(const uint32_t *position, uint32_t hash)
+{
+#if defined(__SSE2__)
+  const __m128i bias= _mm_set1_epi32(int(0x80000000));
+  __m128i needle= _mm_xor_si128(_mm_set1_epi32(int(hash)), bias);
+  __m128i values= _mm_xor_si128(_mm_loadu_si128((const __m128i *)position), bias);
+  int mask= _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(values, needle)));
+  return uint32_t(__builtin_popcount(mask));
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  uint32x4_t less= vcltq_u32(vld1q_u32(position), vdupq_n_u32(hash));
+  return vaddvq_u32(vshrq_n_u32(less, 31));
+#else
+  return uint32_t(position[0] < hash) + uint32_t(position[1] < hash) +
+         uint32_t(position[2] < hash) + uint32_t(position[3] < hash);
+#endif
+}
+
+/*
+  Returns the position of the point owning hash, the same one the binary
+  search over the sorted continuum finds: the first point whose value is not
+  below hash, wrapping around to the first point.  low only matters on a 64
+  bit ring.
+*/
+static inline uint32_t memcached_continuum_lookup_position(const memcached_continuum_lookup_st *lookup, uint32_t hash, uint32_t low)
+{
+  uint32_t bucket= hash >> lookup->shift;
+  uint32_t position= lookup->prefix[bucket];
+  uint32_t end= lookup->prefix[bucket +1];
+
+  if (end - position > MEMCACHED_CONTINUUM_LOOKUP_SCAN)
+  {
+    // Skewed run, fall back to a branchless search inside it.
+    uint32_t length= end - position;
+    while (length > 1)
+    {
+      uint32_t half= length / 2;
+      position= (lookup->values[position +half] < hash) ? position +half : position;
+      length-= half;
+    }
+    position+= uint32_t(lookup->values[position] < hash);
+  }
+  else
+  {
+    // Every value past the end of the run is at least the next prefix, or
+    // padding, so counting what is below hash stops by itself.
+    uint32_t rank;
+    do
+    {
+      rank= memcached_continuum_lookup_rank4(lookup->values +position, hash);
+      position+= rank;
+    } while (rank == 4);
+  }
+
+  if (lookup->lows)
+  {
+    while (position < lookup->count and lookup->values[position] == hash and lookup->lows[position] < low)
+    {
+      position++;
+    }
+  }
+
+  if (position >= lookup->count)
+  {
+    position= 0;
+  }
+
+  return position;
+}
+
+static inline uint32_t memcached_continuum_lookup_index(const memcached_continuum_lookup_st *lookup, uint32_t position)
+{
+  if (lookup->indexes16)
+  {
+    return lookup->indexes16[position];
+  }
+
+  return lookup->indexes[position];
+}
+
+/* Returns the server index owning hash. */
+static inline uint32_t memcached_continuum_lookup(const memcached_continuum_lookup_st *lookup, uint32_t hash, uint32_t low)
+{
+  return memcached_continuum_lookup_index(lookup, memcached_continuum_lookup_position(lookup, hash, low));
+}
+
+#endif
@@ -171,6 +171,10 @@ inline void __config_error(Context *context, yyscan_t *scanner, const char *erro
 %token CONSISTENT
 %token MODULA
 %token RANDOM
+%token JUMP
+%token RENDEZVOUS
+%token RENDEZVOUS_SKELETON
+%token MAGLEV
 
 /* Boolean values */
 %token <boolean> CSL_TRUE
@@ -532,6 +536,22 @@ distribution:
           {
             $$= MEMCACHED_DISTRIBUTION_RANDOM;
           }
+        | JUMP
+          {
+            $$= MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP;
+          }
+        | RENDEZVOUS
+          {
+            $$= MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS;
+          }
+        | RENDEZVOUS_SKELETON
+          {
+            $$= MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON;
+          }
+        | MAGLEV
+          {
+            $$= MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV;
+          }
         ;
 
 %% 
@@ -67,6 +67,8 @@ static inline memcached_return_t ascii_delete(memcached_instance_st* instance,
 
 static inline memcached_return_t binary_delete(memcached_instance_st* instance,
                                                uint32_t server_key,
+                                               const char *group_key,
+                                               const size_t group_key_length,
                                                const char *key,
                                                const size_t key_length,
                                                const bool reply,
@@ -109,16 +111,10 @@ static inline memcached_return_t binary_delete(memcached_instance_st* instance,
   {
     request.message.header.request.opcode= PROTOCOL_BINARY_CMD_DELETEQ;
 
-    for (uint32_t x= 0; x < memcached_has_replicas(instance); ++x)
+    for (uint32_t x= 1; x <= memcached_has_replicas(instance); ++x)
     {
-      ++server_key;
-
-      if (server_key == memcached_server_count(instance->root))
-      {
-        server_key= 0;
-      }
-
-      memcached_instance_st* replica= memcached_instance_fetch(instance->root, server_key);
+      uint32_t replica_key= memcached_generate_replica(instance->root, group_key, group_key_length, server_key, x);
+      memcached_instance_st* replica= memcached_instance_fetch(instance->root, replica_key);
 
       if (memcached_fatal(memcached_vdo(replica, vector, 4, should_flush)))
       {
@@ -184,7 +180,7 @@ memcached_return_t memcached_delete_by_key(memcached_st *shell,
 
   if (memcached_is_binary(memc))
   {
-    rc= binary_delete(instance, server_key, key, key_length, is_replying, is_buffering);
+    rc= binary_delete(instance, server_key, group_key, group_key_length, key, key_length, is_replying, is_buffering);
   }
   else
   {
@@ -219,3 +215,118 @@ memcached_return_t memcached_delete_by_key(memcached_st *shell,
   LIBMEMCACHED_MEMCACHED_DELETE_END();
   return rc;
 }
+
+static memcached_return_t batch_delete_send(memcached_batch_st& batch,
+                                            memcached_instance_st* instance,
+                                            const size_t index)
+{
+  const char *key= batch.keys[index];
+  const size_t key_length= batch.key_length[index];
+
+  if (memcached_is_binary(batch.root))
+  {
+    protocol_binary_request_delete request= {};
+
+    initialize_binary_request(instance, request.message.header);
+
+    request.message.header.request.opcode= PROTOCOL_BINARY_CMD_DELETEQ;
+    request.message.header.request.opaque= htonl(uint32_t(index));
+    request.message.header.request.keylen= htons(uint16_t(key_length + memcached_array_size(instance->root->_namespace)));
+    request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+    request.message.header.request.bodylen= htonl(uint32_t(key_length + memcached_array_size(instance->root->_namespace)));
+
+    libmemcached_io_vector_st vector[]=
+    {
+      { NULL, 0 },
+      { request.bytes, sizeof(request.bytes) },
+      { memcached_array_string(instance->root->_namespace), memcached_array_size(instance->root->_namespace) },
+      { key, key_length }
+    };
+
+    memcached_return_t rc= memcached_batch_write(batch, index, vector, 4, false);
+    if (memcached_success(rc) and memcached_has_replicas(instance))
+    {
+      request.message.header.request.opaque= htonl(MEMCACHED_BATCH_REPLICA);
+      memcached_batch_write_replicas(batch, index, vector, 4);
+    }
+
+    return rc;
+  }
+
+  const bool reply= memcached_is_replying(batch.root);
+  libmemcached_io_vector_st vector[]=
+  {
+    { NULL, 0 },
+    { memcached_literal_param("delete ") },
+    { memcached_array_string(instance->root->_namespace), memcached_array_size(instance->root->_namespace) },
+    { key, key_length },
+    { " noreply", reply ? 0 : memcached_literal_param_size(" noreply") },
+    { memcached_literal_param("\r\n") }
+  };
+
+  return memcached_batch_write(batch, index, vector, 6, reply);
+}
+
+static memcached_return_t batch_delete_reply(memcached_batch_st&,
+                                             memcached_instance_st* instance,
+                                             const size_t)
+{
+  memcached_return_t rc= memcached_read_one_response(instance, NULL);
+  if (rc == MEMCACHED_DELETED)
+  {
+    rc= MEMCACHED_SUCCESS;
+  }
+
+  return rc;
+}
+
+memcached_return_t memcached_delete_multi(memcached_st *shell,
+                                          const char * const *keys,
+                                          const size_t *key_length,
+                                          size_t number_of_keys,
+                                          memcached_return_t *results)
+{
+  return memcached_delete_multi_by_key(shell, NULL, 0, keys, key_length, number_of_keys, results);
+}
+
+memcached_return_t memcached_delete_multi_by_key(memcached_st *shell,
+                                                 const char *group_key, size_t group_key_length,
+                                                 const char * const *keys,
+                                                 const size_t *key_length,
+                                                 size_t number_of_keys,
+                                                 memcached_return_t *results)
+{
+  Memcached* memc= memcached2Memcached(shell);
+
+  memcached_batch_st batch;
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_batch_init(batch, memc, group_key, group_key_length,
+                                                keys, key_length, number_of_keys, results)))
+  {
+    return rc;
+  }
+
+  if (memc->delete_trigger and memcached_is_replying(memc) == false)
+  {
+    memcached_batch_free(batch);
+    return memcached_set_error(*memc, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT, 
+                               memcached_literal_param("Delete triggers cannot be used if MEMCACHED_BEHAVIOR_NOREPLY is set"));
+  }
+
+  rc= memcached_batch_execute(batch, batch_delete_send, batch_delete_reply);
+
+  if (memc->delete_trigger)
+  {
+    for (size_t x= 0; x < number_of_keys; ++x)
+    {
+      if (results[x] == MEMCACHED_SUCCESS)
+      {
+        memc->delete_trigger(memc, keys[x], key_length[x]);
+      }
+    }
+  }
+
+  memcached_batch_free(batch);
+
+  return rc;
+}
@@ -44,17 +44,124 @@
 #include <cstdio>
 
 #define MAX_ERROR_LENGTH 2048
+#define MEMCACHED_ERROR_DETAIL_LENGTH 256
+#define MEMCACHED_ERROR_RING_SIZE 4
+
+/*
+  Errors are recorded into a ring of MEMCACHED_ERROR_RING_SIZE entries that
+  a handle, or an instance, allocates the first time it has one to record.
+  Recording copies the return code, errno, location and the first
+  MEMCACHED_ERROR_DETAIL_LENGTH bytes of detail and nothing more, the host
+  is read from the instance and the message put together only when it is
+  asked for.
+
+  error_messages points at the newest entry and next at older ones from the
+  same query, once the ring wraps the oldest entry drops off the end.
+*/
 struct memcached_error_t
 {
   Memcached *root;
+  const memcached_instance_st *instance; // The error came from, if any
   uint64_t query_id;
   struct memcached_error_t *next;
   memcached_return_t rc;
   int local_errno;
+  const char *at;
   size_t size;
+  char detail[MEMCACHED_ERROR_DETAIL_LENGTH];
+};
+
+struct memcached_error_ring_st
+{
+  uint32_t position;
+  memcached_error_t entry[MEMCACHED_ERROR_RING_SIZE];
+};
+
+/*
+  A handle's ring also holds the one message buffer, errors on its
+  instances are formatted into it as well. It caches the last message
+  asked for and is filled in by the const getters.
+*/
+struct memcached_error_message_st : public memcached_error_ring_st
+{
+  const memcached_error_t *formatted;
   char message[MAX_ERROR_LENGTH];
 };
 
+static memcached_error_ring_st *_error_ring_create(Memcached&, Memcached& root)
+{
+  memcached_error_message_st *ring= libmemcached_xmalloc(&root, memcached_error_message_st);
+  if (ring)
+  {
+    ring->formatted= NULL;
+  }
+
+  return ring;
+}
+
+static memcached_error_ring_st *_error_ring_create(memcached_instance_st&, Memcached& root)
+{
+  return libmemcached_xmalloc(&root, memcached_error_ring_st);
+}
+
+static memcached_error_message_st *_error_message_buffer(const Memcached& memc)
+{
+  return static_cast<memcached_error_message_st *>(memc.error_ring);
+}
+
+template <class T>
+static memcached_error_t *_error_next(T& self, Memcached& root)
+{
+  if (self.error_ring == NULL)
+  {
+    self.error_ring= _error_ring_create(self, root);
+    if (self.error_ring == NULL)
+    {
+      return NULL;
+    }
+
+    self.error_ring->position= 0;
+    for (uint32_t x= 0; x < MEMCACHED_ERROR_RING_SIZE; x++)
+    {
+      self.error_ring->entry[x].next= NULL;
+    }
+  }
+
+  memcached_error_ring_st *ring= self.error_ring;
+  uint32_t index= ring->position++ % MEMCACHED_ERROR_RING_SIZE;
+  memcached_error_t *error= &ring->entry[index];
+
+  // The entry after this one is now the oldest, nothing is left behind it.
+  memcached_error_t *oldest= &ring->entry[(index +1) % MEMCACHED_ERROR_RING_SIZE];
+  if (oldest->next == error)
+  {
+    oldest->next= NULL;
+  }
+
+  memcached_error_message_st *buffer= _error_message_buffer(root);
+  if (buffer and buffer->formatted == error)
+  {
+    buffer->formatted= NULL;
+  }
+
+  error->next= self.error_messages;
+  self.error_messages= error;
+
+  return error;
+}
+
+static void _error_copy(memcached_error_t& error, const memcached_error_t& source)
+{
+  error.root= source.root;
+  error.instance= source.instance;
+  error.query_id= source.query_id;
+  error.rc= source.rc;
+  error.local_errno= source.local_errno;
+  error.at= source.at;
+  error.size= source.size;
+  memcpy(error.detail, source.detail, source.size);
+}
+
 static void _set(memcached_instance_st& server, Memcached& memc)
 {
   if (server.error_messages and server.error_messages->query_id != server.root->query_id)
@@ -69,21 +176,15 @@ static void _set(memcached_instance_st& server, Memcached& memc)
       server.io_wait_count.timeouts++;
     }
 
-    memcached_error_t *error= libmemcached_xmalloc(&memc, memcached_error_t);
+    memcached_error_t *error= _error_next(server, memc);
     if (error)
     {
-      memcpy(error, memc.error_messages, sizeof(memcached_error_t));
-      error->next= server.error_messages;
-      server.error_messages= error;
+      _error_copy(*error, *memc.error_messages);
     }
   }
 }
 
-#if 0
-static int error_log_fd= -1;
-#endif
-
-static void _set(Memcached& memc, memcached_string_t *str, memcached_return_t &rc, const char *at, int local_errno= 0)
+static void _set(Memcached& memc, memcached_string_t *str, memcached_return_t &rc, const char *at, int local_errno= 0, memcached_instance_st* instance= NULL)
 {
   if (memc.error_messages && memc.error_messages->query_id != memc.query_id)
   {
@@ -129,14 +230,10 @@ static void _set(Memcached& memc, memcached_string_t *str, memcached_return_t &r
       rc= MEMCACHED_CONNECTION_FAILURE;
     }
 
-    if (rc == MEMCACHED_TIMEOUT)
-    {
-    }
-
-    memcached_error_t *error= libmemcached_xmalloc(&memc, memcached_error_t);
+    memcached_error_t *error= _error_next(memc, memc);
     if (error == NULL) // Bad business if this happens
     {
-      assert_msg(error, "libmemcached_xmalloc() failed to allocate a memcached_error_t");
+      assert_msg(error, "libmemcached_xmalloc() failed to allocate a memcached_error_ring_st");
       return;
     }
 
@@ -144,93 +241,192 @@ static void _set(Memcached& memc, memcached_string_t *str, memcached_return_t &r
     error->query_id= memc.query_id;
     error->rc= rc;
     error->local_errno= local_errno;
+    error->at= at;
+    error->instance= instance;
+    error->size= 0;
 
     // MEMCACHED_CLIENT_ERROR is a special case because it is an error coming from the server
     if (rc == MEMCACHED_CLIENT_ERROR)
     {
       assert(str);
       assert(str->size);
-      if (str and str->size)
-      {
-        assert(error->local_errno == 0);
-        error->local_errno= 0;
+      assert(error->local_errno == 0);
+      error->local_errno= 0;
+    }
 
-        error->size= (int)snprintf(error->message, MAX_ERROR_LENGTH, "(%p) %.*s", 
-                                   error->root,
-                                   int(str->size), str->c_str);
-      }
+    if (str and str->size)
+    {
+      error->size= str->size < sizeof(error->detail) ? str->size : sizeof(error->detail);
+      memcpy(error->detail, str->c_str, error->size);
     }
-    else if (local_errno)
+
+  }
+}
+
+static inline size_t append_host_to_string(const memcached_instance_st& instance, char* buffer, const size_t buffer_length)
+{
+  int size= 0;
+  switch (instance.type)
+  {
+  case MEMCACHED_CONNECTION_TCP:
+  case MEMCACHED_CONNECTION_UDP:
+    size= snprintf(buffer, buffer_length, " host: %s:%d",
+                   instance.hostname(), int(instance.port()));
+    break;
+
+  case MEMCACHED_CONNECTION_UNIX_SOCKET:
+    size= snprintf(buffer, buffer_length, " socket: %s",
+                   instance.hostname());
+    break;
+  }
+
+  if (size < 0)
+  {
+    return 0;
+  }
+
+  return size_t(size) < buffer_length ? size_t(size) : buffer_length -1;
+}
+
+/*
+  The server list may have been rebuilt since the error was recorded, an
+  instance is only used if it is still one of the handle's.
+*/
+static const memcached_instance_st *_error_instance(const memcached_error_t& error)
+{
+  if (error.instance == NULL or error.root == NULL)
+  {
+    return NULL;
+  }
+
+  for (uint32_t x= 0; x < memcached_server_count(error.root); x++)
+  {
+    if (memcached_instance_by_position(error.root, x) == error.instance)
     {
-      const char *errmsg_ptr;
-      char errmsg[MAX_ERROR_LENGTH];
-      errmsg[0]= 0;
-      errmsg_ptr= errmsg;
+      return error.instance;
+    }
+  }
+
+  return NULL;
+}
+
+static const char *_error_strerror(int local_errno, char *errmsg, size_t errmsg_length)
+{
+  const char *errmsg_ptr= errmsg;
+  errmsg[0]= 0;
 
 #if defined(STRERROR_R_CHAR_P) && STRERROR_R_CHAR_P
-      errmsg_ptr= strerror_r(local_errno, errmsg, sizeof(errmsg));
+  errmsg_ptr= strerror_r(local_errno, errmsg, errmsg_length);
 #elif defined(HAVE_STRERROR_R) && HAVE_STRERROR_R
-      strerror_r(local_errno, errmsg, sizeof(errmsg));
-      errmsg_ptr= errmsg;
+  strerror_r(local_errno, errmsg, errmsg_length);
+  errmsg_ptr= errmsg;
 #elif defined(HAVE_STRERROR) && HAVE_STRERROR
-      snprintf(errmsg, sizeof(errmsg), "%s", strerror(local_errno));
-      errmsg_ptr= errmsg;
+  snprintf(errmsg, errmsg_length, "%s", strerror(local_errno));
+  errmsg_ptr= errmsg;
+#else
+  (void)local_errno;
+  (void)errmsg_length;
 #endif
 
-      if (str and str->size and local_errno)
-      {
-        error->size= (int)snprintf(error->message, MAX_ERROR_LENGTH, "(%p) %s(%s), %.*s -> %s", 
-                                   error->root,
-                                   memcached_strerror(&memc, rc), 
-                                   errmsg_ptr,
-                                   memcached_string_printf(*str), at);
-      }
-      else
+  return errmsg_ptr;
+}
+
+static size_t _error_format(const memcached_error_t& error, const memcached_instance_st *instance,
+                            char *message, const size_t message_length)
+{
+  // Errors on an instance read "detail,  host: name:port".
+  char with_host[MAX_ERROR_LENGTH];
+  memcached_string_t str= { error.detail, error.size };
+  if (instance)
+  {
+    size_t size= 0;
+    if (error.size)
+    {
+      size= size_t(snprintf(with_host, sizeof(with_host), "%.*s, ", int(error.size), error.detail));
+      if (size >= sizeof(with_host))
       {
-        error->size= (int)snprintf(error->message, MAX_ERROR_LENGTH, "(%p) %s(%s) -> %s", 
-                                   error->root,
-                                   memcached_strerror(&memc, rc), 
-                                   errmsg_ptr,
-                                   at);
+        size= sizeof(with_host) -1;
       }
     }
-    else if (rc == MEMCACHED_PARSE_ERROR and str and str->size)
-    {
-      error->size= (int)snprintf(error->message, MAX_ERROR_LENGTH, "(%p) %.*s -> %s", 
-                                 error->root,
-                                 int(str->size), str->c_str, at);
-    }
-    else if (str and str->size)
+    size+= append_host_to_string(*instance, with_host +size, sizeof(with_host) -size);
+
+    str.c_str= with_host;
+    str.size= size;
+  }
+
+  int size;
+  if (error.rc == MEMCACHED_CLIENT_ERROR and str.size)
+  {
+    size= snprintf(message, message_length, "(%p) %.*s",
+                   error.root,
+                   int(str.size), str.c_str);
+  }
+  else if (error.local_errno)
+  {
+    char errmsg[MAX_ERROR_LENGTH];
+    const char *errmsg_ptr= _error_strerror(error.local_errno, errmsg, sizeof(errmsg));
+
+    if (str.size)
     {
-      error->size= (int)snprintf(error->message, MAX_ERROR_LENGTH, "(%p) %s, %.*s -> %s", 
-                                 error->root,
-                                 memcached_strerror(&memc, rc), 
-                                 int(str->size), str->c_str, at);
+      size= snprintf(message, message_length, "(%p) %s(%s), %.*s -> %s",
+                     error.root,
+                     memcached_strerror(error.root, error.rc),
+                     errmsg_ptr,
+                     memcached_string_printf(str), error.at);
     }
     else
     {
-      error->size= (int)snprintf(error->message, MAX_ERROR_LENGTH, "(%p) %s -> %s", 
-                                 error->root,
-                                 memcached_strerror(&memc, rc), at);
+      size= snprintf(message, message_length, "(%p) %s(%s) -> %s",
+                     error.root,
+                     memcached_strerror(error.root, error.rc),
+                     errmsg_ptr,
+                     error.at);
     }
+  }
+  else if (error.rc == MEMCACHED_PARSE_ERROR and str.size)
+  {
+    size= snprintf(message, message_length, "(%p) %.*s -> %s",
+                   error.root,
+                   int(str.size), str.c_str, error.at);
+  }
+  else if (str.size)
+  {
+    size= snprintf(message, message_length, "(%p) %s, %.*s -> %s",
+                   error.root,
+                   memcached_strerror(error.root, error.rc),
+                   int(str.size), str.c_str, error.at);
+  }
+  else
+  {
+    size= snprintf(message, message_length, "(%p) %s -> %s",
+                   error.root,
+                   memcached_strerror(error.root, error.rc), error.at);
+  }
 
-    error->next= memc.error_messages;
-    memc.error_messages= error;
+  if (size < 0)
+  {
+    message[0]= 0;
+    return 0;
   }
 
-#if 0
-  if (error_log_fd == -1)
+  return size_t(size) < message_length ? size_t(size) : message_length -1;
+}
+
+static const char *_error_message(const Memcached& memc, const memcached_error_t& error, const memcached_instance_st *instance)
+{
+  memcached_error_message_st *buffer= _error_message_buffer(memc);
+  if (buffer == NULL)
   {
-//    unlink("/tmp/libmemcachd.log");
-    if ((error_log_fd= open("/tmp/libmemcachd.log", O_CREAT | O_WRONLY | O_APPEND, 0644)) < 0)
-    {
-      perror("open");
-      error_log_fd= -1;
-    }
+    return memcached_strerror(&memc, error.rc);
   }
-  ::write(error_log_fd, error->message, error->size);
-  ::write(error_log_fd, "\n", 1);
-#endif
+
+  if (buffer->formatted != &error)
+  {
+    _error_format(error, instance, buffer->message, sizeof(buffer->message));
+    buffer->formatted= &error;
+  }
+
+  return buffer->message;
 }
 
 memcached_return_t memcached_set_error(Memcached& memc, memcached_return_t rc, const char *at, const char *str, size_t length)
@@ -278,26 +474,6 @@ memcached_return_t memcached_set_parser_error(Memcached& memc,
   return memcached_set_error(memc, MEMCACHED_PARSE_ERROR, at, buffer, length);
 }
 
-static inline size_t append_host_to_string(memcached_instance_st& self, char* buffer, const size_t buffer_length)
-{
-  size_t size= 0;
-  switch (self.type)
-  {
-  case MEMCACHED_CONNECTION_TCP:
-  case MEMCACHED_CONNECTION_UDP:
-    size+= snprintf(buffer, buffer_length, " host: %s:%d",
-                    self.hostname(), int(self.port()));
-    break;
-
-  case MEMCACHED_CONNECTION_UNIX_SOCKET:
-    size+= snprintf(buffer, buffer_length, " socket: %s",
-                    self.hostname());
-    break;
-  }
-
-  return size;
-}
-
 memcached_return_t memcached_set_error(memcached_instance_st& self, memcached_return_t rc, const char *at, memcached_string_t& str)
 {
   assert_msg(rc != MEMCACHED_ERRNO, "Programmer error, MEMCACHED_ERRNO was set to be returned to client");
@@ -307,24 +483,10 @@ memcached_return_t memcached_set_error(memcached_instance_st& self, memcached_re
     return rc;
   }
 
-  char hostname_port_message[MAX_ERROR_LENGTH];
-  char* hostname_port_message_ptr= hostname_port_message;
-  int size= 0;
-  if (str.size)
-  {
-    size= snprintf(hostname_port_message_ptr, sizeof(hostname_port_message), "%.*s, ",
-                   memcached_string_printf(str));
-    hostname_port_message_ptr+= size;
-  }
-
-  size+= append_host_to_string(self, hostname_port_message_ptr, sizeof(hostname_port_message) -size);
-
-  memcached_string_t error_host= { hostname_port_message, size_t(size) };
-
   assert_msg(self.root, "Programmer error, root was not set on instance");
   if (self.root)
   {
-    _set(*self.root, &error_host, rc, at);
+    _set(*self.root, &str, rc, at, 0, &self);
     _set(self, (*self.root));
     assert(self.error_messages);
     assert(self.root->error_messages);
@@ -342,14 +504,9 @@ memcached_return_t memcached_set_error(memcached_instance_st& self, memcached_re
     return rc;
   }
 
-  char hostname_port[MEMCACHED_NI_MAXHOST +MEMCACHED_NI_MAXSERV + sizeof("host : ")];
-  size_t size= append_host_to_string(self, hostname_port, sizeof(hostname_port));
-
-  memcached_string_t error_host= { hostname_port, size};
-
   if (self.root)
   {
-    _set(*self.root, &error_host, rc, at);
+    _set(*self.root, NULL, rc, at, 0, &self);
     _set(self, *self.root);
   }
 
@@ -414,35 +571,15 @@ memcached_return_t memcached_set_errno(memcached_instance_st& self, int local_er
     return MEMCACHED_SUCCESS;
   }
 
-  char hostname_port_message[MAX_ERROR_LENGTH];
-  char* hostname_port_message_ptr= hostname_port_message;
-  size_t size= 0;
-  if (str.size)
-  {
-    size= snprintf(hostname_port_message_ptr, sizeof(hostname_port_message), "%.*s, ", memcached_string_printf(str));
-  }
-  size+= append_host_to_string(self, hostname_port_message_ptr, sizeof(hostname_port_message) -size);
-
-  memcached_string_t error_host= { hostname_port_message, size };
-
   memcached_return_t rc= MEMCACHED_ERRNO;
   if (self.root == NULL)
   {
     return rc;
   }
 
-  _set(*self.root, &error_host, rc, at, local_errno);
+  _set(*self.root, &str, rc, at, local_errno, &self);
   _set(self, (*self.root));
 
-#if 0
-  if (self.root->error_messages->rc != self.error_messages->rc)
-  {
-    fprintf(stderr, "%s:%d %s != %s\n", __FILE__, __LINE__,
-            memcached_strerror(NULL, self.root->error_messages->rc),
-            memcached_strerror(NULL, self.error_messages->rc));
-  }
-#endif
-
   return rc;
 }
 
@@ -453,40 +590,36 @@ memcached_return_t memcached_set_errno(memcached_instance_st& self, int local_er
     return MEMCACHED_SUCCESS;
   }
 
-  char hostname_port_message[MAX_ERROR_LENGTH];
-  size_t size= append_host_to_string(self, hostname_port_message, sizeof(hostname_port_message));
-
-  memcached_string_t error_host= { hostname_port_message, size };
-
   memcached_return_t rc= MEMCACHED_ERRNO;
   if (self.root == NULL)
   {
     return rc;
   }
 
-  _set(*self.root, &error_host, rc, at, local_errno);
+  _set(*self.root, NULL, rc, at, local_errno, &self);
   _set(self, (*self.root));
 
   return rc;
 }
 
-static void _error_print(const memcached_error_t *error)
+static void _error_print(const memcached_error_t *error, const memcached_instance_st *instance)
 {
   if (error == NULL)
   {
     return;
   }
 
-  if (error->size == 0)
+  char message[MAX_ERROR_LENGTH];
+  if (_error_format(*error, instance ? instance : _error_instance(*error), message, sizeof(message)) == 0)
   {
     fprintf(stderr, "\t%s\n", memcached_strerror(NULL, error->rc) );
   }
   else
   {
-    fprintf(stderr, "\t%s %s\n", memcached_strerror(NULL, error->rc), error->message);
+    fprintf(stderr, "\t%s %s\n", memcached_strerror(NULL, error->rc), message);
   }
 
-  _error_print(error->next);
+  _error_print(error->next, instance);
 }
 
 void memcached_error_print(const Memcached *shell)
@@ -497,42 +630,57 @@ void memcached_error_print(const Memcached *shell)
     return;
   }
 
-  _error_print(self->error_messages);
+  _error_print(self->error_messages, NULL);
 
   for (uint32_t x= 0; x < memcached_server_count(self); x++)
   {
     memcached_instance_st* instance= memcached_instance_by_position(self, x);
 
-    _error_print(instance->error_messages);
+    _error_print(instance->error_messages, instance);
   }
 }
 
-static void _error_free(memcached_error_t *error)
+void memcached_error_free(Memcached& self)
 {
-  if (error)
-  {
-    _error_free(error->next);
+  self.error_messages= NULL;
+}
 
-    libmemcached_free(error->root, error);
-  }
+void memcached_error_free(memcached_instance_st& self)
+{
+  self.error_messages= NULL;
 }
 
-void memcached_error_free(Memcached& self)
+void memcached_error_free(memcached_server_st& self)
 {
-  _error_free(self.error_messages);
+  // Errors are only recorded on a memcached_instance_st.
   self.error_messages= NULL;
 }
 
-void memcached_error_free(memcached_instance_st& self)
+void memcached_error_destroy(Memcached& self)
 {
-  _error_free(self.error_messages);
   self.error_messages= NULL;
+  if (self.error_ring)
+  {
+    libmemcached_free(&self, _error_message_buffer(self));
+    self.error_ring= NULL;
+  }
 }
 
-void memcached_error_free(memcached_server_st& self)
+void memcached_error_destroy(memcached_instance_st& self)
 {
-  _error_free(self.error_messages);
   self.error_messages= NULL;
+  if (self.error_ring)
+  {
+    // The handle's cached message may be one of ours.
+    memcached_error_message_st *buffer= self.root ? _error_message_buffer(*self.root) : NULL;
+    if (buffer)
+    {
+      buffer->formatted= NULL;
+    }
+
+    libmemcached_free(self.root, self.error_ring);
+    self.error_ring= NULL;
+  }
 }
 
 const char *memcached_error(const memcached_st *memc)
@@ -547,12 +695,7 @@ const char *memcached_last_error_message(const memcached_st *shell)
   {
     if (memc->error_messages)
     {
-      if (memc->error_messages->size and memc->error_messages->message[0])
-      {
-        return memc->error_messages->message;
-      }
-
-      return memcached_strerror(memc, memc->error_messages->rc);
+      return _error_message(*memc, *memc->error_messages, _error_instance(*memc->error_messages));
     }
 
     return memcached_strerror(memc, MEMCACHED_SUCCESS);
@@ -622,29 +765,10 @@ const char *memcached_server_error(const memcached_instance_st * server)
     return memcached_strerror(server->root, MEMCACHED_SUCCESS);
   }
 
-  if (server->error_messages->size == 0)
-  {
-    return memcached_strerror(server->root, server->error_messages->rc);
-  }
-
-  return server->error_messages->message;
+  return _error_message(*server->root, *server->error_messages, server);
 }
 
 
-memcached_error_t *memcached_error_copy(const memcached_instance_st& server)
-{
-  if (server.error_messages == NULL)
-  {
-    return NULL;
-  }
-
-  memcached_error_t *error= libmemcached_xmalloc(server.root, memcached_error_t);
-  memcpy(error, server.error_messages, sizeof(memcached_error_t));
-  error->next= NULL;
-
-  return error;
-}
-
 memcached_return_t memcached_server_error_return(const memcached_instance_st * ptr)
 {
   if (ptr == NULL)
@@ -83,7 +83,9 @@ void memcached_error_free(memcached_server_st&);
 
 void memcached_error_free(memcached_instance_st& self);
 
-memcached_error_t *memcached_error_copy(const memcached_instance_st&);
+void memcached_error_destroy(Memcached&);
+
+void memcached_error_destroy(memcached_instance_st&);
 
 memcached_return_t memcached_instance_error_return(memcached_instance_st*);
 
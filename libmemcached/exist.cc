@@ -162,3 +162,104 @@ memcached_return_t memcached_exist_by_key(memcached_st *shell,
 
   return rc;
 }
+
+static memcached_return_t batch_exist_send(memcached_batch_st& batch,
+                                           memcached_instance_st* instance,
+                                           const size_t index)
+{
+  Memcached *memc= batch.root;
+  const char *key= batch.keys[index];
+  const size_t key_length= batch.key_length[index];
+
+  if (memcached_is_binary(memc))
+  {
+    /* A quiet GET only answers for keys that are there */
+    protocol_binary_request_get request= {};
+
+    initialize_binary_request(instance, request.message.header);
+
+    request.message.header.request.opcode= PROTOCOL_BINARY_CMD_GETQ;
+    request.message.header.request.opaque= htonl(uint32_t(index));
+    request.message.header.request.keylen= htons((uint16_t)(key_length + memcached_array_size(memc->_namespace)));
+    request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+    request.message.header.request.bodylen= htonl((uint32_t)(key_length + memcached_array_size(memc->_namespace)));
+
+    libmemcached_io_vector_st vector[]=
+    {
+      { NULL, 0 },
+      { request.bytes, sizeof(request.bytes) },
+      { memcached_array_string(memc->_namespace), memcached_array_size(memc->_namespace) },
+      { key, key_length }
+    };
+
+    return memcached_batch_write(batch, index, vector, 4, false);
+  }
+
+  libmemcached_io_vector_st vector[]=
+  {
+    { NULL, 0 },
+    { memcached_literal_param("get ") },
+    { memcached_array_string(memc->_namespace), memcached_array_size(memc->_namespace) },
+    { key, key_length },
+    { memcached_literal_param("\r\n") }
+  };
+
+  return memcached_batch_write(batch, index, vector, 5, true);
+}
+
+static memcached_return_t batch_exist_reply(memcached_batch_st&,
+                                            memcached_instance_st* instance,
+                                            const size_t)
+{
+  memcached_return_t rc= memcached_read_one_response(instance, NULL);
+
+  if (rc == MEMCACHED_END)
+  {
+    return MEMCACHED_NOTFOUND;
+  }
+
+  if (rc == MEMCACHED_SUCCESS)
+  {
+    /* VALUE was read, the END that follows it is still pending */
+    memcached_return_t end_rc= memcached_read_one_response(instance, NULL);
+    if (end_rc != MEMCACHED_END)
+    {
+      return memcached_fatal(end_rc) ? end_rc : MEMCACHED_PROTOCOL_ERROR;
+    }
+  }
+
+  return rc;
+}
+
+memcached_return_t memcached_exist_multi(memcached_st *memc,
+                                         const char * const *keys,
+                                         const size_t *key_length,
+                                         size_t number_of_keys,
+                                         memcached_return_t *results)
+{
+  return memcached_exist_multi_by_key(memc, NULL, 0, keys, key_length, number_of_keys, results);
+}
+
+memcached_return_t memcached_exist_multi_by_key(memcached_st *shell,
+                                                const char *group_key, size_t group_key_length,
+                                                const char * const *keys,
+                                                const size_t *key_length,
+                                                size_t number_of_keys,
+                                                memcached_return_t *results)
+{
+  Memcached* memc= memcached2Memcached(shell);
+
+  memcached_batch_st batch;
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_batch_init(batch, memc, group_key, group_key_length,
+                                                keys, key_length, number_of_keys, results)))
+  {
+    return rc;
+  }
+  batch.quiet= MEMCACHED_NOTFOUND;
+
+  rc= memcached_batch_execute(batch, batch_exist_send, batch_exist_reply);
+  memcached_batch_free(batch);
+
+  return rc;
+}
@@ -148,7 +148,7 @@ char *memcached_fetch(memcached_st *shell, char *key, size_t *key_length,
     *flags= result_buffer->item_flags;
   }
 
-  return memcached_string_take_value(&result_buffer->value);
+  return memcached_result_take_value(result_buffer);
 }
 
 memcached_result_st *memcached_fetch_result(memcached_st *ptr,
@@ -191,6 +191,11 @@ memcached_result_st *memcached_fetch_result(memcached_st *ptr,
     }
   }
 
+  if (ptr->hedge and ptr->hedge->is_armed)
+  {
+    memcached_hedge_fire(ptr);
+  }
+
   *error= MEMCACHED_MAXIMUM_RETURN; // We use this to see if we ever go into the loop
   memcached_instance_st *server;
   memcached_return_t read_ret= MEMCACHED_SUCCESS;
@@ -211,6 +216,11 @@ memcached_result_st *memcached_fetch_result(memcached_st *ptr,
     }
     else if (*error == MEMCACHED_SUCCESS)
     {
+      if (memcached_hedge_is_duplicate(*ptr, server, *result))
+      {
+        continue; // A hedged read already returned this key
+      }
+
       result->count++;
       return result;
     }
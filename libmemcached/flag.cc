@@ -107,6 +107,7 @@ void memcached_flag(memcached_st& memc, const memcached_flag_t flag, const bool
 
   case MEMCACHED_FLAG_HASH_WITH_NAMESPACE:
     memcached_set_hash_with_namespace(memc, arg);
+    memcached_route_install(&memc);
     break;
 
   case MEMCACHED_FLAG_NO_BLOCK:
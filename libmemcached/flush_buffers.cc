@@ -44,23 +44,20 @@ memcached_return_t memcached_flush_buffers(memcached_st *shell)
   {
     memcached_return_t ret= MEMCACHED_SUCCESS;
 
-    for (uint32_t x= 0; x < memcached_server_count(memc); ++x)
+    for (memcached_instance_st* instance= memc->dirty_instances, *next; instance; instance= next)
     {
-      memcached_instance_st* instance= memcached_instance_fetch(memc, x);
+      next= instance->dirty.next;
 
-      if (instance->write_buffer_offset != 0) 
+      if (instance->fd == INVALID_SOCKET and
+          (ret= memcached_connect(instance)) != MEMCACHED_SUCCESS)
       {
-        if (instance->fd == INVALID_SOCKET and
-            (ret= memcached_connect(instance)) != MEMCACHED_SUCCESS)
-        {
-          WATCHPOINT_ERROR(ret);
-          return ret;
-        }
+        WATCHPOINT_ERROR(ret);
+        return ret;
+      }
 
-        if (memcached_io_write(instance) == false)
-        {
-          ret= MEMCACHED_SOME_ERRORS;
-        }
+      if (memcached_io_write(instance) == false)
+      {
+        ret= MEMCACHED_SOME_ERRORS;
       }
     }
 
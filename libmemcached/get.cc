@@ -159,7 +159,7 @@ char *memcached_get_by_key(memcached_st *shell,
           *error= rc;
           *value_length= memcached_result_length(result_ptr);
           *flags= memcached_result_flags(result_ptr);
-          char *result_value=  memcached_string_take_value(&result_ptr->value);
+          char *result_value=  memcached_result_take_value(result_ptr);
           memcached_result_free(result_ptr);
 
           return result_value;
@@ -187,6 +187,8 @@ memcached_return_t memcached_mget(memcached_st *ptr,
 static memcached_return_t binary_mget_by_key(memcached_st *ptr,
                                              const uint32_t master_server_key,
                                              const bool is_group_key_set,
+                                             const char *group_key,
+                                             const size_t group_key_length,
                                              const char * const *keys,
                                              const size_t *key_length,
                                              const size_t number_of_keys,
@@ -243,29 +245,28 @@ static memcached_return_t __mget_by_key_real(memcached_st *ptr,
 
     It might be optimum to bounce the connection if count > some number.
   */
-  for (uint32_t x= 0; x < memcached_server_count(ptr); x++)
+  while (ptr->pending_instances)
   {
-    memcached_instance_st* instance= memcached_instance_fetch(ptr, x);
+    memcached_instance_st* instance= ptr->pending_instances;
+    char buffer[MEMCACHED_DEFAULT_COMMAND_SIZE];
 
-    if (instance->response_count())
+    if (ptr->flags.no_block)
     {
-      char buffer[MEMCACHED_DEFAULT_COMMAND_SIZE];
-
-      if (ptr->flags.no_block)
-      {
-        memcached_io_write(instance);
-      }
+      memcached_io_write(instance);
+    }
 
-      while(instance->response_count())
-      {
-        (void)memcached_response(instance, buffer, MEMCACHED_DEFAULT_COMMAND_SIZE, &ptr->result);
-      }
+    while(instance->response_count())
+    {
+      (void)memcached_response(instance, buffer, MEMCACHED_DEFAULT_COMMAND_SIZE, &ptr->result);
     }
   }
 
+  memcached_hedge_reset(*ptr);
+
   if (memcached_is_binary(ptr))
   {
-    return binary_mget_by_key(ptr, master_server_key, is_group_key_set, keys,
+    return binary_mget_by_key(ptr, master_server_key, is_group_key_set,
+                              group_key, group_key_length, keys,
                               key_length, number_of_keys, mget_mode);
   }
 
@@ -353,21 +354,18 @@ static memcached_return_t __mget_by_key_real(memcached_st *ptr,
     Should we muddle on if some servers are dead?
   */
   bool success_happened= false;
-  for (uint32_t x= 0; x < memcached_server_count(ptr); x++)
+  for (memcached_instance_st* instance= ptr->pending_instances, *next; instance; instance= next)
   {
-    memcached_instance_st* instance= memcached_instance_fetch(ptr, x);
+    next= instance->pending.next;
 
-    if (instance->response_count())
+    /* We need to do something about non-connnected hosts in the future */
+    if ((memcached_io_write(instance, "\r\n", 2, true)) == -1)
     {
-      /* We need to do something about non-connnected hosts in the future */
-      if ((memcached_io_write(instance, "\r\n", 2, true)) == -1)
-      {
-        failures_occured_in_sending= true;
-      }
-      else
-      {
-        success_happened= true;
-      }
+      failures_occured_in_sending= true;
+    }
+    else
+    {
+      success_happened= true;
     }
   }
 
@@ -561,20 +559,17 @@ static memcached_return_t simple_binary_mget(memcached_st *ptr,
     request.message.header.request.opcode= PROTOCOL_BINARY_CMD_NOOP;
     request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
 
-    for (uint32_t x= 0; x < memcached_server_count(ptr); ++x)
+    for (memcached_instance_st* instance= ptr->pending_instances, *next; instance; instance= next)
     {
-      memcached_instance_st* instance= memcached_instance_fetch(ptr, x);
+      next= instance->pending.next;
 
-      if (instance->response_count())
+      initialize_binary_request(instance, request.message.header);
+      if ((memcached_io_write(instance) == false) or
+          (memcached_io_write(instance, request.bytes, sizeof(request.bytes), true) == -1))
       {
-        initialize_binary_request(instance, request.message.header);
-        if ((memcached_io_write(instance) == false) or
-            (memcached_io_write(instance, request.bytes, sizeof(request.bytes), true) == -1))
-        {
-          memcached_instance_response_reset(instance);
-          memcached_io_reset(instance);
-          rc= MEMCACHED_SOME_ERRORS;
-        }
+        memcached_instance_response_reset(instance);
+        memcached_io_reset(instance);
+        rc= MEMCACHED_SOME_ERRORS;
       }
     }
   }
@@ -582,9 +577,95 @@ static memcached_return_t simple_binary_mget(memcached_st *ptr,
   return rc;
 }
 
+static bool replication_binary_send(memcached_st *ptr,
+                                    memcached_instance_st* instance,
+                                    const char *key,
+                                    const size_t key_length)
+{
+  protocol_binary_request_getk request= {};
+  initialize_binary_request(instance, request.message.header);
+  request.message.header.request.opcode= PROTOCOL_BINARY_CMD_GETK;
+  request.message.header.request.keylen= htons((uint16_t)(key_length + memcached_array_size(ptr->_namespace)));
+  request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+  request.message.header.request.bodylen= htonl((uint32_t)(key_length + memcached_array_size(ptr->_namespace)));
+
+  /*
+   * We need to disable buffering to actually know that the request was
+   * successfully sent to the server (so that we should expect a result
+   * back). It would be nice to do this in buffered mode, but then it
+   * would be complex to handle all error situations if we got to send
+   * some of the messages, and then we failed on writing out some others
+   * and we used the callback interface from memcached_mget_execute so
+   * that we might have processed some of the responses etc. For now,
+   * just make sure we work _correctly_
+ */
+  libmemcached_io_vector_st vector[]=
+  {
+    { request.bytes, sizeof(request.bytes) },
+    { memcached_array_string(ptr->_namespace), memcached_array_size(ptr->_namespace) },
+    { key, key_length }
+  };
+
+  if (memcached_io_writev(instance, vector, 3, true) == false)
+  {
+    memcached_io_reset(instance);
+    return false;
+  }
+
+  memcached_server_response_increment(instance);
+
+  return true;
+}
+
+/*
+  Power of two choices, pick two of the replicas at random and read from the
+  one with fewer requests in flight. Ties go to the lower median latency.
+*/
+static uint32_t replication_least_loaded(memcached_st *ptr,
+                                         const char *key,
+                                         const size_t key_length,
+                                         const uint32_t home,
+                                         const bool* dead_servers)
+{
+  const uint32_t replicas= ptr->number_of_replicas +1;
+  uint32_t first_offset= uint32_t(random()) % replicas;
+  uint32_t second_offset= (first_offset +1 +uint32_t(random()) % ptr->number_of_replicas) % replicas;
+
+  uint32_t first= memcached_generate_replica(ptr, key, key_length, home, first_offset);
+  uint32_t second= memcached_generate_replica(ptr, key, key_length, home, second_offset);
+
+  if (dead_servers[first])
+  {
+    return second;
+  }
+
+  if (dead_servers[second])
+  {
+    return first;
+  }
+
+  memcached_instance_st* first_instance= memcached_instance_fetch(ptr, first);
+  memcached_instance_st* second_instance= memcached_instance_fetch(ptr, second);
+
+  if (first_instance->response_count() != second_instance->response_count())
+  {
+    return first_instance->response_count() < second_instance->response_count() ? first : second;
+  }
+
+  if (memcached_latency_percentile(second_instance->latency, 50) < memcached_latency_percentile(first_instance->latency, 50))
+  {
+    return second;
+  }
+
+  return first;
+}
+
 static memcached_return_t replication_binary_mget(memcached_st *ptr,
                                                   uint32_t* hash,
+                                                  uint32_t* sent_to,
                                                   bool* dead_servers,
+                                                  const char *group_key,
+                                                  const size_t group_key_length,
                                                   const char *const *keys,
                                                   const size_t *key_length,
                                                   const size_t number_of_keys)
@@ -592,6 +673,7 @@ static memcached_return_t replication_binary_mget(memcached_st *ptr,
   memcached_return_t rc= MEMCACHED_NOTFOUND;
   uint32_t start= 0;
   uint64_t randomize_read= memcached_behavior_get(ptr, MEMCACHED_BEHAVIOR_RANDOMIZE_REPLICA_READ);
+  bool least_loaded= ptr->flags.replica_read_least_loaded;
 
   if (randomize_read)
   {
@@ -610,17 +692,26 @@ static memcached_return_t replication_binary_mget(memcached_st *ptr,
         continue; /* Already successfully sent */
       }
 
-      uint32_t server= hash[x] +replica;
+      const char *hash_key= group_key ? group_key : keys[x];
+      size_t hash_key_length= group_key ? group_key_length : key_length[x];
+      uint32_t server;
 
+      if (least_loaded and replica == 0)
+      {
+        server= replication_least_loaded(ptr, hash_key, hash_key_length, hash[x], dead_servers);
+      }
+      else if (ptr->bounded_load.epsilon and replica == 0)
+      {
+        server= memcached_bounded_load_route(ptr, hash_key, hash_key_length, hash[x]);
+      }
       /* In case of randomized reads */
-      if (randomize_read and ((server + start) <= (hash[x] + ptr->number_of_replicas)))
+      else if (randomize_read and (replica + start) <= ptr->number_of_replicas)
       {
-        server+= start;
+        server= memcached_generate_replica(ptr, hash_key, hash_key_length, hash[x], replica + start);
       }
-
-      while (server >= memcached_server_count(ptr))
+      else
       {
-        server -= memcached_server_count(ptr);
+        server= memcached_generate_replica(ptr, hash_key, hash_key_length, hash[x], replica);
       }
 
       if (dead_servers[server])
@@ -643,39 +734,17 @@ static memcached_return_t replication_binary_mget(memcached_st *ptr,
         }
       }
 
-      protocol_binary_request_getk request= {};
-      initialize_binary_request(instance, request.message.header);
-      request.message.header.request.opcode= PROTOCOL_BINARY_CMD_GETK;
-      request.message.header.request.keylen= htons((uint16_t)(key_length[x] + memcached_array_size(ptr->_namespace)));
-      request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
-      request.message.header.request.bodylen= htonl((uint32_t)(key_length[x] + memcached_array_size(ptr->_namespace)));
-
-      /*
-       * We need to disable buffering to actually know that the request was
-       * successfully sent to the server (so that we should expect a result
-       * back). It would be nice to do this in buffered mode, but then it
-       * would be complex to handle all error situations if we got to send
-       * some of the messages, and then we failed on writing out some others
-       * and we used the callback interface from memcached_mget_execute so
-       * that we might have processed some of the responses etc. For now,
-       * just make sure we work _correctly_
-     */
-      libmemcached_io_vector_st vector[]=
-      {
-        { request.bytes, sizeof(request.bytes) },
-        { memcached_array_string(ptr->_namespace), memcached_array_size(ptr->_namespace) },
-        { keys[x], key_length[x] }
-      };
-
-      if (memcached_io_writev(instance, vector, 3, true) == false)
+      if (replication_binary_send(ptr, instance, keys[x], key_length[x]) == false)
       {
-        memcached_io_reset(instance);
         dead_servers[server]= true;
         success= false;
         continue;
       }
 
-      memcached_server_response_increment(instance);
+      if (sent_to)
+      {
+        sent_to[x]= server;
+      }
       hash[x]= memcached_server_count(ptr);
     }
 
@@ -688,9 +757,182 @@ static memcached_return_t replication_binary_mget(memcached_st *ptr,
   return rc;
 }
 
+/*
+  Called by the first fetch after a hedged mget, so mget itself never
+  waits. Wait for the servers we read from for the hedge percentile of
+  their own latency, bounded by the poll timeout. Any key whose server has
+  not become readable by then is sent to the next live replica, whichever
+  answers first is returned by fetch. The wait has the millisecond
+  resolution of poll().
+*/
+void memcached_hedge_fire(Memcached *ptr)
+{
+  memcached_hedge_st* hedge= ptr->hedge;
+  hedge->is_armed= false;
+
+  const uint32_t server_count= memcached_server_count(ptr);
+  uint64_t* deadline= libmemcached_xcalloc(ptr, server_count, uint64_t);
+  struct pollfd* fds= libmemcached_xcalloc(ptr, server_count, struct pollfd);
+  uint32_t* fd_server= libmemcached_xcalloc(ptr, server_count, uint32_t);
+  bool* slow= libmemcached_xcalloc(ptr, server_count, bool);
+  bool* dead_servers= libmemcached_xcalloc(ptr, server_count, bool);
+
+  if (deadline == NULL or fds == NULL or fd_server == NULL or slow == NULL or dead_servers == NULL)
+  {
+    libmemcached_free(ptr, deadline);
+    libmemcached_free(ptr, fds);
+    libmemcached_free(ptr, fd_server);
+    libmemcached_free(ptr, slow);
+    libmemcached_free(ptr, dead_servers);
+    return;
+  }
+
+  const uint64_t started= hedge->started;
+  const uint64_t longest= uint64_t(ptr->poll_timeout > 0 ? ptr->poll_timeout : 1) * 1000;
+  for (uint32_t slot= 0; slot < hedge->size; ++slot)
+  {
+    const memcached_hedge_key_st& entry= hedge->keys[slot];
+    if (entry.used == false or entry.sent_to >= server_count or deadline[entry.sent_to])
+    {
+      continue;
+    }
+
+    // Until we know the server, wait as long as a read would and learn from it.
+    memcached_instance_st* instance= memcached_instance_fetch(ptr, entry.sent_to);
+    uint64_t wait= longest;
+    if (memcached_latency_ready(instance->latency))
+    {
+      uint64_t percentile= memcached_latency_percentile(instance->latency, ptr->hedge_read_percentile);
+      wait= percentile < longest ? percentile : longest;
+    }
+    deadline[entry.sent_to]= started +wait;
+  }
+
+  while (true)
+  {
+    uint64_t now= memcached_latency_now();
+    uint64_t next_deadline= UINT64_MAX;
+    nfds_t nfds= 0;
+
+    for (uint32_t server= 0; server < server_count; ++server)
+    {
+      if (deadline[server] == 0)
+      {
+        continue;
+      }
+
+      // Censored: we only know the server took longer, which is not a sample.
+      memcached_instance_st* instance= memcached_instance_fetch(ptr, server);
+      if (now >= deadline[server] or instance->fd == INVALID_SOCKET)
+      {
+        deadline[server]= 0;
+        slow[server]= true;
+        continue;
+      }
+
+      if (deadline[server] < next_deadline)
+      {
+        next_deadline= deadline[server];
+      }
+
+      fds[nfds].fd= instance->fd;
+      fds[nfds].events= POLLIN;
+      fds[nfds].revents= 0;
+      fd_server[nfds]= server;
+      nfds++;
+    }
+
+    if (nfds == 0)
+    {
+      break;
+    }
+
+    int timeout= int((next_deadline -now +999) / 1000);
+    int active= poll(fds, nfds, timeout);
+    if (active == -1 and get_socket_errno() != EINTR)
+    {
+      break;
+    }
+
+    now= memcached_latency_now();
+    for (nfds_t x= 0; active > 0 and x < nfds; ++x)
+    {
+      if (fds[x].revents == 0)
+      {
+        continue;
+      }
+
+      uint32_t server= fd_server[x];
+      if (fds[x].revents & POLLIN)
+      {
+        memcached_latency_record(memcached_instance_fetch(ptr, server)->latency, now -started);
+      }
+      else
+      {
+        slow[server]= true;
+      }
+      deadline[server]= 0;
+    }
+  }
+
+  for (uint32_t slot= 0; slot < hedge->size; ++slot)
+  {
+    memcached_hedge_key_st& entry= hedge->keys[slot];
+    if (entry.used == false or entry.sent_to >= server_count or slow[entry.sent_to] == false)
+    {
+      continue;
+    }
+
+    const char *hash_key= hedge->group_key_length ? hedge->group_key : entry.key;
+    size_t hash_key_length= hedge->group_key_length ? hedge->group_key_length : entry.key_length;
+
+    uint32_t offset= 0;
+    while (offset < ptr->number_of_replicas and
+           memcached_generate_replica(ptr, hash_key, hash_key_length, entry.home, offset) != entry.sent_to)
+    {
+      offset++;
+    }
+
+    for (uint32_t replica= 1; replica <= ptr->number_of_replicas; ++replica)
+    {
+      uint32_t server= memcached_generate_replica(ptr, hash_key, hash_key_length, entry.home,
+                                                  (offset +replica) % (ptr->number_of_replicas +1));
+      if (server == entry.sent_to or dead_servers[server] or slow[server])
+      {
+        continue;
+      }
+
+      memcached_instance_st* instance= memcached_instance_fetch(ptr, server);
+      if (instance->response_count() == 0 and memcached_failed(memcached_connect(instance)))
+      {
+        memcached_io_reset(instance);
+        dead_servers[server]= true;
+        continue;
+      }
+
+      if (replication_binary_send(ptr, instance, entry.key, entry.key_length) == false)
+      {
+        dead_servers[server]= true;
+        continue;
+      }
+
+      entry.hedged_to= server;
+      break;
+    }
+  }
+
+  libmemcached_free(ptr, deadline);
+  libmemcached_free(ptr, fds);
+  libmemcached_free(ptr, fd_server);
+  libmemcached_free(ptr, slow);
+  libmemcached_free(ptr, dead_servers);
+}
+
 static memcached_return_t binary_mget_by_key(memcached_st *ptr,
                                              const uint32_t master_server_key,
                                              bool is_group_key_set,
+                                             const char *group_key,
+                                             const size_t group_key_length,
                                              const char * const *keys,
                                              const size_t *key_length,
                                              const size_t number_of_keys,
@@ -727,10 +969,57 @@ static memcached_return_t binary_mget_by_key(memcached_st *ptr,
     }
   }
 
-  memcached_return_t rc= replication_binary_mget(ptr, hash, dead_servers, keys,
+  // Hedging needs to remember where each key lives and where it was sent.
+  uint32_t* home= NULL;
+  uint32_t* sent_to= NULL;
+  uint64_t started= 0;
+  if (ptr->hedge_read_percentile)
+  {
+    if ((home= libmemcached_xvalloc(ptr, number_of_keys * 2, uint32_t)))
+    {
+      sent_to= home +number_of_keys;
+      for (size_t x= 0; x < number_of_keys; x++)
+      {
+        home[x]= hash[x];
+        sent_to[x]= UINT32_MAX;
+      }
+      started= memcached_latency_now();
+    }
+  }
+
+  if (is_group_key_set == false)
+  {
+    group_key= NULL;
+  }
+
+  memcached_return_t rc= replication_binary_mget(ptr, hash, sent_to, dead_servers,
+                                                 group_key, group_key_length, keys,
                                                  key_length, number_of_keys);
 
+  if (sent_to)
+  {
+    // Remember where each key went, the first fetch decides what to hedge.
+    bool remembered= true;
+    for (size_t x= 0; remembered and x < number_of_keys; x++)
+    {
+      if (sent_to[x] != UINT32_MAX)
+      {
+        remembered= memcached_success(memcached_hedge_add(*ptr, keys[x], key_length[x], home[x], sent_to[x]));
+      }
+    }
+
+    if (remembered)
+    {
+      memcached_hedge_arm(*ptr, group_key, group_key_length, started);
+    }
+    else
+    {
+      memcached_hedge_reset(*ptr);
+    }
+  }
+
   WATCHPOINT_IFERROR(rc);
+  libmemcached_free(ptr, home);
   libmemcached_free(ptr, hash);
   libmemcached_free(ptr, dead_servers);
 
@@ -38,11 +38,11 @@
 
 #include <libmemcached/common.h>
 
-#ifdef HAVE_SYS_TIME_H
-# include <sys/time.h>
-#endif
-
 #include <libmemcached/virtual_bucket.h>
+#include <libhashkit/algorithm.h>
+
+/* Reads per server between halvings of the bounded load counters */
+#define MEMCACHED_BOUNDED_LOAD_WINDOW 64
 
 uint32_t memcached_generate_hash_value(const char *key, size_t key_length, memcached_hash_t hash_algorithm)
 {
@@ -54,7 +54,28 @@ static inline uint32_t generate_hash(const Memcached *ptr, const char *key, size
   return hashkit_digest(&ptr->hashkit, key, key_length);
 }
 
-static uint32_t dispatch_host(const Memcached *ptr, uint32_t hash)
+/*
+  Lamping and Veach, "A Fast, Minimal Memory, Consistent Hash Algorithm".
+  Growing the bucket count from n to n+1 moves only 1/(n+1) of the keys,
+  all of them onto the new bucket.
+*/
+static inline uint32_t jump_consistent_hash(uint32_t hash, uint32_t buckets)
+{
+  uint64_t key= hash;
+  int64_t bucket= -1;
+  int64_t jump= 0;
+
+  while (jump < int64_t(buckets))
+  {
+    bucket= jump;
+    key= key * 2862933555777941757ULL + 1;
+    jump= int64_t(double(bucket + 1) * (double(1LL << 31) / double((key >> 33) + 1)));
+  }
+
+  return uint32_t(bucket);
+}
+
+static uint32_t dispatch_host(const Memcached *ptr, uint32_t hash, uint32_t low)
 {
   switch (ptr->distribution)
   {
@@ -63,24 +84,15 @@ static uint32_t dispatch_host(const Memcached *ptr, uint32_t hash)
   case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA:
   case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY:
     {
-      uint32_t num= ptr->ketama.continuum_points_counter;
-      WATCHPOINT_ASSERT(ptr->ketama.continuum);
-
-      memcached_continuum_item_st *begin, *end, *left, *right, *middle;
-      begin= left= ptr->ketama.continuum;
-      end= right= ptr->ketama.continuum + num;
-
-      while (left < right)
+      // The lookup table is the continuum, it is only missing when no
+      // server is live.
+      WATCHPOINT_ASSERT(ptr->ketama.lookup);
+      if (ptr->ketama.lookup == NULL)
       {
-        middle= left + (right - left) / 2;
-        if (middle->value < hash)
-          left= middle + 1;
-        else
-          right= middle;
+        return 0;
       }
-      if (right == end)
-        right= begin;
-      return right->index;
+
+      return memcached_continuum_lookup(ptr->ketama.lookup, hash, low);
     }
   case MEMCACHED_DISTRIBUTION_MODULA:
     return hash % memcached_server_count(ptr);
@@ -90,6 +102,21 @@ static uint32_t dispatch_host(const Memcached *ptr, uint32_t hash)
     {
       return memcached_virtual_bucket_get(ptr, hash);
     }
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP:
+    return jump_consistent_hash(hash, memcached_server_count(ptr));
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON:
+    if (ptr->rendezvous)
+    {
+      return memcached_rendezvous_rank(ptr->rendezvous, hash, 0);
+    }
+    return hash % memcached_server_count(ptr);
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV:
+    if (ptr->maglev)
+    {
+      return memcached_maglev_lookup(ptr->maglev, hash);
+    }
+    return hash % memcached_server_count(ptr);
   default:
   case MEMCACHED_DISTRIBUTION_CONSISTENT_MAX:
     WATCHPOINT_ASSERT(0); /* We have added a distribution without extending the logic */
@@ -98,13 +125,24 @@ static uint32_t dispatch_host(const Memcached *ptr, uint32_t hash)
   /* NOTREACHED */
 }
 
+static inline uint32_t generate_low_hash(const Memcached *ptr, const char *key, size_t key_length)
+{
+  if (memcached_is_64bit_ketama(ptr))
+  {
+    return memcached_continuum_low_hash(key, key_length, 0);
+  }
+
+  return 0;
+}
+
 /*
   One version is public and will not modify the distribution hash, the other will.
 */
-static inline uint32_t _generate_hash_wrapper(const Memcached *ptr, const char *key, size_t key_length)
+static inline uint32_t _generate_hash_wrapper(const Memcached *ptr, const char *key, size_t key_length, uint32_t& low)
 {
   WATCHPOINT_ASSERT(memcached_server_count(ptr));
 
+  low= 0;
   if (memcached_server_count(ptr) == 1)
     return 0;
 
@@ -116,13 +154,20 @@ static inline uint32_t _generate_hash_wrapper(const Memcached *ptr, const char *
     if (temp_length > MEMCACHED_MAX_KEY -1)
       return 0;
 
+    if (ptr->namespace_hash and memcached_is_64bit_ketama(ptr) == false)
+    {
+      return hashkit_stream_digest(ptr->namespace_hash, key, key_length);
+    }
+
     strncpy(temp, memcached_array_string(ptr->_namespace), memcached_array_size(ptr->_namespace));
     strncpy(temp + memcached_array_size(ptr->_namespace), key, key_length);
 
+    low= generate_low_hash(ptr, temp, temp_length);
     return generate_hash(ptr, temp, temp_length);
   }
   else
   {
+    low= generate_low_hash(ptr, key, key_length);
     return generate_hash(ptr, key, key_length);
   }
 }
@@ -131,10 +176,7 @@ static inline void _regen_for_auto_eject(Memcached *ptr)
 {
   if (_is_auto_eject_host(ptr) && ptr->ketama.next_distribution_rebuild)
   {
-    struct timeval now;
-
-    if (gettimeofday(&now, NULL) == 0 and
-        now.tv_sec > ptr->ketama.next_distribution_rebuild)
+    if (memcached_clock_now() > ptr->ketama.next_distribution_rebuild)
     {
       run_distribution(ptr);
     }
@@ -146,13 +188,267 @@ void memcached_autoeject(memcached_st *ptr)
   _regen_for_auto_eject(ptr);
 }
 
-uint32_t memcached_generate_hash_with_redistribution(memcached_st *ptr, const char *key, size_t key_length)
+static uint32_t route_generic(const Memcached *ptr, const char *key, size_t key_length)
+{
+  uint32_t low;
+  uint32_t hash= _generate_hash_wrapper(ptr, key, key_length, low);
+  return dispatch_host(ptr, hash, low);
+}
+
+enum route_distribution_t {
+  ROUTE_KETAMA,
+  ROUTE_MODULA,
+  ROUTE_JUMP,
+  ROUTE_MAGLEV,
+  ROUTE_MAX
+};
+
+/*
+  One instantiation per built-in hash and distribution, so the hash is a
+  direct call and the distribution needs no switch.  Only used when neither
+  the namespace nor a 64 bit continuum takes part in the hash.
+*/
+template <hashkit_hash_fn HASH, route_distribution_t DISTRIBUTION>
+static uint32_t route(const Memcached *ptr, const char *key, size_t key_length)
+{
+  uint32_t count= memcached_server_count(ptr);
+  if (count == 1)
+  {
+    return 0;
+  }
+
+  uint32_t hash= HASH(key, key_length, NULL);
+
+  if (DISTRIBUTION == ROUTE_KETAMA)
+  {
+    if (ptr->ketama.lookup)
+    {
+      return memcached_continuum_lookup(ptr->ketama.lookup, hash, 0);
+    }
+    return dispatch_host(ptr, hash, 0);
+  }
+
+  if (DISTRIBUTION == ROUTE_JUMP)
+  {
+    return jump_consistent_hash(hash, count);
+  }
+
+  if (DISTRIBUTION == ROUTE_MAGLEV and ptr->maglev)
+  {
+    return memcached_maglev_lookup(ptr->maglev, hash);
+  }
+
+  return hash % count;
+}
+
+#define MEMCACHED_ROUTES(__hash) { __hash, { route<__hash, ROUTE_KETAMA>, route<__hash, ROUTE_MODULA>, \
+                                             route<__hash, ROUTE_JUMP>, route<__hash, ROUTE_MAGLEV> } }
+
+static const struct {
+  hashkit_hash_fn function;
+  memcached_route_fn routes[ROUTE_MAX];
+} route_table[]= {
+  MEMCACHED_ROUTES(hashkit_one_at_a_time),
+  MEMCACHED_ROUTES(hashkit_md5),
+  MEMCACHED_ROUTES(hashkit_crc32),
+  MEMCACHED_ROUTES(hashkit_fnv1_64),
+  MEMCACHED_ROUTES(hashkit_fnv1a_64),
+  MEMCACHED_ROUTES(hashkit_fnv1_32),
+  MEMCACHED_ROUTES(hashkit_fnv1a_32),
+  MEMCACHED_ROUTES(hashkit_hsieh),
+  MEMCACHED_ROUTES(hashkit_murmur),
+  MEMCACHED_ROUTES(hashkit_murmur3),
+  MEMCACHED_ROUTES(hashkit_jenkins),
+  MEMCACHED_ROUTES(hashkit_xxh3),
+  MEMCACHED_ROUTES(hashkit_crc32c),
+};
+
+/*
+  Hash state of the namespace alone, so that each key only has to feed its
+  own bytes through the hash.  Left NULL when the hash cannot be streamed,
+  in which case the namespace and key are hashed together as before.
+*/
+static void namespace_hash_install(Memcached *ptr)
+{
+  hashkit_hash_algorithm_t algorithm= hashkit_get_function(&ptr->hashkit);
+
+  if (ptr->flags.hash_with_namespace and memcached_array_size(ptr->_namespace) and algorithm != HASHKIT_HASH_CUSTOM)
+  {
+    if (ptr->namespace_hash == NULL)
+    {
+      ptr->namespace_hash= libmemcached_xmalloc(ptr, hashkit_stream_st);
+    }
+
+    if (ptr->namespace_hash and
+        hashkit_success(hashkit_stream_init(ptr->namespace_hash, algorithm)) and
+        hashkit_success(hashkit_stream_update(ptr->namespace_hash,
+                                              memcached_array_string(ptr->_namespace),
+                                              memcached_array_size(ptr->_namespace))))
+    {
+      return;
+    }
+  }
+
+  if (ptr->namespace_hash)
+  {
+    libmemcached_free(ptr, ptr->namespace_hash);
+    ptr->namespace_hash= NULL;
+  }
+}
+
+void memcached_route_install(Memcached *ptr)
 {
-  uint32_t hash= _generate_hash_wrapper(ptr, key, key_length);
+  ptr->route= route_generic;
+  namespace_hash_install(ptr);
 
+  if (ptr->flags.hash_with_namespace or memcached_is_64bit_ketama(ptr))
+  {
+    return;
+  }
+
+  route_distribution_t distribution;
+  switch (ptr->distribution)
+  {
+  case MEMCACHED_DISTRIBUTION_CONSISTENT:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_WEIGHTED:
+    distribution= ROUTE_KETAMA;
+    break;
+
+  case MEMCACHED_DISTRIBUTION_MODULA:
+    distribution= ROUTE_MODULA;
+    break;
+
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP:
+    distribution= ROUTE_JUMP;
+    break;
+
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV:
+    distribution= ROUTE_MAGLEV;
+    break;
+
+  case MEMCACHED_DISTRIBUTION_RANDOM:
+  case MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAX:
+  default:
+    return;
+  }
+
+  for (size_t x= 0; x < sizeof(route_table) / sizeof(route_table[0]); x++)
+  {
+    if (route_table[x].function == ptr->hashkit.base_hash.function)
+    {
+      ptr->route= route_table[x].routes[distribution];
+      return;
+    }
+  }
+}
+
+uint32_t memcached_generate_hash_with_redistribution(memcached_st *ptr, const char *key, size_t key_length)
+{
   _regen_for_auto_eject(ptr);
 
-  return dispatch_host(ptr, hash);
+  return ptr->route(ptr, key, key_length);
+}
+
+/*
+  Mirrokni, Thorup and Zadimoghaddam, "Consistent Hashing with Bounded
+  Loads".  No server takes more than ceil((1 + epsilon) * average) of the
+  recent reads.  A key whose home is full moves along its own replica chain,
+  the servers memcached_generate_replica() writes its copies to, so a
+  spilled read always lands where the value was stored.
+*/
+static uint32_t bounded_load_capacity(const Memcached *ptr)
+{
+  uint64_t servers= memcached_server_count(ptr);
+  uint64_t scaled= (100 +uint64_t(ptr->bounded_load.epsilon)) * (uint64_t(ptr->bounded_load.total) +1);
+
+  return uint32_t((scaled +100 * servers -1) / (100 * servers));
+}
+
+static uint32_t bounded_load_spill(Memcached *ptr, const char *key, size_t key_length,
+                                   uint32_t home, uint32_t capacity)
+{
+  uint32_t replicas= ptr->number_of_replicas;
+  if (replicas >= memcached_server_count(ptr))
+  {
+    replicas= memcached_server_count(ptr) -1;
+  }
+
+  for (uint32_t replica= 1; replica <= replicas; ++replica)
+  {
+    uint32_t server_key= memcached_generate_replica(ptr, key, key_length, home, replica);
+    if (memcached_instance_by_position(ptr, server_key)->read_load < capacity)
+    {
+      return server_key;
+    }
+  }
+
+  return home;
+}
+
+static void bounded_load_account(Memcached *ptr, uint32_t server_key)
+{
+  uint32_t count= memcached_server_count(ptr);
+
+  memcached_instance_by_position(ptr, server_key)->read_load++;
+  ptr->bounded_load.total++;
+
+  /* Decay the counters so the bound follows recent traffic */
+  if (ptr->bounded_load.total >= MEMCACHED_BOUNDED_LOAD_WINDOW * count)
+  {
+    ptr->bounded_load.total= 0;
+    for (uint32_t x= 0; x < count; ++x)
+    {
+      memcached_instance_st* instance= memcached_instance_by_position(ptr, x);
+      instance->read_load/= 2;
+      ptr->bounded_load.total+= instance->read_load;
+    }
+  }
+}
+
+uint32_t memcached_bounded_load_route(Memcached *ptr, const char *key, size_t key_length, uint32_t home)
+{
+  if (ptr->bounded_load.epsilon == 0 or memcached_server_count(ptr) < 2)
+  {
+    return home;
+  }
+
+  uint32_t server_key= home;
+  uint32_t capacity= bounded_load_capacity(ptr);
+  if (memcached_instance_by_position(ptr, home)->read_load >= capacity)
+  {
+    server_key= bounded_load_spill(ptr, key, key_length, home, capacity);
+  }
+
+  bounded_load_account(ptr, server_key);
+
+  return server_key;
+}
+
+uint32_t memcached_generate_hash_for_read(memcached_st *ptr, const char *key, size_t key_length)
+{
+  uint32_t home= memcached_generate_hash_with_redistribution(ptr, key, key_length);
+
+  return memcached_bounded_load_route(ptr, key, key_length, home);
+}
+
+uint32_t memcached_generate_replica(const memcached_st *ptr, const char *key, size_t key_length,
+                                    uint32_t server_key, uint32_t replica)
+{
+  if (replica and ptr->rendezvous and
+      (ptr->distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS or
+       ptr->distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON))
+  {
+    uint32_t low;
+    uint32_t hash= _generate_hash_wrapper(ptr, key, key_length, low);
+    return memcached_rendezvous_rank(ptr->rendezvous, hash, replica);
+  }
+
+  return (server_key +replica) % memcached_server_count(ptr);
 }
 
 uint32_t memcached_generate_hash(const memcached_st *shell, const char *key, size_t key_length)
@@ -160,7 +456,7 @@ uint32_t memcached_generate_hash(const memcached_st *shell, const char *key, siz
   const Memcached* ptr= memcached2Memcached(shell);
   if (ptr)
   {
-    return dispatch_host(ptr, _generate_hash_wrapper(ptr, key, key_length));
+    return ptr->route(ptr, key, key_length);
   }
 
   return UINT32_MAX;
@@ -184,6 +480,7 @@ memcached_return_t memcached_set_hashkit(memcached_st *shell, hashkit_st *hashk)
   {
     hashkit_free(&self->hashkit);
     hashkit_clone(&self->hashkit, hashk);
+    memcached_route_install(self);
 
     return MEMCACHED_SUCCESS;
   }
@@ -37,4 +37,33 @@
 
 #pragma once
 
+typedef uint32_t (*memcached_route_fn)(const memcached_st *, const char *, size_t);
+
+/*
+  Picks the routine that maps keys to servers for the current hash,
+  distribution and namespace settings.  Call after changing any of them.
+*/
+void memcached_route_install(memcached_st *ptr);
+
 uint32_t memcached_generate_hash_with_redistribution(memcached_st *ptr, const char *key, size_t key_length);
+
+/*
+  Server to read key from.  Same as the above unless
+  MEMCACHED_BEHAVIOR_BOUNDED_LOAD is set and the home server has taken more
+  than its share of recent reads, in which case the read moves on to the
+  first replica of the key with room, within number_of_replicas.
+*/
+uint32_t memcached_generate_hash_for_read(memcached_st *ptr, const char *key, size_t key_length);
+
+/*
+  As above for a key whose home server is already known, key being what
+  the replicas are hashed on (the group key, when there is one).
+*/
+uint32_t memcached_bounded_load_route(Memcached *ptr, const char *key, size_t key_length, uint32_t home);
+
+/*
+  Server holding the given replica of a key whose master is server_key,
+  replica 0 being the master itself.
+*/
+uint32_t memcached_generate_replica(const memcached_st *ptr, const char *key, size_t key_length,
+                                    uint32_t server_key, uint32_t replica);
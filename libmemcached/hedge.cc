@@ -0,0 +1,224 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+static inline uint32_t hedge_key_hash(const char *key, size_t key_length)
+{
+  uint32_t hash= 2166136261UL;
+  for (size_t x= 0; x < key_length; x++)
+  {
+    hash^= uint8_t(key[x]);
+    hash*= 16777619;
+  }
+
+  return hash;
+}
+
+static inline uint32_t hedge_slot(const memcached_hedge_st& hedge, uint32_t hash)
+{
+  return hash & (hedge.size -1);
+}
+
+static bool hedge_grow(Memcached& memc, memcached_hedge_st& hedge)
+{
+  uint32_t new_size= hedge.size ? hedge.size * 2 : 16;
+  memcached_hedge_key_st *new_keys= libmemcached_xcalloc(&memc, new_size, memcached_hedge_key_st);
+  if (new_keys == NULL)
+  {
+    return false;
+  }
+
+  memcached_hedge_key_st *old_keys= hedge.keys;
+  uint32_t old_size= hedge.size;
+  hedge.keys= new_keys;
+  hedge.size= new_size;
+
+  for (uint32_t x= 0; x < old_size; x++)
+  {
+    if (old_keys[x].used)
+    {
+      uint32_t slot= hedge_slot(hedge, old_keys[x].hash);
+      while (new_keys[slot].used)
+      {
+        slot= hedge_slot(hedge, slot +1);
+      }
+      new_keys[slot]= old_keys[x];
+    }
+  }
+  libmemcached_free(&memc, old_keys);
+
+  return true;
+}
+
+memcached_return_t memcached_hedge_add(Memcached& memc, const char *key, size_t key_length,
+                                       uint32_t home, uint32_t sent_to)
+{
+  if (key_length > MEMCACHED_MAX_KEY)
+  {
+    return memcached_set_error(memc, MEMCACHED_BAD_KEY_PROVIDED, MEMCACHED_AT);
+  }
+
+  if (memc.hedge == NULL)
+  {
+    memc.hedge= libmemcached_xcalloc(&memc, 1, memcached_hedge_st);
+    if (memc.hedge == NULL)
+    {
+      return memcached_set_error(memc, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+  }
+
+  memcached_hedge_st& hedge= *memc.hedge;
+  if ((hedge.count +1) * 2 > hedge.size and hedge_grow(memc, hedge) == false)
+  {
+    return memcached_set_error(memc, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+
+  // The same key asked for twice from one server is answered twice, by that server.
+  if (memcached_hedge_find(memc, key, key_length, sent_to))
+  {
+    return MEMCACHED_SUCCESS;
+  }
+
+  uint32_t hash= hedge_key_hash(key, key_length);
+  uint32_t slot= hedge_slot(hedge, hash);
+  while (hedge.keys[slot].used)
+  {
+    slot= hedge_slot(hedge, slot +1);
+  }
+
+  memcached_hedge_key_st& entry= hedge.keys[slot];
+  entry.hash= hash;
+  entry.home= home;
+  entry.sent_to= sent_to;
+  entry.hedged_to= UINT32_MAX;
+  entry.used= true;
+  entry.served= false;
+  entry.key_length= key_length;
+  memcpy(entry.key, key, key_length);
+  hedge.count++;
+
+  return MEMCACHED_SUCCESS;
+}
+
+void memcached_hedge_arm(Memcached& memc, const char *group_key, size_t group_key_length, uint64_t started)
+{
+  memcached_hedge_st *hedge= memc.hedge;
+  size_t length= group_key ? group_key_length : 0;
+  if (hedge == NULL or hedge->count == 0 or length > sizeof(hedge->group_key))
+  {
+    return;
+  }
+
+  hedge->group_key_length= length;
+  if (length)
+  {
+    memcpy(hedge->group_key, group_key, length);
+  }
+  hedge->started= started;
+  hedge->is_armed= true;
+}
+
+void memcached_hedge_reset(Memcached& memc)
+{
+  memcached_hedge_st *hedge= memc.hedge;
+  if (hedge)
+  {
+    if (hedge->count)
+    {
+      memset(hedge->keys, 0, sizeof(memcached_hedge_key_st) * hedge->size);
+      hedge->count= 0;
+    }
+    hedge->is_armed= false;
+  }
+}
+
+void memcached_hedge_free(Memcached& memc)
+{
+  if (memc.hedge)
+  {
+    libmemcached_free(&memc, memc.hedge->keys);
+    libmemcached_free(&memc, memc.hedge);
+    memc.hedge= NULL;
+  }
+}
+
+memcached_hedge_key_st *memcached_hedge_find(Memcached& memc, const char *key, size_t key_length, uint32_t server)
+{
+  memcached_hedge_st *hedge= memc.hedge;
+  if (hedge == NULL or hedge->count == 0)
+  {
+    return NULL;
+  }
+
+  uint32_t hash= hedge_key_hash(key, key_length);
+  for (uint32_t slot= hedge_slot(*hedge, hash); hedge->keys[slot].used; slot= hedge_slot(*hedge, slot +1))
+  {
+    memcached_hedge_key_st& entry= hedge->keys[slot];
+    if (entry.hash == hash and entry.key_length == key_length and
+        (entry.sent_to == server or entry.hedged_to == server) and
+        memcmp(entry.key, key, key_length) == 0)
+    {
+      return &entry;
+    }
+  }
+
+  return NULL;
+}
+
+bool memcached_hedge_is_duplicate(Memcached& memc, const memcached_instance_st* instance, const memcached_result_st& result)
+{
+  if (memc.hedge == NULL or memc.hedge->count == 0)
+  {
+    return false;
+  }
+
+  uint32_t server= uint32_t(instance -memcached_instance_list(&memc));
+  memcached_hedge_key_st *entry= memcached_hedge_find(memc, result.item_key, result.key_length, server);
+  if (entry == NULL or entry->hedged_to == UINT32_MAX)
+  {
+    return false;
+  }
+
+  if (entry->served)
+  {
+    return true;
+  }
+  entry->served= true;
+
+  return false;
+}
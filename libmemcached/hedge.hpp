@@ -0,0 +1,90 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  Hedged reads for replicated binary mget.
+
+  When MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE is set, binary mget
+  remembers which server each key was read from and arms the hedge. The
+  first memcached_fetch_result() after that waits for the percentile of each
+  primary's latency (see latency.hpp) and sends the same GETK to the next
+  replica for any key whose server has not answered. Only the first answer
+  for a hedged key is handed back.
+
+  Keys live in an open addressed table hashed on the key. An entry matches a
+  reply when both the key and the server it came from agree, so the same key
+  read from unrelated servers is never mistaken for a hedge.
+*/
+
+struct memcached_hedge_key_st {
+  uint32_t hash;
+  uint32_t home; // Server the key hashes to
+  uint32_t sent_to; // Server the first read went to
+  uint32_t hedged_to; // Server the hedged read went to, UINT32_MAX until sent
+  bool used;
+  bool served;
+  size_t key_length;
+  char key[MEMCACHED_MAX_KEY];
+};
+
+struct memcached_hedge_st {
+  bool is_armed; // Reads are out and the hedge has not been decided yet
+  uint64_t started;
+  size_t group_key_length;
+  char group_key[MEMCACHED_MAX_KEY];
+  uint32_t count;
+  uint32_t size; // Power of two, at least twice count
+  struct memcached_hedge_key_st *keys;
+};
+
+memcached_return_t memcached_hedge_add(Memcached&, const char *key, size_t key_length,
+                                       uint32_t home, uint32_t sent_to);
+
+void memcached_hedge_arm(Memcached&, const char *group_key, size_t group_key_length, uint64_t started);
+
+void memcached_hedge_reset(Memcached&);
+
+void memcached_hedge_free(Memcached&);
+
+memcached_hedge_key_st *memcached_hedge_find(Memcached&, const char *key, size_t key_length, uint32_t server);
+
+bool memcached_hedge_is_duplicate(Memcached&, const memcached_instance_st*, const memcached_result_st&);
+
+// Defined in get.cc, next to the replicated mget it finishes.
+void memcached_hedge_fire(Memcached*);
@@ -39,10 +39,6 @@
 #include "libmemcached/assert.hpp"
 
 #include <cmath>
-#ifdef HAVE_SYS_TIME_H
-# include <sys/time.h>
-#endif
-
 /* Protoypes (static) */
 static memcached_return_t update_continuum(Memcached *ptr);
 
@@ -66,10 +62,36 @@ static void sort_hosts(Memcached *ptr)
   if (memcached_server_count(ptr))
   {
     qsort(memcached_instance_list(ptr), memcached_server_count(ptr), sizeof(memcached_instance_st), compare_servers);
+    memcached_instance_relink(ptr, memcached_server_count(ptr));
   }
 }
 
 
+/*
+  Builds the tables of a consistent distribution, unless a handle sharing
+  our snapshot slot has already published them for the same servers.
+*/
+static memcached_return_t build_shared(Memcached *ptr, memcached_return_t (*build)(Memcached *))
+{
+  if (memcached_snapshot_adopt(ptr))
+  {
+    return MEMCACHED_SUCCESS;
+  }
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_snapshot_detach(ptr)))
+  {
+    return rc;
+  }
+
+  if (memcached_success(rc= build(ptr)))
+  {
+    memcached_snapshot_publish(ptr);
+  }
+
+  return rc;
+}
+
 memcached_return_t run_distribution(Memcached *ptr)
 {
   if (ptr->flags.use_sort_hosts)
@@ -77,18 +99,28 @@ memcached_return_t run_distribution(Memcached *ptr)
     sort_hosts(ptr);
   }
 
+  memcached_route_install(ptr);
+
   switch (ptr->distribution)
   {
   case MEMCACHED_DISTRIBUTION_CONSISTENT:
   case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA:
   case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY:
   case MEMCACHED_DISTRIBUTION_CONSISTENT_WEIGHTED:
-    return update_continuum(ptr);
+    return build_shared(ptr, update_continuum);
 
   case MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET:
   case MEMCACHED_DISTRIBUTION_MODULA:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP:
     break;
 
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON:
+    return build_shared(ptr, memcached_rendezvous_build);
+
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV:
+    return build_shared(ptr, memcached_maglev_build);
+
   case MEMCACHED_DISTRIBUTION_RANDOM:
     srandom((uint32_t) time(NULL));
     break;
@@ -113,40 +145,101 @@ static uint32_t ketama_server_hash(const char *key, size_t key_length, uint32_t
     | (results[0 + alignment * 4] & 0xFF);
 }
 
-static int continuum_item_cmp(const void *t1, const void *t2)
+/*
+  Hashes the points of the server at host_index that its run does not have
+  yet, up to run.wanted.
+*/
+static memcached_return_t continuum_hash_server(Memcached *ptr, uint32_t host_index,
+                                                memcached_continuum_run_st& run,
+                                                uint32_t pointer_per_hash)
 {
-  memcached_continuum_item_st *ct1= (memcached_continuum_item_st *)t1;
-  memcached_continuum_item_st *ct2= (memcached_continuum_item_st *)t2;
+  memcached_instance_st* list= memcached_instance_list(ptr);
 
-  /* Why 153? Hmmm... */
-  WATCHPOINT_ASSERT(ct1->value != 153);
-  if (ct1->value == ct2->value)
+  memcached_continuum_point_st *points= libmemcached_xcalloc(ptr, run.wanted, memcached_continuum_point_st);
+  if (points == NULL)
   {
-    return 0;
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
   }
-  else if (ct1->value > ct2->value)
-  {
-    return 1;
-  }
-  else
+
+  uint32_t point= run.hashed;
+  for (uint32_t pointer_index= run.hashed / pointer_per_hash;
+       pointer_index < run.wanted / pointer_per_hash;
+       pointer_index++)
   {
-    return -1;
+    char sort_host[1 +MEMCACHED_NI_MAXHOST +1 +MEMCACHED_NI_MAXSERV +1 +MEMCACHED_NI_MAXSERV]= "";
+    int sort_host_length;
+
+    if (ptr->distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY)
+    {
+      // Spymemcached ketema key format is: hostname/ip:port-index
+      // If hostname is not available then: /ip:port-index
+      sort_host_length= snprintf(sort_host, sizeof(sort_host),
+                                 "/%s:%u-%u",
+                                 list[host_index]._hostname,
+                                 (uint32_t)list[host_index].port(),
+                                 pointer_index);
+    }
+    else if (list[host_index].port() == MEMCACHED_DEFAULT_PORT)
+    {
+      sort_host_length= snprintf(sort_host, sizeof(sort_host),
+                                 "%s-%u",
+                                 list[host_index]._hostname,
+                                 pointer_index);
+    }
+    else
+    {
+      sort_host_length= snprintf(sort_host, sizeof(sort_host),
+                                 "%s:%u-%u",
+                                 list[host_index]._hostname,
+                                 (uint32_t)list[host_index].port(),
+                                 pointer_index);
+    }
+
+    if (size_t(sort_host_length) >= sizeof(sort_host) or sort_host_length < 0)
+    {
+      libmemcached_free(ptr, points);
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT, 
+                                 memcached_literal_param("snprintf(sizeof(sort_host))"));
+    }
+
+    if (DEBUG)
+    {
+      fprintf(stdout, "update_continuum: key is %s\n", sort_host);
+    }
+
+    for (uint32_t x= 0; x < pointer_per_hash; x++)
+    {
+      if (memcached_is_weighted_ketama(ptr))
+      {
+        points[point].value= ketama_server_hash(sort_host, (size_t)sort_host_length, x);
+      }
+      else
+      {
+        points[point].value= hashkit_digest(&ptr->hashkit, sort_host, (size_t)sort_host_length);
+      }
+
+      if (memcached_is_64bit_ketama(ptr))
+      {
+        points[point].low= memcached_continuum_low_hash(sort_host, (size_t)sort_host_length, x);
+      }
+      points[point].sequence= point;
+      point++;
+    }
   }
+
+  memcached_return_t rc= memcached_continuum_run_append(ptr, run, points, point);
+  libmemcached_free(ptr, points);
+
+  return rc;
 }
 
 static memcached_return_t update_continuum(Memcached *ptr)
 {
-  uint32_t continuum_index= 0;
   uint32_t pointer_counter= 0;
   uint32_t pointer_per_server= MEMCACHED_POINTS_PER_SERVER;
   uint32_t pointer_per_hash= 1;
   uint32_t live_servers= 0;
-  struct timeval now;
-
-  if (gettimeofday(&now, NULL))
-  {
-    return memcached_set_errno(*ptr, errno, MEMCACHED_AT);
-  }
+  time_t now= memcached_clock_now();
 
   memcached_instance_st* list= memcached_instance_list(ptr);
 
@@ -158,7 +251,7 @@ static memcached_return_t update_continuum(Memcached *ptr)
     ptr->ketama.next_distribution_rebuild= 0;
     for (uint32_t host_index= 0; host_index < memcached_server_count(ptr); ++host_index)
     {
-      if (list[host_index].next_retry <= now.tv_sec)
+      if (list[host_index].next_retry <= now)
       {
         live_servers++;
       }
@@ -176,35 +269,28 @@ static memcached_return_t update_continuum(Memcached *ptr)
     live_servers= memcached_server_count(ptr);
   }
 
-  uint32_t points_per_server= (uint32_t) (memcached_is_weighted_ketama(ptr) ? MEMCACHED_POINTS_PER_SERVER_KETAMA : MEMCACHED_POINTS_PER_SERVER);
 
   if (live_servers == 0)
   {
     return MEMCACHED_SUCCESS;
   }
 
-  if (live_servers > ptr->ketama.continuum_count)
+  // A continuum that has to be hashed from scratch is rebuilt; one that only
+  // lost or regained servers is patched in place.
+  bool rebuild= ptr->ketama.lookup == NULL;
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_continuum_cache_prepare(ptr, rebuild)))
   {
-    memcached_continuum_item_st *new_ptr;
-
-    new_ptr= libmemcached_xrealloc(ptr, ptr->ketama.continuum, (live_servers + MEMCACHED_CONTINUUM_ADDITION) * points_per_server, memcached_continuum_item_st);
-
-    if (new_ptr == 0)
-    {
-      return MEMCACHED_MEMORY_ALLOCATION_FAILURE;
-    }
-
-    ptr->ketama.continuum= new_ptr;
-    ptr->ketama.continuum_count= live_servers + MEMCACHED_CONTINUUM_ADDITION;
+    return rc;
   }
-  assert_msg(ptr->ketama.continuum, "Programmer Error, empty ketama continuum");
+  memcached_continuum_cache_st *cache= ptr->ketama.cache;
 
   uint64_t total_weight= 0;
   if (memcached_is_weighted_ketama(ptr))
   {
     for (uint32_t host_index = 0; host_index < memcached_server_count(ptr); ++host_index)
     {
-      if (is_auto_ejecting == false or list[host_index].next_retry <= now.tv_sec)
+      if (is_auto_ejecting == false or list[host_index].next_retry <= now)
       {
         total_weight += list[host_index].weight;
       }
@@ -213,7 +299,10 @@ static memcached_return_t update_continuum(Memcached *ptr)
 
   for (uint32_t host_index= 0; host_index < memcached_server_count(ptr); ++host_index)
   {
-    if (is_auto_ejecting and list[host_index].next_retry > now.tv_sec)
+    memcached_continuum_run_st& run= cache->runs[host_index];
+    run.wanted= 0;
+
+    if (is_auto_ejecting and list[host_index].next_retry > now)
     {
       continue;
     }
@@ -233,109 +322,51 @@ static memcached_return_t update_continuum(Memcached *ptr)
         }
     }
 
-
-    if (ptr->distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY)
+    run.wanted= pointer_per_server;
+    if (run.wanted > run.hashed)
     {
-      for (uint32_t pointer_index= 0;
-           pointer_index < pointer_per_server / pointer_per_hash;
-           pointer_index++)
+      if (memcached_failed(rc= continuum_hash_server(ptr, host_index, run, pointer_per_hash)))
       {
-        char sort_host[1 +MEMCACHED_NI_MAXHOST +1 +MEMCACHED_NI_MAXSERV +1 + MEMCACHED_NI_MAXSERV ]= "";
-        int sort_host_length;
-
-        // Spymemcached ketema key format is: hostname/ip:port-index
-        // If hostname is not available then: /ip:port-index
-        sort_host_length= snprintf(sort_host, sizeof(sort_host),
-                                   "/%s:%u-%u",
-                                   list[host_index]._hostname,
-                                   (uint32_t)list[host_index].port(),
-                                   pointer_index);
-
-        if (size_t(sort_host_length) >= sizeof(sort_host) or sort_host_length < 0)
-        {
-          return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT, 
-                                     memcached_literal_param("snprintf(sizeof(sort_host))"));
-        }
-
-        if (DEBUG)
-        {
-          fprintf(stdout, "update_continuum: key is %s\n", sort_host);
-        }
-
-        if (memcached_is_weighted_ketama(ptr))
-        {
-          for (uint32_t x= 0; x < pointer_per_hash; x++)
-          {
-            uint32_t value= ketama_server_hash(sort_host, (size_t)sort_host_length, x);
-            ptr->ketama.continuum[continuum_index].index= host_index;
-            ptr->ketama.continuum[continuum_index++].value= value;
-          }
-        }
-        else
-        {
-          uint32_t value= hashkit_digest(&ptr->hashkit, sort_host, (size_t)sort_host_length);
-          ptr->ketama.continuum[continuum_index].index= host_index;
-          ptr->ketama.continuum[continuum_index++].value= value;
-        }
+        return rc;
       }
     }
-    else
-    {
-      for (uint32_t pointer_index= 1;
-           pointer_index <= pointer_per_server / pointer_per_hash;
-           pointer_index++)
-      {
-        char sort_host[MEMCACHED_NI_MAXHOST +1 +MEMCACHED_NI_MAXSERV +1 +MEMCACHED_NI_MAXSERV]= "";
-        int sort_host_length;
 
-        if (list[host_index].port() == MEMCACHED_DEFAULT_PORT)
-        {
-          sort_host_length= snprintf(sort_host, sizeof(sort_host),
-                                     "%s-%u",
-                                     list[host_index]._hostname,
-                                     pointer_index - 1);
-        }
-        else
-        {
-          sort_host_length= snprintf(sort_host, sizeof(sort_host),
-                                     "%s:%u-%u",
-                                     list[host_index]._hostname,
-                                     (uint32_t)list[host_index].port(),
-                                     pointer_index - 1);
-        }
-
-        if (size_t(sort_host_length) >= sizeof(sort_host) or sort_host_length < 0)
-        {
-          return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT, 
-                                     memcached_literal_param("snprintf(sizeof(sort_host)))"));
-        }
-
-        if (memcached_is_weighted_ketama(ptr))
-        {
-          for (uint32_t x = 0; x < pointer_per_hash; x++)
-          {
-            uint32_t value= ketama_server_hash(sort_host, (size_t)sort_host_length, x);
-            ptr->ketama.continuum[continuum_index].index= host_index;
-            ptr->ketama.continuum[continuum_index++].value= value;
-          }
-        }
-        else
-        {
-          uint32_t value= hashkit_digest(&ptr->hashkit, sort_host, (size_t)sort_host_length);
-          ptr->ketama.continuum[continuum_index].index= host_index;
-          ptr->ketama.continuum[continuum_index++].value= value;
-        }
-      }
+    // Weighted servers change share whenever another one leaves or returns.
+    if (run.live and run.live != run.wanted)
+    {
+      rebuild= true;
     }
 
     pointer_counter+= pointer_per_server;
   }
 
+  if (memcached_failed(rc= memcached_continuum_reserve(ptr, pointer_counter, rebuild)))
+  {
+    return rc;
+  }
+
   assert_msg(ptr, "Programmer Error, no valid ptr");
   assert_msg(ptr->ketama.continuum, "Programmer Error, empty ketama continuum");
-  assert_msg(memcached_server_count(ptr) * MEMCACHED_POINTS_PER_SERVER <= MEMCACHED_CONTINUUM_SIZE, "invalid size information being given to qsort()");
-  ptr->ketama.continuum_points_counter= pointer_counter;
-  qsort(ptr->ketama.continuum, ptr->ketama.continuum_points_counter, sizeof(memcached_continuum_item_st), continuum_item_cmp);
+
+  if (rebuild)
+  {
+    if (memcached_failed(rc= memcached_continuum_rebuild(ptr)))
+    {
+      return rc;
+    }
+  }
+  else
+  {
+    memcached_continuum_remove(ptr);
+    for (uint32_t host_index= 0; host_index < memcached_server_count(ptr); ++host_index)
+    {
+      if (cache->runs[host_index].live == 0 and cache->runs[host_index].wanted)
+      {
+        memcached_continuum_merge(ptr, host_index);
+      }
+    }
+  }
+  assert(ptr->ketama.continuum_points_counter == pointer_counter);
 
   if (DEBUG)
   {
@@ -345,6 +376,11 @@ static memcached_return_t update_continuum(Memcached *ptr)
     }
   }
 
+  if (memcached_failed(memcached_continuum_pack(ptr)))
+  {
+    return MEMCACHED_MEMORY_ALLOCATION_FAILURE;
+  }
+
   return MEMCACHED_SUCCESS;
 }
 
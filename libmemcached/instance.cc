@@ -57,19 +57,26 @@ static inline void _server_init(memcached_instance_st* self, Memcached *root,
   self->server_timeout_counter= 0;
   self->server_timeout_counter_query_id= 0;
   self->weight= weight ? weight : 1; // 1 is the default weight value
+  self->read_load= 0;
   self->io_wait_count.read= 0;
   self->io_wait_count.write= 0;
   self->io_wait_count.timeouts= 0;
   self->io_wait_count._bytes_read= 0;
+  memcached_latency_init(self->latency);
   self->major_version= UINT8_MAX;
   self->micro_version= UINT8_MAX;
   self->minor_version= UINT8_MAX;
   self->type= type;
   self->error_messages= NULL;
+  self->error_ring= NULL;
   self->read_ptr= self->read_buffer;
   self->read_buffer_length= 0;
   self->read_data_length= 0;
   self->write_buffer_offset= 0;
+  self->pending.next= NULL;
+  self->pending.prev_next= NULL;
+  self->dirty.next= NULL;
+  self->dirty.prev_next= NULL;
   self->address_info= NULL;
   self->address_info_next= NULL;
 
@@ -171,7 +178,7 @@ void __instance_free(memcached_instance_st* self)
   self->clear_addrinfo();
   assert(self->address_info_next == NULL);
 
-  memcached_error_free(*self);
+  memcached_error_destroy(*self);
 
   if (memcached_is_allocated(self))
   {
@@ -360,3 +367,28 @@ bool memcached_instance_st::is_shutting_down() const
 {
   return options.is_shutting_down;
 }
+
+/*
+  The pending and dirty lists point into the instance array, so they are
+  threaded again whenever the array moves or is reordered. Only the first
+  instance_count instances are looked at, anything past them has not been
+  initialized yet.
+*/
+void memcached_instance_relink(memcached_st* memc, uint32_t instance_count)
+{
+  memc->pending_instances= NULL;
+  memc->dirty_instances= NULL;
+
+  for (uint32_t x= 0; x < instance_count; ++x)
+  {
+    memcached_instance_st* instance= &memc->servers[x];
+
+    instance->pending.prev_next= NULL;
+    instance->dirty.prev_next= NULL;
+    memcached_instance_pending_update(instance);
+    if (memcached_is_udp(memc) == false)
+    {
+      memcached_instance_dirty_update(instance);
+    }
+  }
+}
@@ -57,6 +57,17 @@
 #endif
 
 #include "libmemcached/string.hpp"
+#include "libmemcached/latency.hpp"
+
+/*
+  Intrusive link for the per-handle lists of instances with outstanding
+  responses and with buffered writes. prev_next points at the head or
+  at the previous instance's next, and is NULL while unlinked.
+*/
+struct memcached_instance_link_st {
+  struct memcached_instance_st *next;
+  struct memcached_instance_st **prev_next;
+};
 
 // @todo Complete class transformation
 struct memcached_instance_st {
@@ -119,7 +130,7 @@ struct memcached_instance_st {
     return _revents;
   }
 
-  const char* hostname()
+  const char* hostname() const
   {
     return _hostname;
   }
@@ -152,6 +163,7 @@ struct memcached_instance_st {
   uint32_t server_timeout_counter_query_id;
   uint32_t weight;
   uint32_t version;
+  uint32_t read_load; /* Recent reads routed here, see MEMCACHED_BEHAVIOR_BOUNDED_LOAD */
   enum memcached_server_state_t state;
   struct {
     uint32_t read;
@@ -159,10 +171,13 @@ struct memcached_instance_st {
     uint32_t timeouts;
     size_t _bytes_read;
   } io_wait_count;
+  memcached_latency_st latency;
   uint8_t major_version; // Default definition of UINT8_MAX means that it has not been set.
   uint8_t micro_version; // ditto, and note that this is the third, not second version bit
   uint8_t minor_version; // ditto
   memcached_connection_t type;
+  memcached_instance_link_st pending; // On root->pending_instances while response_count() > 0
+  memcached_instance_link_st dirty; // On root->dirty_instances while write_buffer_offset > 0
   char *read_ptr;
   size_t read_buffer_length;
   size_t read_data_length;
@@ -173,6 +188,7 @@ struct memcached_instance_st {
   struct memcached_st *root;
   uint64_t limit_maxbytes;
   struct memcached_error_t *error_messages;
+  struct memcached_error_ring_st *error_ring;
   char read_buffer[MEMCACHED_MAX_BUFFER];
   char write_buffer[MEMCACHED_MAX_BUFFER];
   char _hostname[MEMCACHED_NI_MAXHOST];
@@ -188,6 +204,64 @@ struct memcached_instance_st {
   }
 };
 
+template <memcached_instance_link_st memcached_instance_st::*link>
+static inline void memcached_instance_link(memcached_instance_st*& head, memcached_instance_st* instance)
+{
+  memcached_instance_link_st& self= instance->*link;
+  if (self.prev_next == NULL)
+  {
+    self.next= head;
+    if (head)
+    {
+      (head->*link).prev_next= &self.next;
+    }
+    head= instance;
+    self.prev_next= &head;
+  }
+}
+
+template <memcached_instance_link_st memcached_instance_st::*link>
+static inline void memcached_instance_unlink(memcached_instance_st* instance)
+{
+  memcached_instance_link_st& self= instance->*link;
+  if (self.prev_next)
+  {
+    *self.prev_next= self.next;
+    if (self.next)
+    {
+      (self.next->*link).prev_next= self.prev_next;
+    }
+    self.next= NULL;
+    self.prev_next= NULL;
+  }
+}
+
+static inline void memcached_instance_pending_update(memcached_instance_st* instance)
+{
+  if (instance->cursor_active_)
+  {
+    memcached_instance_link<&memcached_instance_st::pending>(instance->root->pending_instances, instance);
+  }
+  else
+  {
+    memcached_instance_unlink<&memcached_instance_st::pending>(instance);
+  }
+}
+
+static inline void memcached_instance_dirty_update(memcached_instance_st* instance)
+{
+  if (instance->write_buffer_offset)
+  {
+    memcached_instance_link<&memcached_instance_st::dirty>(instance->root->dirty_instances, instance);
+  }
+  else
+  {
+    memcached_instance_unlink<&memcached_instance_st::dirty>(instance);
+  }
+}
+
+void memcached_instance_relink(memcached_st*, uint32_t instance_count);
+
 memcached_instance_st* __instance_create_with(memcached_st *memc,
                                               memcached_instance_st* self,
                                               const memcached_string_t& _hostname,
@@ -409,6 +409,7 @@ static bool io_flush(memcached_instance_st* instance,
 
   WATCHPOINT_ASSERT(write_length == 0);
   instance->write_buffer_offset= 0;
+  memcached_instance_dirty_update(instance);
 
   return true;
 }
@@ -637,6 +638,7 @@ static bool _io_write(memcached_instance_st* instance,
     write_ptr= instance->write_buffer + instance->write_buffer_offset;
     memcpy(write_ptr, buffer_ptr, should_write);
     instance->write_buffer_offset+= should_write;
+    memcached_instance_dirty_update(instance);
     buffer_ptr+= should_write;
     length-= should_write;
 
@@ -764,6 +766,7 @@ void memcached_instance_st::close_socket()
   cursor_active_= 0;
   io_bytes_sent= 0;
   write_buffer_offset= size_t(root and memcached_is_udp(root) ? UDP_DATAGRAM_HEADER_LENGTH : 0);
+  memcached_instance_unlink<&memcached_instance_st::dirty>(this);
   read_buffer_length= 0;
   read_ptr= read_buffer;
   options.is_shutting_down= false;
@@ -778,40 +781,33 @@ memcached_instance_st* memcached_io_get_readable_server(Memcached *memc, memcach
 {
 #define MAX_SERVERS_TO_POLL 100
   struct pollfd fds[MAX_SERVERS_TO_POLL];
+  memcached_instance_st* polled[MAX_SERVERS_TO_POLL];
   nfds_t host_index= 0;
 
-  for (uint32_t x= 0; x < memcached_server_count(memc) and host_index < MAX_SERVERS_TO_POLL; ++x)
+  /*
+    Only servers with outstanding responses can have anything for us, and
+    a server holding unread data in its buffer is one of them.
+  */
+  for (memcached_instance_st* instance= memc->pending_instances;
+       instance and host_index < MAX_SERVERS_TO_POLL;
+       instance= instance->pending.next)
   {
-    memcached_instance_st* instance= memcached_instance_fetch(memc, x);
-
     if (instance->read_buffer_length > 0) /* I have data in the buffer */
     {
       return instance;
     }
 
-    if (instance->response_count() > 0)
-    {
-      fds[host_index].events= POLLIN;
-      fds[host_index].revents= 0;
-      fds[host_index].fd= instance->fd;
-      ++host_index;
-    }
+    fds[host_index].events= POLLIN;
+    fds[host_index].revents= 0;
+    fds[host_index].fd= instance->fd;
+    polled[host_index]= instance;
+    ++host_index;
   }
 
   if (host_index < 2)
   {
     /* We have 0 or 1 server with pending events.. */
-    for (uint32_t x= 0; x< memcached_server_count(memc); ++x)
-    {
-      memcached_instance_st* instance= memcached_instance_fetch(memc, x);
-
-      if (instance->response_count() > 0)
-      {
-        return instance;
-      }
-    }
-
-    return NULL;
+    return memc->pending_instances;
   }
 
   int error= poll(fds, host_index, memc->poll_timeout);
@@ -828,15 +824,7 @@ memcached_instance_st* memcached_io_get_readable_server(Memcached *memc, memcach
     {
       if (fds[x].revents & POLLIN)
       {
-        for (uint32_t y= 0; y < memcached_server_count(memc); ++y)
-        {
-          memcached_instance_st* instance= memcached_instance_fetch(memc, y);
-
-          if (instance->fd == fds[x].fd)
-          {
-            return instance;
-          }
-        }
+        return polled[x];
       }
     }
   }
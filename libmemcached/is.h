@@ -62,6 +62,7 @@
 #define memcached_is_ready(__object) ((__object)->options.ready)
 
 #define memcached_is_weighted_ketama(__object) ((__object)->ketama.weighted_)
+#define memcached_is_64bit_ketama(__object) ((__object)->ketama.ring_64bit_)
 
 #define memcached_set_ready(__object, __flag) ((__object)->options.ready= (__flag))
 
@@ -91,5 +92,6 @@
 #define memcached_set_allocated(__object, __value) ((__object)->options.is_allocated= (__value))
 
 #define memcached_set_weighted_ketama(__object, __value) ((__object)->ketama.weighted_= (__value))
+#define memcached_set_64bit_ketama(__object, __value) ((__object)->ketama.ring_64bit_= (__value))
 
 #define memcached2Memcached(__obj) (__obj)
@@ -0,0 +1,125 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+uint64_t memcached_latency_now(void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && HAVE_CLOCK_GETTIME && defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+  {
+    return uint64_t(ts.tv_sec) * 1000000 + uint64_t(ts.tv_nsec / 1000);
+  }
+#endif
+
+  struct timeval tv;
+  if (gettimeofday(&tv, NULL) == 0)
+  {
+    return uint64_t(tv.tv_sec) * 1000000 + uint64_t(tv.tv_usec);
+  }
+
+  return 0;
+}
+
+void memcached_latency_init(memcached_latency_st& self)
+{
+  self.samples= 0;
+  memset(self.bucket, 0, sizeof(self.bucket));
+}
+
+static inline uint32_t latency_bucket(uint64_t usec)
+{
+  uint32_t bucket= 0;
+  while (usec > 1 and bucket < MEMCACHED_LATENCY_BUCKETS -1)
+  {
+    usec>>= 1;
+    bucket++;
+  }
+
+  return bucket;
+}
+
+void memcached_latency_record(memcached_latency_st& self, uint64_t usec)
+{
+  // Age the histogram so that it follows the server when it speeds up or
+  // slows down.
+  if (self.samples >= MEMCACHED_LATENCY_MAX_SAMPLES)
+  {
+    self.samples= 0;
+    for (uint32_t x= 0; x < MEMCACHED_LATENCY_BUCKETS; x++)
+    {
+      self.bucket[x]>>= 1;
+      self.samples+= self.bucket[x];
+    }
+  }
+
+  self.bucket[latency_bucket(usec)]++;
+  self.samples++;
+}
+
+bool memcached_latency_ready(const memcached_latency_st& self)
+{
+  return self.samples >= MEMCACHED_LATENCY_MIN_SAMPLES;
+}
+
+uint64_t memcached_latency_percentile(const memcached_latency_st& self, uint32_t percentile)
+{
+  if (self.samples == 0)
+  {
+    return 0;
+  }
+
+  if (percentile > 100)
+  {
+    percentile= 100;
+  }
+
+  uint64_t wanted= (uint64_t(self.samples) * percentile +99) / 100;
+  uint64_t seen= 0;
+  for (uint32_t x= 0; x < MEMCACHED_LATENCY_BUCKETS; x++)
+  {
+    seen+= self.bucket[x];
+    if (seen >= wanted and seen)
+    {
+      // Upper bound of the bucket, we would rather hedge a little late than early.
+      return uint64_t(1) << (x +1);
+    }
+  }
+
+  return uint64_t(1) << MEMCACHED_LATENCY_BUCKETS;
+}
@@ -0,0 +1,104 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  A plain mutex for the few places where the library itself shares state
+  between handles. CRITICAL_SECTION on Windows, pthread everywhere else.
+*/
+
+#if defined(_WIN32)
+
+typedef CRITICAL_SECTION memcached_lock_t;
+
+static inline bool memcached_lock_init(memcached_lock_t& lock)
+{
+  InitializeCriticalSection(&lock);
+  return true;
+}
+
+static inline void memcached_lock_destroy(memcached_lock_t& lock)
+{
+  DeleteCriticalSection(&lock);
+}
+
+static inline void memcached_lock(memcached_lock_t& lock)
+{
+  EnterCriticalSection(&lock);
+}
+
+static inline void memcached_unlock(memcached_lock_t& lock)
+{
+  LeaveCriticalSection(&lock);
+}
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_mutex_t memcached_lock_t;
+
+static inline bool memcached_lock_init(memcached_lock_t& lock)
+{
+  return pthread_mutex_init(&lock, NULL) == 0;
+}
+
+static inline void memcached_lock_destroy(memcached_lock_t& lock)
+{
+  (void)pthread_mutex_destroy(&lock);
+}
+
+static inline void memcached_lock(memcached_lock_t& lock)
+{
+  int error;
+  if ((error= pthread_mutex_lock(&lock)) != 0)
+  {
+    assert_vmsg(error == 0, "pthread_mutex_lock() %s", strerror(error));
+  }
+}
+
+static inline void memcached_unlock(memcached_lock_t& lock)
+{
+  int error;
+  if ((error= pthread_mutex_unlock(&lock)) != 0)
+  {
+    assert_vmsg(error == 0, "pthread_mutex_unlock() %s", strerror(error));
+  }
+}
+
+#endif
@@ -0,0 +1,225 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+#define MEMCACHED_MAGLEV_EMPTY UINT32_MAX
+
+static const uint32_t maglev_primes[]= {
+  65537, 131071, 262139, 524287, 1048573, 2097143, 4194301, 8388593, 16777213,
+  33554393, 67108859, 134217689, 268435399
+};
+
+static uint32_t maglev_table_size(uint32_t servers)
+{
+  uint64_t wanted= uint64_t(servers) * MEMCACHED_MAGLEV_SLOTS_PER_SERVER;
+  for (size_t x= 0; x < sizeof(maglev_primes) / sizeof(maglev_primes[0]); x++)
+  {
+    if (maglev_primes[x] >= wanted)
+    {
+      return maglev_primes[x];
+    }
+  }
+
+  return maglev_primes[sizeof(maglev_primes) / sizeof(maglev_primes[0]) -1];
+}
+
+static uint64_t maglev_server_hash(const memcached_instance_st& instance)
+{
+  uint64_t hash= 14695981039346656037ULL;
+  for (const char *ptr= instance._hostname; *ptr; ptr++)
+  {
+    hash^= uint8_t(*ptr);
+    hash*= 1099511628211ULL;
+  }
+  hash^= instance.port();
+  hash*= 1099511628211ULL;
+
+  hash^= hash >> 33;
+  hash*= 0xff51afd7ed558ccdULL;
+  hash^= hash >> 33;
+
+  return hash;
+}
+
+void memcached_maglev_destroy(memcached_st *ptr, memcached_maglev_st *self)
+{
+  if (self)
+  {
+    libmemcached_free(ptr, self->table);
+    libmemcached_free(ptr, self);
+  }
+}
+
+void memcached_maglev_free(memcached_st *ptr)
+{
+  memcached_maglev_destroy(ptr, ptr->maglev);
+  ptr->maglev= NULL;
+}
+
+memcached_return_t memcached_maglev_build(memcached_st *ptr)
+{
+  uint32_t server_count= memcached_server_count(ptr);
+  if (server_count == 0)
+  {
+    memcached_maglev_free(ptr);
+    return MEMCACHED_SUCCESS;
+  }
+
+  time_t now= memcached_clock_now();
+
+  uint32_t size= maglev_table_size(server_count);
+  memcached_maglev_st *self= ptr->maglev;
+  if (self == NULL)
+  {
+    if ((self= libmemcached_xcalloc(ptr, 1, memcached_maglev_st)) == NULL)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+    ptr->maglev= self;
+  }
+
+  if (self->size != size)
+  {
+    uint32_t *table= libmemcached_xrealloc(ptr, self->table, size, uint32_t);
+    if (table == NULL)
+    {
+      memcached_maglev_free(ptr);
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+    self->table= table;
+    self->size= size;
+  }
+
+  uint32_t *position= libmemcached_xcalloc(ptr, server_count, uint32_t);
+  uint32_t *skip= libmemcached_xcalloc(ptr, server_count, uint32_t);
+  uint64_t *credit= libmemcached_xcalloc(ptr, server_count, uint64_t);
+  bool *live= libmemcached_xcalloc(ptr, server_count, bool);
+  if (position == NULL or skip == NULL or credit == NULL or live == NULL)
+  {
+    libmemcached_free(ptr, position);
+    libmemcached_free(ptr, skip);
+    libmemcached_free(ptr, credit);
+    libmemcached_free(ptr, live);
+    memcached_maglev_free(ptr);
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+
+  memcached_instance_st* list= memcached_instance_list(ptr);
+  bool is_auto_ejecting= _is_auto_eject_host(ptr);
+  uint32_t live_servers= server_count;
+
+  if (is_auto_ejecting)
+  {
+    live_servers= 0;
+    ptr->ketama.next_distribution_rebuild= 0;
+    for (uint32_t host_index= 0; host_index < server_count; ++host_index)
+    {
+      if (list[host_index].next_retry <= now)
+      {
+        live_servers++;
+      }
+      else if (ptr->ketama.next_distribution_rebuild == 0 or list[host_index].next_retry < ptr->ketama.next_distribution_rebuild)
+      {
+        ptr->ketama.next_distribution_rebuild= list[host_index].next_retry;
+      }
+    }
+  }
+
+  // With every server ejected keys keep going where they would have gone.
+  uint64_t max_weight= 0;
+  for (uint32_t host_index= 0; host_index < server_count; ++host_index)
+  {
+    uint64_t hash= maglev_server_hash(list[host_index]);
+    position[host_index]= uint32_t(hash >> 32) % size;
+    skip[host_index]= uint32_t(hash) % (size -1) +1;
+
+    if (live_servers and is_auto_ejecting and list[host_index].next_retry > now)
+    {
+      continue;
+    }
+
+    live[host_index]= true;
+    uint64_t weight= list[host_index].weight ? list[host_index].weight : 1;
+    if (weight > max_weight)
+    {
+      max_weight= weight;
+    }
+  }
+
+  for (uint32_t slot= 0; slot < size; slot++)
+  {
+    self->table[slot]= MEMCACHED_MAGLEV_EMPTY;
+  }
+
+  uint32_t filled= 0;
+  while (filled < size)
+  {
+    for (uint32_t host_index= 0; host_index < server_count and filled < size; ++host_index)
+    {
+      if (live[host_index] == false)
+      {
+        continue;
+      }
+
+      credit[host_index]+= list[host_index].weight ? list[host_index].weight : 1;
+      while (credit[host_index] >= max_weight and filled < size)
+      {
+        credit[host_index]-= max_weight;
+
+        while (self->table[position[host_index]] != MEMCACHED_MAGLEV_EMPTY)
+        {
+          position[host_index]+= skip[host_index];
+          if (position[host_index] >= size)
+          {
+            position[host_index]-= size;
+          }
+        }
+
+        self->table[position[host_index]]= host_index;
+        filled++;
+      }
+    }
+  }
+
+  libmemcached_free(ptr, position);
+  libmemcached_free(ptr, skip);
+  libmemcached_free(ptr, credit);
+  libmemcached_free(ptr, live);
+
+  return MEMCACHED_SUCCESS;
+}
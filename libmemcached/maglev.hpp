@@ -0,0 +1,78 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  Maglev lookup table distribution.
+
+  Every live server walks its own permutation of a prime sized table,
+  starting at an offset and stepping by a skip both derived from its name,
+  and the servers take turns claiming the next free slot of their
+  permutation until the table is full.  A key is routed with a single table
+  load, and because each server's preferences do not depend on the others,
+  adding or ejecting a server mostly reassigns its own slots.  Some other
+  slots change hands as well, a few times the server's share on large
+  clusters, and fewer the larger the table is.
+
+  Weights are honored by letting each server claim weight / maximum weight
+  slots per turn.  The table holds at least MEMCACHED_MAGLEV_SLOTS_PER_SERVER
+  slots per server so shares stay within about a percent of their weight.
+*/
+#define MEMCACHED_MAGLEV_SLOTS_PER_SERVER 100
+
+struct memcached_maglev_st
+{
+  uint32_t size; // Prime
+  uint32_t *table;
+};
+
+#ifdef __cplusplus
+
+memcached_return_t memcached_maglev_build(memcached_st *ptr);
+
+void memcached_maglev_free(memcached_st *ptr);
+
+void memcached_maglev_destroy(memcached_st *ptr, memcached_maglev_st *self);
+
+static inline uint32_t memcached_maglev_lookup(const memcached_maglev_st *self, uint32_t hash)
+{
+  // Maps the hash onto [0, size) without a division.
+  return self->table[uint32_t((uint64_t(hash) * self->size) >> 32)];
+}
+
+#endif
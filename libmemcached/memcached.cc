@@ -62,8 +62,14 @@ static inline bool _memcached_init(Memcached *self)
   self->flags.tcp_keepalive= false;
   self->flags.is_aes= false;
   self->flags.is_fetching_version= false;
+  self->flags.replica_read_least_loaded= false;
 
   self->virtual_bucket= NULL;
+  self->rendezvous= NULL;
+  self->maglev= NULL;
+  self->namespace_hash= NULL;
+  self->snapshot= NULL;
+  self->snapshot_slot= NULL;
 
   self->distribution= MEMCACHED_DISTRIBUTION_MODULA;
 
@@ -71,18 +77,26 @@ static inline bool _memcached_init(Memcached *self)
   {
     return false;
   }
+  memcached_route_install(self);
 
   self->server_info.version= 0;
 
   self->ketama.continuum= NULL;
+  self->ketama.lookup= NULL;
+  self->ketama.cache= NULL;
   self->ketama.continuum_count= 0;
   self->ketama.continuum_points_counter= 0;
   self->ketama.next_distribution_rebuild= 0;
   self->ketama.weighted_= false;
+  self->ketama.ring_64bit_= false;
+  self->bounded_load.epsilon= 0;
+  self->bounded_load.total= 0;
 
   self->number_of_hosts= 0;
   self->servers= NULL;
   self->last_disconnected_server= NULL;
+  self->pending_instances= NULL;
+  self->dirty_instances= NULL;
 
   self->snd_timeout= 0;
   self->rcv_timeout= 0;
@@ -107,8 +121,12 @@ static inline bool _memcached_init(Memcached *self)
 
   self->user_data= NULL;
   self->number_of_replicas= 0;
+  self->hedge_read_percentile= 0;
+  self->hedge= NULL;
+  self->batch= NULL;
 
   self->allocators= memcached_allocators_return_default();
+  self->slab= NULL;
 
   self->on_clone= NULL;
   self->on_cleanup= NULL;
@@ -119,6 +137,7 @@ static inline bool _memcached_init(Memcached *self)
   self->sasl.is_allocated= false;
 
   self->error_messages= NULL;
+  self->error_ring= NULL;
   self->_namespace= NULL;
   self->configure.initial_pool_size= 1;
   self->configure.max_pool_size= 1;
@@ -134,6 +153,7 @@ static void __memcached_free(Memcached *ptr, bool release_st)
   send_quit(ptr);
   memcached_instance_list_free(memcached_instance_list(ptr), memcached_instance_list_count(ptr));
   memcached_result_free(&ptr->result);
+  memcached_hedge_free(*ptr);
 
   memcached_virtual_bucket_free(ptr);
 
@@ -144,13 +164,25 @@ static void __memcached_free(Memcached *ptr, bool release_st)
     ptr->on_cleanup(ptr);
   }
 
+  memcached_snapshot_free(ptr);
   libmemcached_free(ptr, ptr->ketama.continuum);
   ptr->ketama.continuum= NULL;
+  memcached_continuum_lookup_free(ptr);
+  memcached_continuum_cache_free(ptr);
+  memcached_rendezvous_free(ptr);
+  memcached_maglev_free(ptr);
 
   memcached_array_free(ptr->_namespace);
   ptr->_namespace= NULL;
+  if (ptr->namespace_hash)
+  {
+    libmemcached_free(ptr, ptr->namespace_hash);
+    ptr->namespace_hash= NULL;
+  }
 
-  memcached_error_free(*ptr);
+  memcached_error_destroy(*ptr);
+
+  memcached_slab_destroy(ptr);
 
 #if defined(LIBMEMCACHED_WITH_SASL_SUPPORT) && LIBMEMCACHED_WITH_SASL_SUPPORT
   if (LIBMEMCACHED_WITH_SASL_SUPPORT and ptr->sasl.callbacks)
@@ -285,8 +317,13 @@ void memcached_servers_reset(memcached_st *shell)
   Memcached* self= memcached2Memcached(shell);
   if (self)
   {
+    memcached_snapshot_release(self);
     libmemcached_free(self, self->ketama.continuum);
     self->ketama.continuum= NULL;
+    memcached_continuum_lookup_free(self);
+    memcached_continuum_cache_free(self);
+    memcached_rendezvous_free(self);
+    memcached_maglev_free(self);
 
     memcached_instance_list_free(memcached_instance_list(self), self->number_of_hosts);
     memcached_instance_set(self, NULL, 0);
@@ -361,6 +398,11 @@ memcached_st *memcached_clone(memcached_st *clone, const memcached_st *source)
   new_clone->on_cleanup= source->on_cleanup;
 
   new_clone->allocators= source->allocators;
+  if (memcached_slab_is_enabled(source) and memcached_failed(memcached_slab_enable(new_clone, true)))
+  {
+    memcached_free(new_clone);
+    return NULL;
+  }
 
   new_clone->get_key_failure= source->get_key_failure;
   new_clone->delete_trigger= source->delete_trigger;
@@ -370,8 +412,14 @@ memcached_st *memcached_clone(memcached_st *clone, const memcached_st *source)
   new_clone->io_bytes_watermark= source->io_bytes_watermark;
   new_clone->io_key_prefetch= source->io_key_prefetch;
   new_clone->number_of_replicas= source->number_of_replicas;
+  new_clone->hedge_read_percentile= source->hedge_read_percentile;
+  new_clone->ketama.ring_64bit_= source->ketama.ring_64bit_;
+  new_clone->bounded_load.epsilon= source->bounded_load.epsilon;
   new_clone->tcp_keepidle= source->tcp_keepidle;
 
+  // The clone routes with the tables source published instead of building its own.
+  memcached_snapshot_join(new_clone, source);
+
   if (memcached_server_count(source))
   {
     if (memcached_failed(memcached_push(new_clone, source)))
@@ -382,6 +430,7 @@ memcached_st *memcached_clone(memcached_st *clone, const memcached_st *source)
 
 
   new_clone->_namespace= memcached_array_clone(new_clone, source->_namespace);
+  memcached_route_install(new_clone);
   new_clone->configure.filename= memcached_array_clone(new_clone, source->_namespace);
   new_clone->configure.version= source->configure.version;
 
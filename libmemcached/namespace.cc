@@ -79,6 +79,7 @@ memcached_return_t memcached_set_namespace(Memcached& memc, const char *key, siz
     memcached_array_free(memc._namespace);
     memc._namespace= NULL;
   }
+  memcached_route_install(&memc);
 
   return MEMCACHED_SUCCESS;
 }
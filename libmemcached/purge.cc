@@ -98,6 +98,11 @@ bool memcached_purge(memcached_instance_st* ptr)
   */
   Purge set_purge(root);
 
+  if (root->batch)
+  {
+    return memcached_batch_purge(*root->batch, ptr);
+  }
+
   WATCHPOINT_ASSERT(ptr->fd != INVALID_SOCKET);
   /* 
     Force a flush of the buffer to ensure that we don't have the n-1 pending
@@ -0,0 +1,304 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+#include <cmath>
+
+static inline uint64_t rendezvous_mix(uint64_t value)
+{
+  value^= value >> 30;
+  value*= 0xbf58476d1ce4e5b9ULL;
+  value^= value >> 27;
+  value*= 0x94d049bb133111ebULL;
+  value^= value >> 31;
+
+  return value;
+}
+
+static uint64_t rendezvous_server_seed(const memcached_instance_st& instance)
+{
+  uint64_t seed= 14695981039346656037ULL;
+  for (const char *ptr= instance._hostname; *ptr; ptr++)
+  {
+    seed^= uint8_t(*ptr);
+    seed*= 1099511628211ULL;
+  }
+  seed^= instance.port();
+  seed*= 1099511628211ULL;
+
+  return rendezvous_mix(seed);
+}
+
+/*
+  With equal weights the order of weight / -ln(u) is the order of u, so
+  uniform levels skip the logarithm and pick the same nodes.
+*/
+static inline double rendezvous_score(const memcached_rendezvous_st *self, uint32_t level,
+                                      uint32_t node, uint64_t key)
+{
+  uint64_t mixed= rendezvous_mix(self->seeds[node] ^ key);
+  double unit= (double(mixed >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+
+  if (self->uniform[level])
+  {
+    return unit;
+  }
+
+  return double(self->weights[node]) / -log(unit);
+}
+
+void memcached_rendezvous_destroy(memcached_st *ptr, memcached_rendezvous_st *self)
+{
+  if (self)
+  {
+    libmemcached_free(ptr, self->seeds);
+    libmemcached_free(ptr, self->weights);
+    libmemcached_free(ptr, self->live);
+    libmemcached_free(ptr, self);
+  }
+}
+
+void memcached_rendezvous_free(memcached_st *ptr)
+{
+  memcached_rendezvous_destroy(ptr, ptr->rendezvous);
+  ptr->rendezvous= NULL;
+}
+
+memcached_return_t memcached_rendezvous_build(memcached_st *ptr)
+{
+  memcached_rendezvous_free(ptr);
+
+  uint32_t server_count= memcached_server_count(ptr);
+  if (server_count == 0)
+  {
+    return MEMCACHED_SUCCESS;
+  }
+
+  time_t now= memcached_clock_now();
+
+  memcached_rendezvous_st *self= libmemcached_xcalloc(ptr, 1, memcached_rendezvous_st);
+  if (self == NULL)
+  {
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+  ptr->rendezvous= self;
+
+  if (ptr->distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON)
+  {
+    self->fanout= MEMCACHED_RENDEZVOUS_SKELETON_FANOUT;
+  }
+  else
+  {
+    self->fanout= server_count > 1 ? server_count : 2;
+  }
+
+  uint32_t nodes= 0;
+  uint32_t width= server_count;
+  self->levels= 0;
+  do
+  {
+    self->offset[self->levels]= nodes;
+    self->width[self->levels]= width;
+    nodes+= width;
+    self->levels++;
+    width= (width + self->fanout -1) / self->fanout;
+  } while (self->width[self->levels -1] > 1 or self->levels == 1);
+
+  self->seeds= libmemcached_xcalloc(ptr, nodes, uint64_t);
+  self->weights= libmemcached_xcalloc(ptr, nodes, uint64_t);
+  self->live= libmemcached_xcalloc(ptr, nodes, uint32_t);
+  if (self->seeds == NULL or self->weights == NULL or self->live == NULL)
+  {
+    memcached_rendezvous_free(ptr);
+    return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+  }
+
+  memcached_instance_st* list= memcached_instance_list(ptr);
+  bool is_auto_ejecting= _is_auto_eject_host(ptr);
+  uint32_t live_servers= server_count;
+
+  if (is_auto_ejecting)
+  {
+    live_servers= 0;
+    ptr->ketama.next_distribution_rebuild= 0;
+    for (uint32_t host_index= 0; host_index < server_count; ++host_index)
+    {
+      if (list[host_index].next_retry <= now)
+      {
+        live_servers++;
+      }
+      else if (ptr->ketama.next_distribution_rebuild == 0 or list[host_index].next_retry < ptr->ketama.next_distribution_rebuild)
+      {
+        ptr->ketama.next_distribution_rebuild= list[host_index].next_retry;
+      }
+    }
+  }
+
+  // With every server ejected keys keep going where they would have gone.
+  for (uint32_t host_index= 0; host_index < server_count; ++host_index)
+  {
+    self->seeds[host_index]= rendezvous_server_seed(list[host_index]);
+    if (live_servers and is_auto_ejecting and list[host_index].next_retry > now)
+    {
+      continue;
+    }
+
+    self->weights[host_index]= list[host_index].weight ? list[host_index].weight : 1;
+    self->live[host_index]= 1;
+  }
+
+  for (uint32_t level= 1; level < self->levels; level++)
+  {
+    for (uint32_t position= 0; position < self->width[level]; position++)
+    {
+      uint32_t node= self->offset[level] + position;
+      self->seeds[node]= rendezvous_mix((uint64_t(level) << 32 | position) ^ 0x5851f42d4c957f2dULL);
+
+      uint32_t first= position * self->fanout;
+      uint32_t last= first + self->fanout;
+      if (last > self->width[level -1])
+      {
+        last= self->width[level -1];
+      }
+
+      for (uint32_t child= first; child < last; child++)
+      {
+        self->weights[node]+= self->weights[self->offset[level -1] + child];
+        self->live[node]+= self->live[self->offset[level -1] + child];
+      }
+    }
+  }
+
+  for (uint32_t level= 0; level < self->levels; level++)
+  {
+    uint64_t weight= 0;
+    self->uniform[level]= true;
+    for (uint32_t position= 0; position < self->width[level]; position++)
+    {
+      uint32_t node= self->offset[level] + position;
+      if (self->live[node] == 0)
+      {
+        continue;
+      }
+
+      if (weight == 0)
+      {
+        weight= self->weights[node];
+      }
+      else if (self->weights[node] != weight)
+      {
+        self->uniform[level]= false;
+        break;
+      }
+    }
+  }
+
+  return MEMCACHED_SUCCESS;
+}
+
+uint32_t memcached_rendezvous_rank(const memcached_rendezvous_st *self, uint32_t hash, uint32_t rank)
+{
+  uint32_t level= self->levels -1;
+  uint32_t position= 0;
+
+  if (self->live[self->offset[level]] == 0)
+  {
+    return 0;
+  }
+  rank%= self->live[self->offset[level]];
+
+  uint64_t key= rendezvous_mix(uint64_t(hash) * 0x9e3779b97f4a7c15ULL + 0x632be59bd9b4e019ULL);
+
+  while (level > 0)
+  {
+    uint32_t first= position * self->fanout;
+    uint32_t last= first + self->fanout;
+    if (last > self->width[level -1])
+    {
+      last= self->width[level -1];
+    }
+
+    // Walk the children best score first, skipping the ones whose live
+    // servers all rank ahead of the one we want.
+    const uint32_t *live= self->live + self->offset[level -1];
+    double previous_score= 0;
+    uint32_t previous= UINT32_MAX;
+    while (true)
+    {
+      double best_score= -1;
+      uint32_t best= UINT32_MAX;
+      for (uint32_t child= first; child < last; child++)
+      {
+        if (live[child] == 0)
+        {
+          continue;
+        }
+
+        double score= rendezvous_score(self, level -1, self->offset[level -1] + child, key);
+        if (previous != UINT32_MAX and (score > previous_score or (not (score < previous_score) and child <= previous)))
+        {
+          continue;
+        }
+
+        if (score > best_score)
+        {
+          best_score= score;
+          best= child;
+        }
+      }
+
+      if (best == UINT32_MAX or rank < live[best])
+      {
+        position= best;
+        break;
+      }
+
+      rank-= live[best];
+      previous= best;
+      previous_score= best_score;
+    }
+
+    if (position == UINT32_MAX)
+    {
+      return 0;
+    }
+    level--;
+  }
+
+  return position;
+}
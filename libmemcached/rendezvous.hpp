@@ -0,0 +1,84 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  Weighted rendezvous (highest random weight) distribution.
+
+  Every server scores each key with weight / -ln(u), u being a uniform hash
+  of the key and the server, and the key goes to the highest score.  Ejecting
+  a server only moves the keys it owned, and the next highest scores give a
+  per key replica order.
+
+  Servers are the leaves of a tree whose inner nodes are scored the same way
+  with the sum of the weights beneath them, and a key descends from the root
+  to the best child at each level.  The flat distribution has a single inner
+  node above all servers, so a lookup scores every server.  The skeleton
+  distribution groups servers MEMCACHED_RENDEZVOUS_SKELETON_FANOUT at a time,
+  which makes a lookup O(log n) in exchange for moving a few more keys when
+  servers come and go.
+
+  Replica r of a key is the r-th leaf of a depth first walk that visits the
+  children of each node best score first; replica 0 is the plain descent.
+*/
+#define MEMCACHED_RENDEZVOUS_SKELETON_FANOUT 8
+#define MEMCACHED_RENDEZVOUS_MAX_LEVELS 16
+
+struct memcached_rendezvous_st
+{
+  uint32_t fanout;
+  uint32_t levels; // Leaves are level 0, the root is levels -1
+  uint32_t offset[MEMCACHED_RENDEZVOUS_MAX_LEVELS];
+  uint32_t width[MEMCACHED_RENDEZVOUS_MAX_LEVELS];
+  bool uniform[MEMCACHED_RENDEZVOUS_MAX_LEVELS]; // All live nodes weigh the same
+  uint64_t *seeds;
+  uint64_t *weights; // Sum of the live server weights beneath each node
+  uint32_t *live; // Live servers beneath each node
+};
+
+#ifdef __cplusplus
+
+memcached_return_t memcached_rendezvous_build(memcached_st *ptr);
+
+void memcached_rendezvous_free(memcached_st *ptr);
+
+void memcached_rendezvous_destroy(memcached_st *ptr, memcached_rendezvous_st *self);
+
+uint32_t memcached_rendezvous_rank(const memcached_rendezvous_st *self, uint32_t hash, uint32_t rank);
+
+#endif
@@ -493,6 +493,43 @@ static memcached_return_t textual_read_one_response(memcached_instance_st* insta
                              buffer, total_read);
 }
 
+memcached_return_t memcached_binary_status(const uint16_t status)
+{
+  switch (status)
+  {
+  case PROTOCOL_BINARY_RESPONSE_SUCCESS:
+    return MEMCACHED_SUCCESS;
+
+  case PROTOCOL_BINARY_RESPONSE_KEY_ENOENT:
+    return MEMCACHED_NOTFOUND;
+
+  case PROTOCOL_BINARY_RESPONSE_KEY_EEXISTS:
+    return MEMCACHED_DATA_EXISTS;
+
+  case PROTOCOL_BINARY_RESPONSE_NOT_STORED:
+    return MEMCACHED_NOTSTORED;
+
+  case PROTOCOL_BINARY_RESPONSE_E2BIG:
+    return MEMCACHED_E2BIG;
+
+  case PROTOCOL_BINARY_RESPONSE_ENOMEM:
+    return MEMCACHED_MEMORY_ALLOCATION_FAILURE;
+
+  case PROTOCOL_BINARY_RESPONSE_AUTH_CONTINUE:
+    return MEMCACHED_AUTH_CONTINUE;
+
+  case PROTOCOL_BINARY_RESPONSE_AUTH_ERROR:
+    return MEMCACHED_AUTH_FAILURE;
+
+  case PROTOCOL_BINARY_RESPONSE_EINVAL:
+  case PROTOCOL_BINARY_RESPONSE_UNKNOWN_COMMAND:
+  default:
+    break;
+  }
+
+  return MEMCACHED_UNKNOWN_READ_FAILURE;
+}
+
 static memcached_return_t binary_read_one_response(memcached_instance_st* instance,
                                                    char *buffer, const size_t buffer_length,
                                                    memcached_result_st *result)
@@ -792,41 +829,9 @@ static memcached_return_t binary_read_one_response(memcached_instance_st* instan
   rc= MEMCACHED_SUCCESS;
   if (header.response.status != 0)
   {
-    switch (header.response.status)
+    if ((rc= memcached_binary_status(header.response.status)) == MEMCACHED_UNKNOWN_READ_FAILURE)
     {
-    case PROTOCOL_BINARY_RESPONSE_KEY_ENOENT:
-      rc= MEMCACHED_NOTFOUND;
-      break;
-
-    case PROTOCOL_BINARY_RESPONSE_KEY_EEXISTS:
-      rc= MEMCACHED_DATA_EXISTS;
-      break;
-
-    case PROTOCOL_BINARY_RESPONSE_NOT_STORED:
-      rc= MEMCACHED_NOTSTORED;
-      break;
-
-    case PROTOCOL_BINARY_RESPONSE_E2BIG:
-      rc= MEMCACHED_E2BIG;
-      break;
-
-    case PROTOCOL_BINARY_RESPONSE_ENOMEM:
-      rc= MEMCACHED_MEMORY_ALLOCATION_FAILURE;
-      break;
-
-    case PROTOCOL_BINARY_RESPONSE_AUTH_CONTINUE:
-      rc= MEMCACHED_AUTH_CONTINUE;
-      break;
-
-    case PROTOCOL_BINARY_RESPONSE_AUTH_ERROR:
-      rc= MEMCACHED_AUTH_FAILURE;
-      break;
-
-    case PROTOCOL_BINARY_RESPONSE_EINVAL:
-    case PROTOCOL_BINARY_RESPONSE_UNKNOWN_COMMAND:
-    default:
       return memcached_set_error(*instance, MEMCACHED_UNKNOWN_READ_FAILURE, MEMCACHED_AT);
-      break;
     }
   }
 
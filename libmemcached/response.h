@@ -47,3 +47,6 @@ memcached_return_t memcached_response(memcached_instance_st* ptr,
 memcached_return_t memcached_response(memcached_instance_st* ptr,
                                       char *buffer, size_t buffer_length,
                                       memcached_result_st *result);
+
+/* Map the status field of a binary protocol response header */
+memcached_return_t memcached_binary_status(const uint16_t status);
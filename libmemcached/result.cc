@@ -66,10 +66,19 @@ memcached_result_st *memcached_result_create(const memcached_st *shell,
   if (ptr)
   {
     ptr->options.is_allocated= false;
+    ptr->options.is_slab= false;
   }
   else
   {
-    ptr= libmemcached_xmalloc(memc, memcached_result_st);
+    bool is_slab= memcached_slab_is_enabled(memc);
+    if (is_slab)
+    {
+      ptr= (memcached_result_st *)memcached_slab_alloc(memc, sizeof(memcached_result_st));
+    }
+    else
+    {
+      ptr= libmemcached_xmalloc(memc, memcached_result_st);
+    }
 
     if (not ptr)
     {
@@ -77,6 +86,7 @@ memcached_result_st *memcached_result_create(const memcached_st *shell,
     }
 
     ptr->options.is_allocated= true;
+    ptr->options.is_slab= is_slab;
   }
 
   ptr->options.is_initialized= true;
@@ -87,6 +97,7 @@ memcached_result_st *memcached_result_create(const memcached_st *shell,
   memcached_string_create((memcached_st*)memc, &ptr->value, 0);
   WATCHPOINT_ASSERT_INITIALIZED(&ptr->value);
   WATCHPOINT_ASSERT(ptr->value.string == NULL);
+  memcached_string_set_inline(ptr->value, ptr->item_value, sizeof(ptr->item_value));
 
   return ptr;
 }
@@ -114,7 +125,14 @@ void memcached_result_free(memcached_result_st *ptr)
   if (memcached_is_allocated(ptr))
   {
     WATCHPOINT_ASSERT(ptr->root); // Without a root, that means that result was not properly initialized.
-    libmemcached_free(ptr->root, ptr);
+    if (ptr->options.is_slab)
+    {
+      memcached_slab_free(ptr->root, ptr, sizeof(memcached_result_st));
+    }
+    else
+    {
+      libmemcached_free(ptr->root, ptr);
+    }
   }
   else
   {
@@ -165,7 +183,15 @@ size_t memcached_result_length(const memcached_result_st *self)
 char *memcached_result_take_value(memcached_result_st *self)
 {
   memcached_string_st *sptr= &self->value;
-  return memcached_string_take_value(sptr);
+  char *value= memcached_string_take_value(sptr);
+
+  // A buffer that was handed over leaves the small values to item_value again.
+  if (memcached_string_value(sptr) == NULL)
+  {
+    memcached_string_set_inline(*sptr, self->item_value, sizeof(self->item_value));
+  }
+
+  return value;
 }
 
 uint32_t memcached_result_flags(const memcached_result_st *self)
@@ -233,6 +233,17 @@ in_port_t memcached_server_srcport(const memcached_instance_st * self)
   return -1;
 }
 
+memcached_socket_t memcached_server_fd(const memcached_instance_st * self)
+{
+  WATCHPOINT_ASSERT(self);
+  if (self == NULL)
+  {
+    return INVALID_SOCKET;
+  }
+
+  return self->fd;
+}
+
 uint32_t memcached_server_response_count(const memcached_instance_st * self)
 {
   WATCHPOINT_ASSERT(self);
@@ -37,10 +37,6 @@
 
 #pragma once
 
-#ifdef HAVE_SYS_TIME_H
-#include <sys/time.h>
-#endif
-
 #include <cassert>
 
 memcached_server_st *__server_create_with(memcached_st *memc,
@@ -84,15 +80,7 @@ static inline void memcached_mark_server_for_timeout(memcached_instance_st* serv
 
     if (server->server_timeout_counter >= server->root->server_timeout_limit)
     {
-      struct timeval next_time;
-      if (gettimeofday(&next_time, NULL) == 0)
-      {
-        server->next_retry= next_time.tv_sec +server->root->retry_timeout;
-      }
-      else
-      {
-        server->next_retry= 1; // Setting the value to 1 causes the timeout to occur immediatly
-      }
+      server->next_retry= memcached_clock_now() +server->root->retry_timeout;
 
       server->state= MEMCACHED_SERVER_STATE_IN_TIMEOUT;
       if (server->server_failure_counter_query_id != server->root->query_id)
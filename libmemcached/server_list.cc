@@ -130,8 +130,10 @@ uint32_t memcached_instance_list_count(const memcached_st* self)
 void memcached_instance_set(memcached_st* memc, memcached_instance_st* list, const uint32_t host_list_size)
 {
   assert(memc);
+  uint32_t carried= memc->number_of_hosts < host_list_size ? memc->number_of_hosts : host_list_size;
   memc->servers= list;
   memc->number_of_hosts= host_list_size;
+  memcached_instance_relink(memc, carried);
 }
 
 void memcached_server_list_free(memcached_server_list_st self)
@@ -0,0 +1,277 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+/* Callers have checked size against MEMCACHED_SLAB_MAX_SIZE, so it fits 32 bits. */
+static inline uint32_t slab_class(size_t size)
+{
+  if (size <= MEMCACHED_SLAB_MIN_SIZE)
+  {
+    return 0;
+  }
+
+  uint32_t value= uint32_t(size -1);
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanReverse(&index, (unsigned long)value);
+  uint32_t bits= uint32_t(index) +1;
+#elif defined(__GNUC__)
+  uint32_t bits= 32 - uint32_t(__builtin_clz(value));
+#else
+  uint32_t bits= 0;
+  while (value)
+  {
+    value>>= 1;
+    bits++;
+  }
+#endif
+
+  return bits - MEMCACHED_SLAB_MIN_SHIFT;
+}
+
+static inline size_t slab_class_size(uint32_t size_class)
+{
+  return MEMCACHED_SLAB_MIN_SIZE << size_class;
+}
+
+/*
+  Hands whatever is left of the newest page to the largest classes it fits,
+  so switching pages only wastes less than the smallest block.
+*/
+static void slab_retire_page(memcached_slab_st *slab)
+{
+  for (uint32_t size_class= MEMCACHED_SLAB_CLASSES; size_class-- > 0; )
+  {
+    size_t block= slab_class_size(size_class);
+    while (slab->remaining >= block)
+    {
+      *(void **)slab->cursor= slab->free[size_class];
+      slab->free[size_class]= slab->cursor;
+      slab->cursor+= block;
+      slab->remaining-= block;
+    }
+  }
+}
+
+static void *slab_carve(const memcached_st *ptr, memcached_slab_st *slab, uint32_t size_class)
+{
+  size_t block= slab_class_size(size_class);
+
+  if (slab->remaining < block)
+  {
+    slab_retire_page(slab);
+
+    // Pages are aligned like malloc(), the header keeps blocks 16 byte aligned.
+    size_t header= (sizeof(memcached_slab_page_st) +15) & ~size_t(15);
+    size_t page_size= MEMCACHED_SLAB_PAGE_SIZE;
+    if (page_size < header +block)
+    {
+      page_size= header +block;
+    }
+
+    memcached_slab_page_st *page= (memcached_slab_page_st *)libmemcached_malloc(ptr, page_size);
+    if (page == NULL)
+    {
+      return NULL;
+    }
+    page->next= slab->pages;
+    page->size= page_size;
+    slab->pages= page;
+    slab->cursor= (char *)page +header;
+    slab->remaining= page_size -header;
+    slab->stat.pages++;
+    slab->stat.reserved+= page_size;
+  }
+
+  void *mem= slab->cursor;
+  slab->cursor+= block;
+  slab->remaining-= block;
+
+  return mem;
+}
+
+memcached_return_t memcached_slab_enable(memcached_st *ptr, bool enable)
+{
+  if (ptr->slab == NULL)
+  {
+    if (enable == false)
+    {
+      return MEMCACHED_SUCCESS;
+    }
+
+    if ((ptr->slab= libmemcached_xcalloc(ptr, 1, memcached_slab_st)) == NULL)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+  }
+
+  // Blocks already handed out keep going back to the slab when disabled.
+  ptr->slab->is_enabled= enable;
+
+  return MEMCACHED_SUCCESS;
+}
+
+void memcached_slab_destroy(memcached_st *ptr)
+{
+  memcached_slab_st *slab= ptr->slab;
+  if (slab)
+  {
+    while (slab->pages)
+    {
+      memcached_slab_page_st *next= slab->pages->next;
+      libmemcached_free(ptr, slab->pages);
+      slab->pages= next;
+    }
+    libmemcached_free(ptr, slab);
+    ptr->slab= NULL;
+  }
+}
+
+void *memcached_slab_alloc(const memcached_st *ptr, size_t size)
+{
+  memcached_slab_st *slab= ptr->slab;
+
+  if (size > MEMCACHED_SLAB_MAX_SIZE)
+  {
+    slab->stat.large_allocations++;
+    return libmemcached_malloc(ptr, size);
+  }
+
+  uint32_t size_class= slab_class(size);
+  void *mem= slab->free[size_class];
+  if (mem)
+  {
+    slab->free[size_class]= *(void **)mem;
+  }
+  else if ((mem= slab_carve(ptr, slab, size_class)) == NULL)
+  {
+    return NULL;
+  }
+
+  slab->stat.allocations++;
+  slab->stat.in_use+= slab_class_size(size_class);
+  slab->stat.requested+= size;
+  if (slab->stat.in_use > slab->stat.high_water)
+  {
+    slab->stat.high_water= slab->stat.in_use;
+  }
+
+  return mem;
+}
+
+void memcached_slab_free(const memcached_st *ptr, void *mem, size_t size)
+{
+  if (mem == NULL)
+  {
+    return;
+  }
+
+  if (size > MEMCACHED_SLAB_MAX_SIZE)
+  {
+    libmemcached_free(ptr, mem);
+    return;
+  }
+
+  memcached_slab_st *slab= ptr->slab;
+  uint32_t size_class= slab_class(size);
+  *(void **)mem= slab->free[size_class];
+  slab->free[size_class]= mem;
+
+  slab->stat.frees++;
+  slab->stat.in_use-= slab_class_size(size_class);
+  slab->stat.requested-= size;
+}
+
+void *memcached_slab_realloc(const memcached_st *ptr, void *mem, size_t old_size, size_t new_size)
+{
+  if (mem == NULL)
+  {
+    return memcached_slab_alloc(ptr, new_size);
+  }
+
+  if (old_size > MEMCACHED_SLAB_MAX_SIZE and new_size > MEMCACHED_SLAB_MAX_SIZE)
+  {
+    return libmemcached_xrealloc(ptr, mem, new_size, char);
+  }
+
+  if (old_size <= MEMCACHED_SLAB_MAX_SIZE and new_size <= MEMCACHED_SLAB_MAX_SIZE and
+      slab_class(old_size) == slab_class(new_size))
+  {
+    ptr->slab->stat.requested+= new_size;
+    ptr->slab->stat.requested-= old_size;
+    return mem;
+  }
+
+  void *new_mem= memcached_slab_alloc(ptr, new_size);
+  if (new_mem == NULL)
+  {
+    return NULL;
+  }
+  memcpy(new_mem, mem, old_size < new_size ? old_size : new_size);
+  memcached_slab_free(ptr, mem, old_size);
+
+  return new_mem;
+}
+
+memcached_return_t memcached_slab_stat(const memcached_st *shell, memcached_slab_stat_st *stat)
+{
+  const Memcached* ptr= memcached2Memcached(shell);
+  if (ptr == NULL or stat == NULL)
+  {
+    return MEMCACHED_INVALID_ARGUMENTS;
+  }
+
+  if (ptr->slab == NULL)
+  {
+    memset(stat, 0, sizeof(memcached_slab_stat_st));
+    return MEMCACHED_SUCCESS;
+  }
+
+  *stat= ptr->slab->stat;
+  stat->fragmentation= 0;
+  if (stat->reserved)
+  {
+    stat->fragmentation= double(stat->reserved - stat->requested) / double(stat->reserved);
+  }
+
+  return MEMCACHED_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  Slab allocator for result objects and string buffers.
+
+  With MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR set a handle keeps free lists of
+  power of two size classes, from MEMCACHED_SLAB_MIN_SIZE up to
+  MEMCACHED_SLAB_MAX_SIZE, carved out of pages it gets from its allocators.
+  A freed block goes back on its class list and is handed out again without
+  calling the allocators; pages are only given back when the handle is
+  freed.  Larger requests go to the allocators as before.
+
+  The slab belongs to the handle and a handle is only used by one thread at
+  a time, so it takes no locks. It is not a per-thread cache: results made
+  from the handle go back to its free lists, so they have to be freed on the
+  thread using the handle, before it is handed to another one. Pool release
+  asserts that nothing is left in use. The handle's own result never takes
+  slab memory, so in use is exactly what callers hold. A pool created with
+  memcached_pool_create_sharded() keeps each handle, and its slab, with the
+  thread that last used it.
+
+  Blocks carry no header, the caller passes the size it asked for back in
+  on free, and objects remember whether their memory came from the slab.
+*/
+#define MEMCACHED_SLAB_MIN_SHIFT 5
+#define MEMCACHED_SLAB_MIN_SIZE (size_t(1) << MEMCACHED_SLAB_MIN_SHIFT)
+#define MEMCACHED_SLAB_CLASSES 12
+#define MEMCACHED_SLAB_MAX_SIZE (MEMCACHED_SLAB_MIN_SIZE << (MEMCACHED_SLAB_CLASSES -1))
+#define MEMCACHED_SLAB_PAGE_SIZE (size_t(128) * 1024)
+
+struct memcached_slab_page_st
+{
+  struct memcached_slab_page_st *next;
+  size_t size;
+};
+
+struct memcached_slab_st
+{
+  bool is_enabled;
+  void *free[MEMCACHED_SLAB_CLASSES];
+  char *cursor; // Uncarved part of the newest page
+  size_t remaining;
+  struct memcached_slab_page_st *pages;
+  struct memcached_slab_stat_st stat;
+};
+
+#ifdef __cplusplus
+
+static inline bool memcached_slab_is_enabled(const memcached_st *ptr)
+{
+  return ptr->slab and ptr->slab->is_enabled;
+}
+
+memcached_return_t memcached_slab_enable(memcached_st *ptr, bool enable);
+
+void memcached_slab_destroy(memcached_st *ptr);
+
+void *memcached_slab_alloc(const memcached_st *ptr, size_t size);
+
+void *memcached_slab_realloc(const memcached_st *ptr, void *mem, size_t old_size, size_t new_size);
+
+void memcached_slab_free(const memcached_st *ptr, void *mem, size_t size);
+
+#endif
@@ -0,0 +1,550 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libmemcached/common.h>
+
+#include "libmemcached/lock.hpp"
+
+enum snapshot_kind_t {
+  SNAPSHOT_NONE,
+  SNAPSHOT_KETAMA,
+  SNAPSHOT_RENDEZVOUS,
+  SNAPSHOT_MAGLEV
+};
+
+struct memcached_snapshot_server_st
+{
+  const char *hostname;
+  in_port_t port;
+  uint32_t weight;
+};
+
+struct memcached_snapshot_st
+{
+  uint32_t refcount; // Guarded by the slot's lock
+
+  // What the tables were built from
+  memcached_server_distribution_t distribution;
+  bool is_weighted;
+  bool is_64bit;
+  hashkit_hash_fn function;
+  void *context;
+  struct memcached_allocator_t allocators;
+  uint32_t server_count;
+  memcached_snapshot_server_st *servers;
+
+  // The tables, read only once published
+  uint32_t continuum_points_counter;
+  memcached_continuum_lookup_st *lookup;
+  memcached_continuum_cache_st *cache;
+  memcached_rendezvous_st *rendezvous;
+  memcached_maglev_st *maglev;
+};
+
+struct memcached_snapshot_slot_st
+{
+  memcached_lock_t lock;
+  uint32_t refcount;
+  memcached_snapshot_st *current;
+};
+
+static snapshot_kind_t snapshot_kind(memcached_server_distribution_t distribution)
+{
+  switch (distribution)
+  {
+  case MEMCACHED_DISTRIBUTION_CONSISTENT:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_WEIGHTED:
+    return SNAPSHOT_KETAMA;
+
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON:
+    return SNAPSHOT_RENDEZVOUS;
+
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV:
+    return SNAPSHOT_MAGLEV;
+
+  case MEMCACHED_DISTRIBUTION_MODULA:
+  case MEMCACHED_DISTRIBUTION_RANDOM:
+  case MEMCACHED_DISTRIBUTION_VIRTUAL_BUCKET:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP:
+  case MEMCACHED_DISTRIBUTION_CONSISTENT_MAX:
+    break;
+  }
+
+  return SNAPSHOT_NONE;
+}
+
+static inline void snapshot_lock(memcached_snapshot_slot_st *slot)
+{
+  memcached_lock(slot->lock);
+}
+
+static inline void snapshot_unlock(memcached_snapshot_slot_st *slot)
+{
+  memcached_unlock(slot->lock);
+}
+
+static inline bool snapshot_same_allocators(const memcached_st *ptr, const memcached_snapshot_st *snapshot)
+{
+  return ptr->allocators.calloc == snapshot->allocators.calloc and
+         ptr->allocators.free == snapshot->allocators.free and
+         ptr->allocators.malloc == snapshot->allocators.malloc and
+         ptr->allocators.realloc == snapshot->allocators.realloc and
+         ptr->allocators.context == snapshot->allocators.context;
+}
+
+/* Only tables built with every server live are worth sharing. */
+static bool snapshot_is_settled(const memcached_st *ptr)
+{
+  if (memcached_server_count(ptr) == 0 or snapshot_kind(ptr->distribution) == SNAPSHOT_NONE)
+  {
+    return false;
+  }
+
+  if (_is_auto_eject_host(ptr) == false)
+  {
+    return true;
+  }
+
+  time_t now= memcached_clock_now();
+
+  const memcached_instance_st* list= memcached_instance_list(ptr);
+  for (uint32_t host_index= 0; host_index < memcached_server_count(ptr); ++host_index)
+  {
+    if (list[host_index].next_retry > now)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static bool snapshot_matches(const memcached_st *ptr, const memcached_snapshot_st *snapshot)
+{
+  if (snapshot->distribution != ptr->distribution or
+      snapshot->is_weighted != memcached_is_weighted_ketama(ptr) or
+      snapshot->is_64bit != memcached_is_64bit_ketama(ptr) or
+      snapshot->function != ptr->hashkit.base_hash.function or
+      snapshot->context != ptr->hashkit.base_hash.context or
+      snapshot->server_count != memcached_server_count(ptr) or
+      snapshot_same_allocators(ptr, snapshot) == false)
+  {
+    return false;
+  }
+
+  const memcached_instance_st* list= memcached_instance_list(ptr);
+  for (uint32_t host_index= 0; host_index < snapshot->server_count; ++host_index)
+  {
+    const memcached_snapshot_server_st& server= snapshot->servers[host_index];
+    if (server.port != list[host_index].port() or
+        server.weight != list[host_index].weight or
+        strcmp(server.hostname, list[host_index]._hostname))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void snapshot_destroy(memcached_st *ptr, memcached_snapshot_st *snapshot)
+{
+  libmemcached_free(ptr, snapshot->lookup);
+  memcached_continuum_cache_destroy(ptr, snapshot->cache);
+  memcached_rendezvous_destroy(ptr, snapshot->rendezvous);
+  memcached_maglev_destroy(ptr, snapshot->maglev);
+  libmemcached_free(ptr, snapshot->servers);
+  libmemcached_free(ptr, snapshot);
+}
+
+/* Called with the slot locked, returns true if the caller has to destroy it. */
+static inline bool snapshot_unref(memcached_snapshot_st *snapshot)
+{
+  return --snapshot->refcount == 0;
+}
+
+/* Points the tables of ptr at snapshot, without taking a reference. */
+static void snapshot_view(memcached_st *ptr, const memcached_snapshot_st *snapshot)
+{
+  switch (snapshot_kind(snapshot->distribution))
+  {
+  case SNAPSHOT_KETAMA:
+    ptr->ketama.continuum_points_counter= snapshot->continuum_points_counter;
+    ptr->ketama.lookup= snapshot->lookup;
+    ptr->ketama.cache= snapshot->cache;
+    break;
+
+  case SNAPSHOT_RENDEZVOUS:
+    ptr->rendezvous= snapshot->rendezvous;
+    break;
+
+  case SNAPSHOT_MAGLEV:
+    ptr->maglev= snapshot->maglev;
+    break;
+
+  case SNAPSHOT_NONE:
+    break;
+  }
+}
+
+static void snapshot_unview(memcached_st *ptr, const memcached_snapshot_st *snapshot)
+{
+  switch (snapshot_kind(snapshot->distribution))
+  {
+  case SNAPSHOT_KETAMA:
+    ptr->ketama.continuum_points_counter= 0;
+    ptr->ketama.lookup= NULL;
+    ptr->ketama.cache= NULL;
+    break;
+
+  case SNAPSHOT_RENDEZVOUS:
+    ptr->rendezvous= NULL;
+    break;
+
+  case SNAPSHOT_MAGLEV:
+    ptr->maglev= NULL;
+    break;
+
+  case SNAPSHOT_NONE:
+    break;
+  }
+}
+
+/* Frees the private tables ptr would route with for its distribution. */
+static void snapshot_free_private(memcached_st *ptr)
+{
+  switch (snapshot_kind(ptr->distribution))
+  {
+  case SNAPSHOT_KETAMA:
+    libmemcached_free(ptr, ptr->ketama.continuum);
+    ptr->ketama.continuum= NULL;
+    ptr->ketama.continuum_count= 0;
+    ptr->ketama.continuum_points_counter= 0;
+    memcached_continuum_lookup_free(ptr);
+    memcached_continuum_cache_free(ptr);
+    break;
+
+  case SNAPSHOT_RENDEZVOUS:
+    memcached_rendezvous_free(ptr);
+    break;
+
+  case SNAPSHOT_MAGLEV:
+    memcached_maglev_free(ptr);
+    break;
+
+  case SNAPSHOT_NONE:
+    break;
+  }
+}
+
+void memcached_snapshot_release(memcached_st *ptr)
+{
+  memcached_snapshot_st *snapshot= ptr->snapshot;
+  if (snapshot == NULL)
+  {
+    return;
+  }
+
+  snapshot_unview(ptr, snapshot);
+  ptr->snapshot= NULL;
+
+  snapshot_lock(ptr->snapshot_slot);
+  bool is_last= snapshot_unref(snapshot);
+  snapshot_unlock(ptr->snapshot_slot);
+
+  if (is_last)
+  {
+    snapshot_destroy(ptr, snapshot);
+  }
+}
+
+bool memcached_snapshot_adopt(memcached_st *ptr)
+{
+  memcached_snapshot_slot_st *slot= ptr->snapshot_slot;
+  if (slot == NULL or snapshot_is_settled(ptr) == false)
+  {
+    return false;
+  }
+
+  snapshot_lock(slot);
+  memcached_snapshot_st *snapshot= slot->current;
+  if (snapshot == NULL or snapshot_matches(ptr, snapshot) == false)
+  {
+    snapshot_unlock(slot);
+    return false;
+  }
+
+  if (snapshot == ptr->snapshot)
+  {
+    snapshot_unlock(slot);
+    ptr->ketama.next_distribution_rebuild= 0;
+    return true;
+  }
+  snapshot->refcount++;
+  snapshot_unlock(slot);
+
+  memcached_snapshot_release(ptr);
+  snapshot_free_private(ptr);
+
+  ptr->snapshot= snapshot;
+  snapshot_view(ptr, snapshot);
+  ptr->ketama.next_distribution_rebuild= 0;
+
+  return true;
+}
+
+memcached_return_t memcached_snapshot_detach(memcached_st *ptr)
+{
+  memcached_snapshot_st *snapshot= ptr->snapshot;
+  if (snapshot == NULL)
+  {
+    return MEMCACHED_SUCCESS;
+  }
+
+  // Nobody else routes with it, so take it back from the slot as it is.
+  memcached_snapshot_slot_st *slot= ptr->snapshot_slot;
+  snapshot_lock(slot);
+  bool is_only_user= snapshot->refcount == (slot->current == snapshot ? 2U : 1U);
+  if (is_only_user)
+  {
+    if (slot->current == snapshot)
+    {
+      slot->current= NULL;
+    }
+    snapshot->refcount= 0;
+  }
+  snapshot_unlock(slot);
+
+  ptr->snapshot= NULL;
+  if (is_only_user)
+  {
+    snapshot->lookup= NULL;
+    snapshot->cache= NULL;
+    snapshot->rendezvous= NULL;
+    snapshot->maglev= NULL;
+    snapshot_destroy(ptr, snapshot);
+
+    return MEMCACHED_SUCCESS;
+  }
+
+  // The rendezvous and maglev tables are built from scratch anyway, only
+  // the ketama lookup table and its point cache get patched.
+  snapshot_unview(ptr, snapshot);
+  memcached_return_t rc= MEMCACHED_SUCCESS;
+  if (snapshot->cache)
+  {
+    ptr->ketama.lookup= memcached_continuum_lookup_clone(ptr, snapshot->lookup);
+    ptr->ketama.cache= memcached_continuum_cache_clone(ptr, snapshot->cache);
+    if (ptr->ketama.lookup == NULL or ptr->ketama.cache == NULL)
+    {
+      memcached_continuum_lookup_free(ptr);
+      memcached_continuum_cache_free(ptr);
+      rc= memcached_set_error(*ptr, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    }
+    else
+    {
+      ptr->ketama.continuum_points_counter= snapshot->continuum_points_counter;
+    }
+  }
+
+  snapshot_lock(slot);
+  bool is_last= snapshot_unref(snapshot);
+  snapshot_unlock(slot);
+
+  if (is_last)
+  {
+    snapshot_destroy(ptr, snapshot);
+  }
+
+  return rc;
+}
+
+void memcached_snapshot_publish(memcached_st *ptr)
+{
+  if (ptr->snapshot or snapshot_is_settled(ptr) == false)
+  {
+    return;
+  }
+
+  snapshot_kind_t kind= snapshot_kind(ptr->distribution);
+  if ((kind == SNAPSHOT_KETAMA and (ptr->ketama.lookup == NULL or ptr->ketama.cache == NULL)) or
+      (kind == SNAPSHOT_RENDEZVOUS and ptr->rendezvous == NULL) or
+      (kind == SNAPSHOT_MAGLEV and ptr->maglev == NULL))
+  {
+    return;
+  }
+
+  if (ptr->snapshot_slot == NULL)
+  {
+    memcached_snapshot_slot_st *slot= libmemcached_xcalloc(ptr, 1, memcached_snapshot_slot_st);
+    if (slot == NULL)
+    {
+      return;
+    }
+
+    if (memcached_lock_init(slot->lock) == false)
+    {
+      libmemcached_free(ptr, slot);
+      return;
+    }
+    slot->refcount= 1;
+    ptr->snapshot_slot= slot;
+  }
+
+  // The server list and its hostnames go in one allocation.
+  const memcached_instance_st* list= memcached_instance_list(ptr);
+  uint32_t server_count= memcached_server_count(ptr);
+  size_t length= server_count * sizeof(memcached_snapshot_server_st);
+  for (uint32_t host_index= 0; host_index < server_count; ++host_index)
+  {
+    length+= strlen(list[host_index]._hostname) +1;
+  }
+
+  memcached_snapshot_st *snapshot= libmemcached_xcalloc(ptr, 1, memcached_snapshot_st);
+  memcached_snapshot_server_st *servers= (memcached_snapshot_server_st *)libmemcached_malloc(ptr, length);
+  if (snapshot == NULL or servers == NULL)
+  {
+    libmemcached_free(ptr, snapshot);
+    libmemcached_free(ptr, servers);
+    return;
+  }
+
+  char *hostnames= (char *)(servers +server_count);
+  for (uint32_t host_index= 0; host_index < server_count; ++host_index)
+  {
+    size_t hostname_length= strlen(list[host_index]._hostname) +1;
+    memcpy(hostnames, list[host_index]._hostname, hostname_length);
+    servers[host_index].hostname= hostnames;
+    servers[host_index].port= list[host_index].port();
+    servers[host_index].weight= list[host_index].weight;
+    hostnames+= hostname_length;
+  }
+
+  snapshot->distribution= ptr->distribution;
+  snapshot->is_weighted= memcached_is_weighted_ketama(ptr);
+  snapshot->is_64bit= memcached_is_64bit_ketama(ptr);
+  snapshot->function= ptr->hashkit.base_hash.function;
+  snapshot->context= ptr->hashkit.base_hash.context;
+  snapshot->allocators= ptr->allocators;
+  snapshot->server_count= server_count;
+  snapshot->servers= servers;
+
+  // The tables move over as they are, ptr keeps routing with them.
+  switch (kind)
+  {
+  case SNAPSHOT_KETAMA:
+    snapshot->continuum_points_counter= ptr->ketama.continuum_points_counter;
+    snapshot->lookup= ptr->ketama.lookup;
+    snapshot->cache= ptr->ketama.cache;
+    break;
+
+  case SNAPSHOT_RENDEZVOUS:
+    snapshot->rendezvous= ptr->rendezvous;
+    break;
+
+  case SNAPSHOT_MAGLEV:
+    snapshot->maglev= ptr->maglev;
+    break;
+
+  case SNAPSHOT_NONE:
+    break;
+  }
+  snapshot->refcount= 2; // ptr and the slot
+  ptr->snapshot= snapshot;
+
+  memcached_snapshot_slot_st *slot= ptr->snapshot_slot;
+  snapshot_lock(slot);
+  memcached_snapshot_st *previous= slot->current;
+  slot->current= snapshot;
+  bool is_last= previous and snapshot_unref(previous);
+  snapshot_unlock(slot);
+
+  if (is_last)
+  {
+    snapshot_destroy(ptr, previous);
+  }
+}
+
+void memcached_snapshot_join(memcached_st *clone, const memcached_st *source)
+{
+  memcached_snapshot_slot_st *slot= source->snapshot_slot;
+  if (slot == NULL or clone->snapshot_slot)
+  {
+    return;
+  }
+
+  snapshot_lock(slot);
+  slot->refcount++;
+  snapshot_unlock(slot);
+  clone->snapshot_slot= slot;
+}
+
+void memcached_snapshot_free(memcached_st *ptr)
+{
+  memcached_snapshot_release(ptr);
+
+  memcached_snapshot_slot_st *slot= ptr->snapshot_slot;
+  if (slot == NULL)
+  {
+    return;
+  }
+  ptr->snapshot_slot= NULL;
+
+  memcached_snapshot_st *current= NULL;
+  snapshot_lock(slot);
+  bool is_last= --slot->refcount == 0;
+  if (is_last)
+  {
+    current= slot->current;
+    slot->current= NULL;
+  }
+  snapshot_unlock(slot);
+
+  if (is_last)
+  {
+    // Every handle routing with it held the slot as well.
+    if (current and snapshot_unref(current))
+    {
+      snapshot_destroy(ptr, current);
+    }
+    memcached_lock_destroy(slot->lock);
+    libmemcached_free(ptr, slot);
+  }
+}
@@ -0,0 +1,77 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+/*
+  Shared distribution snapshots.
+
+  The tables a distribution routes with (the ketama lookup table and its
+  point cache, the rendezvous tree or the maglev table) only depend on the
+  server list, the distribution and the hash.  Once a handle
+  has built them with every server live it publishes them as a reference
+  counted, read only snapshot in a slot it shares with its clones, and a
+  handle that needs tables for the same configuration takes a reference to
+  the published snapshot instead of hashing every server again.  A handle
+  rebuilding after a configuration change publishes its snapshot in place of
+  the old one, which is released by whoever drops the last reference to it.
+
+  A handle holding a snapshot never changes its tables; it detaches first,
+  taking a private copy of what it is about to patch.  Handles with ejected
+  servers keep private tables.
+*/
+
+#ifdef __cplusplus
+
+/* Routes ptr with the published snapshot if it matches, returns false otherwise. */
+bool memcached_snapshot_adopt(memcached_st *ptr);
+
+/* Gives ptr private tables it may change. */
+memcached_return_t memcached_snapshot_detach(memcached_st *ptr);
+
+/* Publishes the tables ptr has just built. */
+void memcached_snapshot_publish(memcached_st *ptr);
+
+/* Drops the snapshot ptr routes with, leaving it without tables. */
+void memcached_snapshot_release(memcached_st *ptr);
+
+/* Shares the publication slot of source with clone. */
+void memcached_snapshot_join(memcached_st *clone, const memcached_st *source);
+
+void memcached_snapshot_free(memcached_st *ptr);
+
+#endif
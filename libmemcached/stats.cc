@@ -81,268 +81,273 @@ struct local_context
 };
 
 
-static memcached_return_t set_data(memcached_stat_st *memc_stat, const char *key, const char *value)
+enum memcached_stat_field_t {
+  STAT_FIELD_UNKNOWN,
+  STAT_FIELD_PID,
+  STAT_FIELD_UPTIME,
+  STAT_FIELD_TIME,
+  STAT_FIELD_VERSION,
+  STAT_FIELD_POINTER_SIZE,
+  STAT_FIELD_RUSAGE_USER,
+  STAT_FIELD_RUSAGE_SYSTEM,
+  STAT_FIELD_CURR_ITEMS,
+  STAT_FIELD_TOTAL_ITEMS,
+  STAT_FIELD_BYTES_READ,
+  STAT_FIELD_BYTES_WRITTEN,
+  STAT_FIELD_BYTES,
+  STAT_FIELD_CURR_CONNECTIONS,
+  STAT_FIELD_TOTAL_CONNECTIONS,
+  STAT_FIELD_CONNECTION_STRUCTURES,
+  STAT_FIELD_CMD_GET,
+  STAT_FIELD_CMD_SET,
+  STAT_FIELD_GET_HITS,
+  STAT_FIELD_GET_MISSES,
+  STAT_FIELD_EVICTIONS,
+  STAT_FIELD_LIMIT_MAXBYTES,
+  STAT_FIELD_THREADS
+};
+
+#define stat_field_is(__key, __name) (memcmp((__key), (__name), sizeof(__name) -1) == 0)
+
+/*
+  Stats are scraped often and from every server, so rather than walk a chain
+  of strcmp() we dispatch on the length of the key first. No two keys of the
+  same length share more than a handful of candidates.
+*/
+static memcached_stat_field_t stat_field(const char *key, const size_t key_length)
 {
+  switch (key_length)
+  {
+  case 3:
+    if (stat_field_is(key, "pid")) return STAT_FIELD_PID;
+    break;
+
+  case 4:
+    if (stat_field_is(key, "time")) return STAT_FIELD_TIME;
+    break;
+
+  case 5:
+    if (stat_field_is(key, "bytes")) return STAT_FIELD_BYTES;
+    break;
+
+  case 6:
+    if (stat_field_is(key, "uptime")) return STAT_FIELD_UPTIME;
+    break;
+
+  case 7:
+    if (stat_field_is(key, "version")) return STAT_FIELD_VERSION;
+    if (stat_field_is(key, "cmd_get")) return STAT_FIELD_CMD_GET;
+    if (stat_field_is(key, "cmd_set")) return STAT_FIELD_CMD_SET;
+    if (stat_field_is(key, "threads")) return STAT_FIELD_THREADS;
+    break;
+
+  case 8:
+    if (stat_field_is(key, "get_hits")) return STAT_FIELD_GET_HITS;
+    break;
+
+  case 9:
+    if (stat_field_is(key, "evictions")) return STAT_FIELD_EVICTIONS;
+    break;
+
+  case 10:
+    if (stat_field_is(key, "curr_items")) return STAT_FIELD_CURR_ITEMS;
+    if (stat_field_is(key, "get_misses")) return STAT_FIELD_GET_MISSES;
+    if (stat_field_is(key, "bytes_read")) return STAT_FIELD_BYTES_READ;
+    break;
+
+  case 11:
+    if (stat_field_is(key, "total_items")) return STAT_FIELD_TOTAL_ITEMS;
+    if (stat_field_is(key, "rusage_user")) return STAT_FIELD_RUSAGE_USER;
+    break;
+
+  case 12:
+    if (stat_field_is(key, "pointer_size")) return STAT_FIELD_POINTER_SIZE;
+    break;
+
+  case 13:
+    if (stat_field_is(key, "rusage_system")) return STAT_FIELD_RUSAGE_SYSTEM;
+    if (stat_field_is(key, "bytes_written")) return STAT_FIELD_BYTES_WRITTEN;
+    break;
+
+  case 14:
+    if (stat_field_is(key, "limit_maxbytes")) return STAT_FIELD_LIMIT_MAXBYTES;
+    break;
+
+  case 16:
+    if (stat_field_is(key, "curr_connections")) return STAT_FIELD_CURR_CONNECTIONS;
+    break;
+
+  case 17:
+    if (stat_field_is(key, "total_connections")) return STAT_FIELD_TOTAL_CONNECTIONS;
+    break;
 
-  if (strlen(key) < 1)
+  case 21:
+    if (stat_field_is(key, "connection_structures")) return STAT_FIELD_CONNECTION_STRUCTURES;
+    break;
+
+  default:
+    break;
+  }
+
+  return STAT_FIELD_UNKNOWN;
+}
+
+static void set_rusage(const char *value, unsigned long& seconds, unsigned long& microseconds)
+{
+  char *walk_ptr;
+  for (walk_ptr= (char*)value; (!ispunct(*walk_ptr)); walk_ptr++) {};
+  *walk_ptr= 0;
+  walk_ptr++;
+
+  seconds= strtoul(value, (char **)NULL, 10);
+  if (errno == 0)
+  {
+    microseconds= strtoul(walk_ptr, (char **)NULL, 10);
+  }
+}
+
+static memcached_return_t set_data(memcached_stat_st *memc_stat, const char *key, const char *value)
+{
+  size_t key_length= strlen(key);
+  if (key_length < 1)
   {
     WATCHPOINT_STRING(key);
     return MEMCACHED_UNKNOWN_STAT_KEY;
   }
-  else if (strcmp("pid", key) == 0)
+
+  errno= 0;
+  switch (stat_field(key, key_length))
   {
-    errno= 0;
-    int64_t temp= strtoll(value, (char **)NULL, 10);
-    if (errno != 0)
+  case STAT_FIELD_PID:
     {
-      return MEMCACHED_FAILURE;
-    }
+      int64_t temp= strtoll(value, (char **)NULL, 10);
+      if (errno != 0)
+      {
+        return MEMCACHED_FAILURE;
+      }
 
-    if (temp <= INT32_MAX and ( sizeof(pid_t) == sizeof(int32_t) ))
-    {
-      memc_stat->pid= pid_t(temp);
-    }
-    else if (temp > -1)
-    {
-      memc_stat->pid= pid_t(temp);
-    }
-    else
-    {
-      // If we got a value less then -1 then something went wrong in the
-      // protocol
+      if (temp <= INT32_MAX and ( sizeof(pid_t) == sizeof(int32_t) ))
+      {
+        memc_stat->pid= pid_t(temp);
+      }
+      else if (temp > -1)
+      {
+        memc_stat->pid= pid_t(temp);
+      }
+      else
+      {
+        // If we got a value less then -1 then something went wrong in the
+        // protocol
+      }
     }
-  }
-  else if (not strcmp("uptime", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_UPTIME:
     memc_stat->uptime= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("time", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_TIME:
     memc_stat->time= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("version", key))
-  {
-    memcpy(memc_stat->version, value, strlen(value));
-    memc_stat->version[strlen(value)]= 0;
-  }
-  else if (not strcmp("pointer_size", key))
-  {
-    errno= 0;
-    memc_stat->pointer_size= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("rusage_user", key))
-  {
-    char *walk_ptr;
-    for (walk_ptr= (char*)value; (!ispunct(*walk_ptr)); walk_ptr++) {};
-    *walk_ptr= 0;
-    walk_ptr++;
+    break;
 
-    errno= 0;
-    memc_stat->rusage_user_seconds= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
+  case STAT_FIELD_VERSION:
     {
-      return MEMCACHED_FAILURE;
+      size_t value_length= strlen(value);
+      if (value_length >= sizeof(memc_stat->version))
+      {
+        value_length= sizeof(memc_stat->version) -1;
+      }
+      memcpy(memc_stat->version, value, value_length);
+      memc_stat->version[value_length]= 0;
     }
+    break;
 
-    errno= 0;
-    memc_stat->rusage_user_microseconds= strtoul(walk_ptr, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("rusage_system", key))
-  {
-    char *walk_ptr;
-    for (walk_ptr= (char*)value; (!ispunct(*walk_ptr)); walk_ptr++) {};
-    *walk_ptr= 0;
-    walk_ptr++;
+  case STAT_FIELD_POINTER_SIZE:
+    memc_stat->pointer_size= strtoul(value, (char **)NULL, 10);
+    break;
 
-    errno= 0;
-    memc_stat->rusage_system_seconds= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
+  case STAT_FIELD_RUSAGE_USER:
+    set_rusage(value, memc_stat->rusage_user_seconds, memc_stat->rusage_user_microseconds);
+    break;
 
-    errno= 0;
-    memc_stat->rusage_system_microseconds= strtoul(walk_ptr, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("curr_items", key))
-  {
-    errno= 0;
+  case STAT_FIELD_RUSAGE_SYSTEM:
+    set_rusage(value, memc_stat->rusage_system_seconds, memc_stat->rusage_system_microseconds);
+    break;
+
+  case STAT_FIELD_CURR_ITEMS:
     memc_stat->curr_items= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("total_items", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_TOTAL_ITEMS:
     memc_stat->total_items= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("bytes_read", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_BYTES_READ:
     memc_stat->bytes_read= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("bytes_written", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_BYTES_WRITTEN:
     memc_stat->bytes_written= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("bytes", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_BYTES:
     memc_stat->bytes= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("curr_connections", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_CURR_CONNECTIONS:
     memc_stat->curr_connections= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("total_connections", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_TOTAL_CONNECTIONS:
     memc_stat->total_connections= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("connection_structures", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_CONNECTION_STRUCTURES:
     memc_stat->connection_structures= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("cmd_get", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_CMD_GET:
     memc_stat->cmd_get= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("cmd_set", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_CMD_SET:
     memc_stat->cmd_set= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("get_hits", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_GET_HITS:
     memc_stat->get_hits= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("get_misses", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_GET_MISSES:
     memc_stat->get_misses= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("evictions", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_EVICTIONS:
     memc_stat->evictions= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("limit_maxbytes", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_LIMIT_MAXBYTES:
     memc_stat->limit_maxbytes= strtoull(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if (not strcmp("threads", key))
-  {
-    errno= 0;
+    break;
+
+  case STAT_FIELD_THREADS:
     memc_stat->threads= strtoul(value, (char **)NULL, 10);
-    if (errno != 0)
-    {
-      return MEMCACHED_FAILURE;
-    }
-  }
-  else if ((strcmp("delete_misses", key) == 0 or /* New stats in the 1.3 beta */
-            strcmp("delete_hits", key) == 0 or /* Just swallow them for now.. */
-            strcmp("incr_misses", key) == 0 or
-            strcmp("incr_hits", key) == 0 or
-            strcmp("decr_misses", key) == 0 or
-            strcmp("decr_hits", key) == 0 or
-            strcmp("cas_misses", key) == 0 or
-            strcmp("cas_hits", key) == 0 or
-            strcmp("cas_badval", key) == 0 or
-            strcmp("cmd_flush", key) == 0 or
-            strcmp("accepting_conns", key) == 0 or
-            strcmp("listen_disabled_num", key) == 0 or
-            strcmp("conn_yields", key) == 0 or
-            strcmp("auth_cmds", key) == 0 or
-            strcmp("auth_errors", key) == 0 or
-            strcmp("reclaimed", key) == 0) == 0)
-  {
+    break;
+
+  case STAT_FIELD_UNKNOWN:
+    /*
+      Newer servers send stats we do not keep (delete_hits, cas_misses,
+      reclaimed, ...), just swallow them for now.
+    */
     WATCHPOINT_STRING(key);
-    /* return MEMCACHED_UNKNOWN_STAT_KEY; */
     return MEMCACHED_SUCCESS;
   }
 
+  if (errno != 0)
+  {
+    return MEMCACHED_FAILURE;
+  }
+
   return MEMCACHED_SUCCESS;
 }
 
@@ -476,13 +481,10 @@ char *memcached_stat_get_value(const memcached_st* shell, memcached_stat_st *mem
   return ret;
 }
 
-static memcached_return_t binary_stats_fetch(memcached_stat_st *memc_stat,
-                                             const char *args,
-                                             const size_t args_length,
-                                             memcached_instance_st* instance,
-                                             struct local_context *check)
+static memcached_return_t binary_stats_send(const char *args,
+                                            const size_t args_length,
+                                            memcached_instance_st* instance)
 {
-  char buffer[MEMCACHED_DEFAULT_COMMAND_SIZE];
   protocol_binary_request_stats request= {}; // = {.bytes= {0}};
 
   initialize_binary_request(instance, request.message.header);
@@ -521,6 +523,15 @@ static memcached_return_t binary_stats_fetch(memcached_stat_st *memc_stat,
     }
   }
 
+  return MEMCACHED_SUCCESS;
+}
+
+static memcached_return_t binary_stats_read(memcached_stat_st *memc_stat,
+                                            memcached_instance_st* instance,
+                                            struct local_context *check)
+{
+  char buffer[MEMCACHED_DEFAULT_COMMAND_SIZE];
+
   memcached_server_response_decrement(instance);
   while (1)
   {
@@ -561,16 +572,29 @@ static memcached_return_t binary_stats_fetch(memcached_stat_st *memc_stat,
    * memcached_response will decrement the counter, so I need to reset it..
    * todo: look at this and try to find a better solution.  
    * */
-  instance->cursor_active_= 0;
+  memcached_instance_response_reset(instance);
 
   return MEMCACHED_SUCCESS;
 }
 
-static memcached_return_t ascii_stats_fetch(memcached_stat_st *memc_stat,
-                                            const char *args,
-                                            const size_t args_length,
-                                            memcached_instance_st* instance,
-                                            struct local_context *check)
+static memcached_return_t binary_stats_fetch(memcached_stat_st *memc_stat,
+                                             const char *args,
+                                             const size_t args_length,
+                                             memcached_instance_st* instance,
+                                             struct local_context *check)
+{
+  memcached_return_t rc;
+  if (memcached_failed(rc= binary_stats_send(args, args_length, instance)))
+  {
+    return rc;
+  }
+
+  return binary_stats_read(memc_stat, instance, check);
+}
+
+static memcached_return_t ascii_stats_send(const char *args,
+                                           const size_t args_length,
+                                           memcached_instance_st* instance)
 {
   libmemcached_io_vector_st vector[]=
   {
@@ -579,45 +603,49 @@ static memcached_return_t ascii_stats_fetch(memcached_stat_st *memc_stat,
     { memcached_literal_param("\r\n") }
   };
 
-  memcached_return_t rc= memcached_vdo(instance, vector, 3, true);
-  if (memcached_success(rc))
+  return memcached_vdo(instance, vector, 3, true);
+}
+
+static memcached_return_t ascii_stats_read(memcached_stat_st *memc_stat,
+                                           memcached_instance_st* instance,
+                                           struct local_context *check)
+{
+  memcached_return_t rc;
+  char buffer[MEMCACHED_DEFAULT_COMMAND_SIZE];
+  while ((rc= memcached_response(instance, buffer, sizeof(buffer), NULL)) == MEMCACHED_STAT)
   {
-    char buffer[MEMCACHED_DEFAULT_COMMAND_SIZE];
-    while ((rc= memcached_response(instance, buffer, sizeof(buffer), NULL)) == MEMCACHED_STAT)
-    {
-      char *string_ptr= buffer;
-      string_ptr+= 5; /* Move past STAT */
-
-      char *end_ptr;
-      for (end_ptr= string_ptr; isgraph(*end_ptr); end_ptr++) {};
-      char *key= string_ptr;
-      key[size_t(end_ptr-string_ptr)]= 0;
-
-      string_ptr= end_ptr + 1;
-      for (end_ptr= string_ptr; !(isspace(*end_ptr)); end_ptr++) {};
-      char *value= string_ptr;
-      value[(size_t)(end_ptr -string_ptr)]= 0;
+    char *string_ptr= buffer;
+    string_ptr+= 5; /* Move past STAT */
+
+    char *end_ptr;
+    for (end_ptr= string_ptr; isgraph(*end_ptr); end_ptr++) {};
+    char *key= string_ptr;
+    key[size_t(end_ptr-string_ptr)]= 0;
+
+    string_ptr= end_ptr + 1;
+    for (end_ptr= string_ptr; !(isspace(*end_ptr)); end_ptr++) {};
+    char *value= string_ptr;
+    value[(size_t)(end_ptr -string_ptr)]= 0;
 #if 0
-      bool check_bool= bool(check);
-      bool check_func_bool= bool(check) ? bool(check->func) : false;
-      fprintf(stderr, "%s:%d %s %s %d:%d\n", __FILE__, __LINE__, key, value, check_bool, check_func_bool);
+    bool check_bool= bool(check);
+    bool check_func_bool= bool(check) ? bool(check->func) : false;
+    fprintf(stderr, "%s:%d %s %s %d:%d\n", __FILE__, __LINE__, key, value, check_bool, check_func_bool);
 #endif
 
-      if (check and check->func)
-      {
-        check->func(instance,
-                    key, strlen(key),
-                    value, strlen(value),
-                    check->context);
-      }
+    if (check and check->func)
+    {
+      check->func(instance,
+                  key, strlen(key),
+                  value, strlen(value),
+                  check->context);
+    }
 
-      if (memc_stat)
+    if (memc_stat)
+    {
+      if((set_data(memc_stat, key, value)) == MEMCACHED_UNKNOWN_STAT_KEY)
       {
-        if((set_data(memc_stat, key, value)) == MEMCACHED_UNKNOWN_STAT_KEY)
-        {
-          WATCHPOINT_ERROR(MEMCACHED_UNKNOWN_STAT_KEY);
-          WATCHPOINT_ASSERT(0);
-        }
+        WATCHPOINT_ERROR(MEMCACHED_UNKNOWN_STAT_KEY);
+        WATCHPOINT_ASSERT(0);
       }
     }
   }
@@ -635,6 +663,153 @@ static memcached_return_t ascii_stats_fetch(memcached_stat_st *memc_stat,
   return rc;
 }
 
+static memcached_return_t ascii_stats_fetch(memcached_stat_st *memc_stat,
+                                            const char *args,
+                                            const size_t args_length,
+                                            memcached_instance_st* instance,
+                                            struct local_context *check)
+{
+  memcached_return_t rc;
+  if (memcached_failed(rc= ascii_stats_send(args, args_length, instance)))
+  {
+    return rc;
+  }
+
+  return ascii_stats_read(memc_stat, instance, check);
+}
+
+static memcached_return_t stats_read(Memcached *self,
+                                     memcached_stat_st *stats,
+                                     bool *pending,
+                                     const uint32_t server_key,
+                                     memcached_return_t rc)
+{
+  memcached_instance_st* instance= memcached_instance_fetch(self, server_key);
+  pending[server_key]= false;
+
+  memcached_return_t temp_return;
+  if (memcached_is_binary(self))
+  {
+    temp_return= binary_stats_read(stats +server_key, instance, NULL);
+  }
+  else
+  {
+    temp_return= ascii_stats_read(stats +server_key, instance, NULL);
+  }
+
+  // Special case where "args" is invalid
+  if (temp_return == MEMCACHED_INVALID_ARGUMENTS or rc == MEMCACHED_INVALID_ARGUMENTS)
+  {
+    return MEMCACHED_INVALID_ARGUMENTS;
+  }
+
+  if (memcached_failed(temp_return))
+  {
+    return MEMCACHED_SOME_ERRORS;
+  }
+
+  return rc;
+}
+
+/*
+  Gather the replies of every server that was sent a stats request, reading
+  whichever server becomes readable first. Servers that have not answered
+  within poll_timeout are reset.
+*/
+static memcached_return_t stats_gather(Memcached *self,
+                                       memcached_stat_st *stats,
+                                       bool *pending,
+                                       uint32_t number_pending)
+{
+  const uint32_t server_count= memcached_server_count(self);
+  struct pollfd *fds= libmemcached_xcalloc(self, server_count, struct pollfd);
+  uint32_t *fd_server= libmemcached_xcalloc(self, server_count, uint32_t);
+
+  memcached_return_t rc= MEMCACHED_SUCCESS;
+  while (number_pending)
+  {
+    nfds_t nfds= 0;
+    uint32_t buffered= UINT32_MAX;
+    for (uint32_t x= 0; x < server_count; x++)
+    {
+      if (pending[x] == false)
+      {
+        continue;
+      }
+
+      memcached_instance_st* instance= memcached_instance_fetch(self, x);
+
+      // Anything already in our buffer, or no memory to poll with, means
+      // we just read the server.
+      if (instance->read_buffer_length > 0 or fds == NULL or fd_server == NULL)
+      {
+        buffered= x;
+        break;
+      }
+
+      fds[nfds].fd= instance->fd;
+      fds[nfds].events= POLLIN;
+      fds[nfds].revents= 0;
+      fd_server[nfds]= x;
+      nfds++;
+    }
+
+    if (buffered != UINT32_MAX)
+    {
+      rc= stats_read(self, stats, pending, buffered, rc);
+      number_pending--;
+      continue;
+    }
+
+    int active= poll(fds, nfds, self->poll_timeout);
+    if (active == -1 and get_socket_errno() == EINTR)
+    {
+      continue;
+    }
+
+    if (active <= 0)
+    {
+      if (active == -1)
+      {
+        memcached_set_errno(*self, get_socket_errno(), MEMCACHED_AT);
+      }
+      break;
+    }
+
+    for (nfds_t x= 0; x < nfds; x++)
+    {
+      if (fds[x].revents)
+      {
+        rc= stats_read(self, stats, pending, fd_server[x], rc);
+        number_pending--;
+      }
+    }
+  }
+
+  if (number_pending)
+  {
+    for (uint32_t x= 0; x < server_count; x++)
+    {
+      if (pending[x])
+      {
+        memcached_instance_st* instance= memcached_instance_fetch(self, x);
+        memcached_set_error(*instance, MEMCACHED_TIMEOUT, MEMCACHED_AT);
+        memcached_io_reset(instance);
+      }
+    }
+
+    if (rc != MEMCACHED_INVALID_ARGUMENTS)
+    {
+      rc= MEMCACHED_SOME_ERRORS;
+    }
+  }
+
+  libmemcached_free(self, fds);
+  libmemcached_free(self, fd_server);
+
+  return rc;
+}
+
 memcached_stat_st *memcached_stat(memcached_st *shell, char *args, memcached_return_t *error)
 {
   Memcached* self= memcached2Memcached(shell);
@@ -676,8 +851,19 @@ memcached_stat_st *memcached_stat(memcached_st *shell, char *args, memcached_ret
     return NULL;
   }
 
+  bool *pending= libmemcached_xcalloc(self, memcached_server_count(self), bool);
+  if (pending == NULL)
+  {
+    libmemcached_free(self, stats);
+    *error= memcached_set_error(*self, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT);
+    return NULL;
+  }
+
   WATCHPOINT_ASSERT(rc == MEMCACHED_SUCCESS);
   rc= MEMCACHED_SUCCESS;
+
+  // Send the request to every server before we wait on any of them
+  uint32_t number_pending= 0;
   for (uint32_t x= 0; x < memcached_server_count(self); x++)
   {
     memcached_stat_st* stat_instance= stats +x;
@@ -690,25 +876,29 @@ memcached_stat_st *memcached_stat(memcached_st *shell, char *args, memcached_ret
     memcached_return_t temp_return;
     if (memcached_is_binary(self))
     {
-      temp_return= binary_stats_fetch(stat_instance, args, args_length, instance, NULL);
+      temp_return= binary_stats_send(args, args_length, instance);
     }
     else
     {
-      temp_return= ascii_stats_fetch(stat_instance, args, args_length, instance, NULL);
-    }
-
-    // Special case where "args" is invalid
-    if (temp_return == MEMCACHED_INVALID_ARGUMENTS)
-    {
-      rc= MEMCACHED_INVALID_ARGUMENTS;
-      break;
+      temp_return= ascii_stats_send(args, args_length, instance);
     }
 
     if (memcached_failed(temp_return))
     {
       rc= MEMCACHED_SOME_ERRORS;
+      continue;
     }
+
+    pending[x]= true;
+    number_pending++;
+  }
+
+  memcached_return_t gather_rc= stats_gather(self, stats, pending, number_pending);
+  if (memcached_failed(gather_rc))
+  {
+    rc= gather_rc;
   }
+  libmemcached_free(self, pending);
 
   *error= rc;
 
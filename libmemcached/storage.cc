@@ -141,6 +141,8 @@ static inline uint8_t get_com_code(const memcached_storage_action_t verb, const
 static memcached_return_t memcached_send_binary(Memcached *ptr,
                                                 memcached_instance_st* server,
                                                 uint32_t server_key,
+                                                const char *group_key,
+                                                const size_t group_key_length,
                                                 const char *key,
                                                 const size_t key_length,
                                                 const char *value,
@@ -210,15 +212,10 @@ static memcached_return_t memcached_send_binary(Memcached *ptr,
     request.message.header.request.opcode= PROTOCOL_BINARY_CMD_SETQ;
     WATCHPOINT_STRING("replicating");
 
-    for (uint32_t x= 0; x < ptr->number_of_replicas; x++)
+    for (uint32_t x= 1; x <= ptr->number_of_replicas; x++)
     {
-      ++server_key;
-      if (server_key == memcached_server_count(ptr))
-      {
-        server_key= 0;
-      }
-
-      memcached_instance_st* instance= memcached_instance_fetch(ptr, server_key);
+      uint32_t replica_key= memcached_generate_replica(ptr, group_key, group_key_length, server_key, x);
+      memcached_instance_st* instance= memcached_instance_fetch(ptr, replica_key);
 
       if (memcached_vdo(instance, vector, 5, false) != MEMCACHED_SUCCESS)
       {
@@ -407,6 +404,7 @@ static inline memcached_return_t memcached_send(memcached_st *shell,
   if (memcached_is_binary(ptr))
   {
     rc= memcached_send_binary(ptr, instance, server_key,
+                              group_key, group_key_length,
                               key, key_length,
                               value, value_length, expiration,
                               flags, cas, flush, reply, verb);
@@ -596,3 +594,167 @@ memcached_return_t memcached_cas_by_key(memcached_st *ptr,
                          expiration, flags, cas, CAS_OP);
 }
 
+
+struct memcached_mset_st {
+  const char * const *values;
+  const size_t *value_length;
+  const time_t *expiration;
+  const uint32_t *flags;
+};
+
+static memcached_return_t batch_set_send(memcached_batch_st& batch,
+                                         memcached_instance_st* instance,
+                                         const size_t index)
+{
+  Memcached *ptr= batch.root;
+  const memcached_mset_st *mset= static_cast<const memcached_mset_st *>(batch.context);
+
+  const char *key= batch.keys[index];
+  const size_t key_length= batch.key_length[index];
+  const char *value= mset->values[index];
+  size_t value_length= mset->value_length[index];
+  const time_t expiration= mset->expiration ? mset->expiration[index] : 0;
+  const uint32_t flags= mset->flags ? mset->flags[index] : 0;
+
+  hashkit_string_st* destination= NULL;
+  if (memcached_is_encrypted(ptr))
+  {
+    if ((destination= hashkit_encrypt(&ptr->hashkit, value, value_length)) == NULL)
+    {
+      return memcached_set_error(*ptr, MEMCACHED_FAILURE, MEMCACHED_AT,
+                                 memcached_literal_param("hashkit_encrypt() failed"));
+    }
+    value= hashkit_string_c_str(destination);
+    value_length= hashkit_string_length(destination);
+  }
+
+  memcached_return_t rc;
+  if (memcached_is_binary(ptr))
+  {
+    protocol_binary_request_set request= {};
+
+    initialize_binary_request(instance, request.message.header);
+
+    request.message.header.request.opcode= get_com_code(SET_OP, false);
+    request.message.header.request.opaque= htonl(uint32_t(index));
+    request.message.header.request.keylen= htons((uint16_t)(key_length + memcached_array_size(ptr->_namespace)));
+    request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+    request.message.header.request.extlen= 8;
+    request.message.body.flags= htonl(flags);
+    request.message.body.expiration= htonl((uint32_t)expiration);
+    request.message.header.request.bodylen= htonl((uint32_t) (key_length + memcached_array_size(ptr->_namespace) + value_length +
+                                                              request.message.header.request.extlen));
+
+    libmemcached_io_vector_st vector[]=
+    {
+      { NULL, 0 },
+      { request.bytes, sizeof(request.bytes) },
+      { memcached_array_string(ptr->_namespace),  memcached_array_size(ptr->_namespace) },
+      { key, key_length },
+      { value, value_length }
+    };
+
+    rc= memcached_batch_write(batch, index, vector, 5, false);
+    if (memcached_success(rc) and ptr->number_of_replicas > 0)
+    {
+      request.message.header.request.opaque= htonl(MEMCACHED_BATCH_REPLICA);
+      memcached_batch_write_replicas(batch, index, vector, 5);
+    }
+  }
+  else
+  {
+    char header_buffer[3 *(MEMCACHED_MAXIMUM_INTEGER_DISPLAY_LENGTH +1)];
+    int header_buffer_length= snprintf(header_buffer, sizeof(header_buffer), " %u %llu %llu",
+                                       flags, (unsigned long long)expiration, (unsigned long long)value_length);
+    if (size_t(header_buffer_length) >= sizeof(header_buffer) or header_buffer_length < 0)
+    {
+      hashkit_string_free(destination);
+      return memcached_set_error(*instance, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT, 
+                                 memcached_literal_param("snprintf(MEMCACHED_MAXIMUM_INTEGER_DISPLAY_LENGTH)"));
+    }
+
+    const bool reply= memcached_is_replying(ptr);
+    libmemcached_io_vector_st vector[]=
+    {
+      { NULL, 0 },
+      { storage_op_string(SET_OP), strlen(storage_op_string(SET_OP))},
+      { memcached_array_string(ptr->_namespace), memcached_array_size(ptr->_namespace) },
+      { key, key_length },
+      { header_buffer, size_t(header_buffer_length) },
+      { " noreply", reply ? 0 : memcached_literal_param_size(" noreply") },
+      { memcached_literal_param("\r\n") },
+      { value, value_length },
+      { memcached_literal_param("\r\n") }
+    };
+
+    rc= memcached_batch_write(batch, index, vector, 9, reply);
+  }
+
+  hashkit_string_free(destination);
+
+  return rc;
+}
+
+static memcached_return_t batch_set_reply(memcached_batch_st&,
+                                          memcached_instance_st* instance,
+                                          const size_t)
+{
+  memcached_return_t rc= memcached_read_one_response(instance, NULL);
+  if (rc == MEMCACHED_STORED)
+  {
+    rc= MEMCACHED_SUCCESS;
+  }
+
+  return rc;
+}
+
+memcached_return_t memcached_mset(memcached_st *ptr,
+                                  const char * const *keys, const size_t *key_length,
+                                  const char * const *values, const size_t *value_length,
+                                  const time_t *expiration,
+                                  const uint32_t *flags,
+                                  size_t number_of_keys,
+                                  memcached_return_t *results)
+{
+  return memcached_mset_by_key(ptr, NULL, 0,
+                               keys, key_length, values, value_length,
+                               expiration, flags, number_of_keys, results);
+}
+
+memcached_return_t memcached_mset_by_key(memcached_st *shell,
+                                         const char *group_key, size_t group_key_length,
+                                         const char * const *keys, const size_t *key_length,
+                                         const char * const *values, const size_t *value_length,
+                                         const time_t *expiration,
+                                         const uint32_t *flags,
+                                         size_t number_of_keys,
+                                         memcached_return_t *results)
+{
+  Memcached* ptr= memcached2Memcached(shell);
+
+  memcached_batch_st batch;
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_batch_init(batch, ptr, group_key, group_key_length,
+                                                keys, key_length, number_of_keys, results)))
+  {
+    return rc;
+  }
+
+  if (values == NULL or value_length == NULL)
+  {
+    memcached_batch_free(batch);
+    return memcached_set_error(*ptr, MEMCACHED_INVALID_ARGUMENTS, MEMCACHED_AT,
+                               memcached_literal_param("values and value_length must not be NULL"));
+  }
+
+  memcached_mset_st mset= { values, value_length, expiration, flags };
+  batch.context= &mset;
+
+  LIBMEMCACHED_MEMCACHED_SET_START();
+  rc= memcached_batch_execute(batch, batch_set_send, batch_set_reply);
+  LIBMEMCACHED_MEMCACHED_SET_END();
+
+  memcached_batch_free(batch);
+
+  return rc;
+}
@@ -57,7 +57,41 @@ inline static memcached_return_t _string_check(memcached_string_st *string, size
       return memcached_set_error(*string->root, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT, error_message, error_message_length);
     }
 
-    char *new_value= libmemcached_xrealloc(string->root, string->string, new_size, char);
+    // A new buffer comes from the slab if the root has one turned on. The
+    // handle's own result keeps its buffer for good, leaving it to the
+    // allocators means whatever the slab has in use is held by the caller.
+    if (string->string == NULL or string->options.is_inline)
+    {
+      string->options.is_slab= memcached_slab_is_enabled(string->root) and string != &string->root->result.value;
+    }
+
+    char *new_value;
+    if (string->options.is_inline)
+    {
+      // Outgrown the buffer it was lent, what is there moves to one of its own.
+      if (string->options.is_slab)
+      {
+        new_value= (char *)memcached_slab_alloc(string->root, new_size);
+      }
+      else
+      {
+        new_value= libmemcached_xvalloc(string->root, new_size, char);
+      }
+
+      if (new_value)
+      {
+        memcpy(new_value, string->string, current_offset);
+        string->options.is_inline= false;
+      }
+    }
+    else if (string->options.is_slab)
+    {
+      new_value= (char *)memcached_slab_realloc(string->root, string->string, string->current_size, new_size);
+    }
+    else
+    {
+      new_value= libmemcached_xrealloc(string->root, string->string, new_size, char);
+    }
 
     if (new_value == NULL)
     {
@@ -77,6 +111,8 @@ static inline void _init_string(memcached_string_st *self)
 {
   self->current_size= 0;
   self->end= self->string= NULL;
+  self->options.is_slab= false;
+  self->options.is_inline= false;
 }
 
 memcached_string_st *memcached_string_create(Memcached *memc, memcached_string_st *self, size_t initial_size)
@@ -215,6 +251,14 @@ void memcached_string_reset(memcached_string_st *string)
   string->end= string->string;
 }
 
+void memcached_string_set_inline(memcached_string_st& string, char *buffer, size_t size)
+{
+  assert(string.string == NULL);
+  string.string= string.end= buffer;
+  string.current_size= size;
+  string.options.is_inline= true;
+}
+
 void memcached_string_free(memcached_string_st& ptr)
 {
   memcached_string_free(&ptr);
@@ -227,9 +271,16 @@ void memcached_string_free(memcached_string_st *ptr)
     return;
   }
 
-  if (ptr->string)
+  if (ptr->string and ptr->options.is_inline == false)
   {
-    libmemcached_free(ptr->root, ptr->string);
+    if (ptr->options.is_slab)
+    {
+      memcached_slab_free(ptr->root, ptr->string, ptr->current_size);
+    }
+    else
+    {
+      libmemcached_free(ptr->root, ptr->string);
+    }
   }
 
   if (memcached_is_allocated(ptr))
@@ -292,6 +343,15 @@ char *memcached_string_take_value(memcached_string_st *self)
         return NULL;
       }
 
+      // The caller frees the value with the allocators, a slab or inline
+      // buffer is copied out and kept for the next value instead.
+      if (self->options.is_slab or self->options.is_inline)
+      {
+        value= memcached_string_c_copy(self);
+        memcached_string_reset(self);
+        return value;
+      }
+
       value= self->string;
       _init_string(self);
     }
@@ -70,6 +70,8 @@ memcached_return_t memcached_string_append(memcached_string_st *string,
 
 void memcached_string_reset(memcached_string_st *string);
 
+void memcached_string_set_inline(memcached_string_st&, char *buffer, size_t size);
+
 void memcached_string_free(memcached_string_st *string);
 void memcached_string_free(memcached_string_st&);
 
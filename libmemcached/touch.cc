@@ -156,3 +156,102 @@ memcached_return_t memcached_touch_by_key(memcached_st *shell,
 
   return memcached_set_error(*instance, rc, MEMCACHED_AT, memcached_literal_param("Error occcured while reading response"));
 }
+
+static memcached_return_t batch_touch_send(memcached_batch_st& batch,
+                                           memcached_instance_st* instance,
+                                           const size_t index)
+{
+  const char *key= batch.keys[index];
+  const size_t key_length= batch.key_length[index];
+  const time_t expiration= *static_cast<const time_t *>(batch.context);
+
+  if (memcached_is_binary(batch.root))
+  {
+    /* There is no quiet TOUCH, every key gets a reply */
+    protocol_binary_request_touch request= {};
+
+    initialize_binary_request(instance, request.message.header);
+
+    request.message.header.request.opcode= PROTOCOL_BINARY_CMD_TOUCH;
+    request.message.header.request.opaque= htonl(uint32_t(index));
+    request.message.header.request.extlen= 4;
+    request.message.header.request.keylen= htons((uint16_t)(key_length +memcached_array_size(instance->root->_namespace)));
+    request.message.header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+    request.message.header.request.bodylen= htonl((uint32_t)(key_length +memcached_array_size(instance->root->_namespace) +request.message.header.request.extlen));
+    request.message.body.expiration= htonl((uint32_t) expiration);
+
+    libmemcached_io_vector_st vector[]=
+    {
+      { NULL, 0 },
+      { request.bytes, sizeof(request.bytes) },
+      { memcached_array_string(instance->root->_namespace), memcached_array_size(instance->root->_namespace) },
+      { key, key_length }
+    };
+
+    return memcached_batch_write(batch, index, vector, 4, true);
+  }
+
+  char expiration_buffer[MEMCACHED_MAXIMUM_INTEGER_DISPLAY_LENGTH +1];
+  int expiration_buffer_length= snprintf(expiration_buffer, sizeof(expiration_buffer), " %llu", (unsigned long long)expiration);
+  if (size_t(expiration_buffer_length) >= sizeof(expiration_buffer) or expiration_buffer_length < 0)
+  {
+    return memcached_set_error(*instance, MEMCACHED_MEMORY_ALLOCATION_FAILURE, MEMCACHED_AT, 
+                               memcached_literal_param("snprintf(MEMCACHED_MAXIMUM_INTEGER_DISPLAY_LENGTH)"));
+  }
+
+  const bool reply= memcached_is_replying(batch.root);
+  libmemcached_io_vector_st vector[]=
+  {
+    { NULL, 0 },
+    { memcached_literal_param("touch ") },
+    { memcached_array_string(instance->root->_namespace), memcached_array_size(instance->root->_namespace) },
+    { key, key_length },
+    { expiration_buffer, size_t(expiration_buffer_length) },
+    { " noreply", reply ? 0 : memcached_literal_param_size(" noreply") },
+    { memcached_literal_param("\r\n") }
+  };
+
+  return memcached_batch_write(batch, index, vector, 7, reply);
+}
+
+static memcached_return_t batch_touch_reply(memcached_batch_st&,
+                                            memcached_instance_st* instance,
+                                            const size_t)
+{
+  return memcached_read_one_response(instance, NULL);
+}
+
+memcached_return_t memcached_touch_multi(memcached_st *ptr,
+                                         const char * const *keys,
+                                         const size_t *key_length,
+                                         size_t number_of_keys,
+                                         time_t expiration,
+                                         memcached_return_t *results)
+{
+  return memcached_touch_multi_by_key(ptr, NULL, 0, keys, key_length, number_of_keys, expiration, results);
+}
+
+memcached_return_t memcached_touch_multi_by_key(memcached_st *shell,
+                                                const char *group_key, size_t group_key_length,
+                                                const char * const *keys,
+                                                const size_t *key_length,
+                                                size_t number_of_keys,
+                                                time_t expiration,
+                                                memcached_return_t *results)
+{
+  Memcached* ptr= memcached2Memcached(shell);
+
+  memcached_batch_st batch;
+  memcached_return_t rc;
+  if (memcached_failed(rc= memcached_batch_init(batch, ptr, group_key, group_key_length,
+                                                keys, key_length, number_of_keys, results)))
+  {
+    return rc;
+  }
+  batch.context= &expiration;
+
+  rc= memcached_batch_execute(batch, batch_touch_send, batch_touch_reply);
+  memcached_batch_free(batch);
+
+  return rc;
+}
@@ -0,0 +1,81 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include <libmemcached-1.0/memcached.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  A multiplexer shares a few binary protocol connections per server between
+  every thread that uses it, instead of each thread (or pool entry) keeping
+  its own.  Requests are tagged with an opaque and every response is handed
+  to the thread waiting on it.
+*/
+struct memcached_mux_st;
+typedef struct memcached_mux_st memcached_mux_st;
+
+LIBMEMCACHED_API
+memcached_mux_st *memcached_mux_create(memcached_st *master, uint32_t connections_per_server);
+
+LIBMEMCACHED_API
+memcached_st *memcached_mux_destroy(memcached_mux_st *mux);
+
+LIBMEMCACHED_API
+char *memcached_mux_get(memcached_mux_st *mux,
+                        const char *key, size_t key_length,
+                        size_t *value_length,
+                        uint32_t *flags,
+                        memcached_return_t *error);
+
+LIBMEMCACHED_API
+memcached_return_t memcached_mux_set(memcached_mux_st *mux,
+                                     const char *key, size_t key_length,
+                                     const char *value, size_t value_length,
+                                     time_t expiration,
+                                     uint32_t flags);
+
+LIBMEMCACHED_API
+memcached_return_t memcached_mux_delete(memcached_mux_st *mux,
+                                        const char *key, size_t key_length);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,881 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <libmemcachedutil/common.h>
+#include <libmemcachedutil-1.0/mux.h>
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <pthread.h>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include "libmemcached/memcached/protocol_binary.h"
+
+#ifndef MSG_NOSIGNAL
+# define MSG_NOSIGNAL 0
+#endif
+
+/*
+  Each connection keeps the requests it has been given in wire order.  The
+  server answers them in that order, so the response at the front of the
+  socket always belongs to the request at the head of the list, which the
+  opaque confirms.
+
+  Writes are combined: the thread that finds nobody flushing writes out
+  whatever every thread has appended in the meantime.  Reads follow a
+  leader/follower scheme: one waiting thread reads responses and hands them
+  to their owners, and when its own answer arrives it passes the job on to
+  the thread at the head of the list.
+
+  Every connection has a memcached_st of its own holding only its server.
+  It is opened by asking that memcached_st for the server's version, so
+  the library connects it with the master's connect_timeout, retry_timeout,
+  server_failure_limit and auto-eject settings, and the multiplexer then
+  speaks the protocol on its socket.  The connect runs without the
+  connection mutex held; threads that arrive meanwhile wait for its outcome
+  rather than start their own.
+*/
+struct mux_request_st
+{
+  mux_request_st *next;
+  pthread_cond_t cond;
+  uint32_t opaque;
+  uint8_t opcode;
+  bool done;
+  memcached_return_t rc;
+  char *value;
+  size_t value_length;
+  uint32_t flags;
+};
+
+struct mux_connection_st
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t connected;
+  int fd;
+  bool broken;
+  bool connecting;
+  bool flushing;
+  bool reading;
+  memcached_return_t connect_rc;
+  time_t ejected_until;
+  uint32_t opaque;
+  char *buffer;
+  size_t length;
+  size_t capacity;
+  char *flush_buffer;
+  size_t flush_capacity;
+  mux_request_st *head;
+  mux_request_st *tail;
+  memcached_st *memc;
+};
+
+struct memcached_mux_st
+{
+  memcached_st *master;
+  uint32_t server_count;
+  uint32_t per_server;
+  int32_t timeout;
+  bool auto_eject;
+  char prefix[MEMCACHED_PREFIX_KEY_MAX_SIZE];
+  size_t prefix_length;
+  mux_connection_st *connections;
+};
+
+static uint32_t mux_thread_count= 0;
+static __thread uint32_t mux_thread_index= 0;
+
+static inline uint32_t mux_thread_id()
+{
+  if (mux_thread_index == 0)
+  {
+    mux_thread_index= __atomic_add_fetch(&mux_thread_count, 1, __ATOMIC_RELAXED);
+  }
+
+  return mux_thread_index;
+}
+
+static memcached_return_t mux_status(uint16_t status)
+{
+  switch (status)
+  {
+  case PROTOCOL_BINARY_RESPONSE_SUCCESS:
+    return MEMCACHED_SUCCESS;
+
+  case PROTOCOL_BINARY_RESPONSE_KEY_ENOENT:
+    return MEMCACHED_NOTFOUND;
+
+  case PROTOCOL_BINARY_RESPONSE_KEY_EEXISTS:
+    return MEMCACHED_DATA_EXISTS;
+
+  case PROTOCOL_BINARY_RESPONSE_E2BIG:
+    return MEMCACHED_E2BIG;
+
+  case PROTOCOL_BINARY_RESPONSE_EINVAL:
+    return MEMCACHED_INVALID_ARGUMENTS;
+
+  case PROTOCOL_BINARY_RESPONSE_NOT_STORED:
+    return MEMCACHED_NOTSTORED;
+
+  case PROTOCOL_BINARY_RESPONSE_ENOMEM:
+    return MEMCACHED_SERVER_MEMORY_ALLOCATION_FAILURE;
+
+  case PROTOCOL_BINARY_RESPONSE_UNKNOWN_COMMAND:
+  case PROTOCOL_BINARY_RESPONSE_NOT_SUPPORTED:
+    return MEMCACHED_NOT_SUPPORTED;
+
+  default:
+    break;
+  }
+
+  return MEMCACHED_PROTOCOL_ERROR;
+}
+
+/*
+  Fails everything waiting on the connection.  The socket is only shut
+  down here, since the flusher or reader may still be using it; the next
+  request to find it idle closes it and connects again.
+*/
+static void mux_fail(mux_connection_st& conn, memcached_return_t rc)
+{
+  if (conn.fd != -1 and conn.broken == false)
+  {
+    shutdown(conn.fd, SHUT_RDWR);
+  }
+  conn.broken= true;
+  conn.length= 0;
+
+  mux_request_st *next;
+  for (mux_request_st *request= conn.head; request; request= next)
+  {
+    next= request->next;
+    request->rc= rc;
+    request->done= true;
+    pthread_cond_signal(&request->cond);
+  }
+  conn.head= conn.tail= NULL;
+}
+
+/*
+  Gives a connection a memcached_st of its own that holds only its server,
+  so that connecting and the backoff that follows a failure never touch the
+  master, which every thread hashes with.
+*/
+static memcached_st *mux_server_create(memcached_st *master, const memcached_instance_st *server)
+{
+  memcached_st *memc;
+  if ((memc= memcached_clone(NULL, master)) == NULL)
+  {
+    return NULL;
+  }
+  memcached_servers_reset(memc);
+
+  memcached_return_t rc;
+  if (strcmp(memcached_server_type(server), "SOCKET") == 0)
+  {
+    rc= memcached_server_add_unix_socket(memc, memcached_server_name(server));
+  }
+  else
+  {
+    rc= memcached_server_add(memc, memcached_server_name(server), memcached_server_port(server));
+  }
+
+  if (memcached_success(rc))
+  {
+    rc= memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_BINARY_PROTOCOL, true);
+  }
+
+  if (memcached_success(rc))
+  {
+    rc= memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_TCP_NODELAY, true);
+  }
+
+  if (memcached_failed(rc))
+  {
+    memcached_free(memc);
+    return NULL;
+  }
+
+  return memc;
+}
+
+/*
+  Picks the connection for a server.  When the master auto-ejects hosts,
+  servers whose connection was marked dead are passed over for the next
+  one along until they may be retried, as run_distribution() would leave
+  them out of the continuum.
+*/
+static mux_connection_st& mux_connection(memcached_mux_st *mux, uint32_t server_key)
+{
+  uint32_t slot= mux_thread_id() % mux->per_server;
+  if (mux->auto_eject)
+  {
+    time_t now= time(NULL);
+    for (uint32_t x= 0; x < mux->server_count; x++)
+    {
+      mux_connection_st& conn= mux->connections[((server_key +x) % mux->server_count) * mux->per_server +slot];
+      if (__atomic_load_n(&conn.ejected_until, __ATOMIC_RELAXED) <= now)
+      {
+        return conn;
+      }
+    }
+  }
+
+  return mux->connections[server_key * mux->per_server +slot];
+}
+
+// Caller holds the connection mutex, which is released while connecting
+static memcached_return_t mux_connect(mux_connection_st& conn)
+{
+  while (conn.connecting)
+  {
+    pthread_cond_wait(&conn.connected, &conn.mutex);
+    if (conn.connecting == false and conn.fd == -1)
+    {
+      // Fail with whoever was connecting instead of trying again at once
+      return conn.connect_rc;
+    }
+  }
+
+  if (conn.broken)
+  {
+    if (conn.flushing or conn.reading)
+    {
+      return MEMCACHED_CONNECTION_FAILURE;
+    }
+
+    memcached_quit(conn.memc);
+    conn.fd= -1;
+    conn.broken= false;
+  }
+
+  if (conn.fd != -1)
+  {
+    return MEMCACHED_SUCCESS;
+  }
+
+  conn.connecting= true;
+  pthread_mutex_unlock(&conn.mutex);
+
+  const memcached_instance_st *instance= memcached_server_instance_by_position(conn.memc, 0);
+  memcached_return_t rc= memcached_version(conn.memc);
+  if (rc == MEMCACHED_SOME_ERRORS)
+  {
+    rc= memcached_server_error_return(instance);
+  }
+
+  int fd= -1;
+  if (memcached_success(rc) and (fd= memcached_server_fd(instance)) == -1)
+  {
+    rc= MEMCACHED_CONNECTION_FAILURE;
+  }
+
+  time_t ejected_until= 0;
+  if (rc == MEMCACHED_SERVER_MARKED_DEAD)
+  {
+    uint64_t dead_timeout= memcached_behavior_get(conn.memc, MEMCACHED_BEHAVIOR_DEAD_TIMEOUT);
+    ejected_until= time(NULL) +time_t(dead_timeout ? dead_timeout : memcached_behavior_get(conn.memc, MEMCACHED_BEHAVIOR_RETRY_TIMEOUT));
+  }
+
+  pthread_mutex_lock(&conn.mutex);
+  conn.connecting= false;
+  conn.connect_rc= rc;
+  conn.fd= fd;
+  __atomic_store_n(&conn.ejected_until, ejected_until, __ATOMIC_RELAXED);
+  pthread_cond_broadcast(&conn.connected);
+
+  return rc;
+}
+
+/*
+  The library leaves the socket non-blocking, so a send or receive that
+  would block waits here for at most the poll timeout.
+*/
+static memcached_return_t mux_poll(int fd, short events, int32_t timeout)
+{
+  struct pollfd fds;
+  fds.fd= fd;
+  fds.events= events;
+  fds.revents= 0;
+
+  while (true)
+  {
+    int ready= poll(&fds, 1, timeout);
+    if (ready > 0)
+    {
+      return MEMCACHED_SUCCESS;
+    }
+
+    if (ready == 0)
+    {
+      return MEMCACHED_TIMEOUT;
+    }
+
+    if (errno != EINTR)
+    {
+      return MEMCACHED_CONNECTION_FAILURE;
+    }
+  }
+}
+
+static bool mux_send(int fd, const char *buffer, size_t length, int32_t timeout)
+{
+  while (length)
+  {
+    ssize_t sent= send(fd, buffer, length, MSG_NOSIGNAL);
+    if (sent == -1)
+    {
+      switch (errno)
+      {
+      case EINTR:
+        continue;
+
+#if EWOULDBLOCK != EAGAIN
+      case EWOULDBLOCK:
+#endif
+      case EAGAIN:
+        if (memcached_success(mux_poll(fd, POLLOUT, timeout)))
+        {
+          continue;
+        }
+        return false;
+
+      default:
+        return false;
+      }
+    }
+
+    buffer+= sent;
+    length-= size_t(sent);
+  }
+
+  return true;
+}
+
+static memcached_return_t mux_recv(int fd, void *buffer, size_t length, int32_t timeout)
+{
+  char *ptr= static_cast<char *>(buffer);
+  while (length)
+  {
+    ssize_t nr= recv(fd, ptr, length, 0);
+    if (nr == 0)
+    {
+      return MEMCACHED_CONNECTION_FAILURE;
+    }
+
+    if (nr == -1)
+    {
+      switch (errno)
+      {
+      case EINTR:
+        continue;
+
+#if EWOULDBLOCK != EAGAIN
+      case EWOULDBLOCK:
+#endif
+      case EAGAIN:
+        {
+          memcached_return_t rc;
+          if (memcached_failed(rc= mux_poll(fd, POLLIN, timeout)))
+          {
+            return rc;
+          }
+        }
+        continue;
+
+      default:
+        return MEMCACHED_READ_FAILURE;
+      }
+    }
+
+    ptr+= nr;
+    length-= size_t(nr);
+  }
+
+  return MEMCACHED_SUCCESS;
+}
+
+/*
+  Reads one response.  The body is allocated with room for a terminating
+  nul so that a value can be returned in place.
+*/
+static memcached_return_t mux_read(int fd, protocol_binary_response_header& header, char *&body, int32_t timeout)
+{
+  body= NULL;
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= mux_recv(fd, header.bytes, sizeof(header.bytes), timeout)))
+  {
+    return rc;
+  }
+
+  if (header.response.magic != PROTOCOL_BINARY_RES)
+  {
+    return MEMCACHED_PROTOCOL_ERROR;
+  }
+
+  size_t bodylen= ntohl(header.response.bodylen);
+  if ((body= static_cast<char *>(malloc(bodylen +1))) == NULL)
+  {
+    return MEMCACHED_MEMORY_ALLOCATION_FAILURE;
+  }
+
+  if (memcached_failed(rc= mux_recv(fd, body, bodylen, timeout)))
+  {
+    free(body);
+    body= NULL;
+    return rc;
+  }
+  body[bodylen]= 0;
+
+  return MEMCACHED_SUCCESS;
+}
+
+// Caller holds the connection mutex
+static void mux_complete(mux_request_st *request, const protocol_binary_response_header& header, char *body)
+{
+  request->rc= mux_status(ntohs(header.response.status));
+
+  size_t skip= size_t(header.response.extlen) +ntohs(header.response.keylen);
+  size_t bodylen= ntohl(header.response.bodylen);
+  if (request->opcode == PROTOCOL_BINARY_CMD_GET and memcached_success(request->rc) and bodylen >= skip)
+  {
+    if (header.response.extlen >= sizeof(uint32_t))
+    {
+      uint32_t flags;
+      memcpy(&flags, body, sizeof(flags));
+      request->flags= ntohl(flags);
+    }
+
+    request->value_length= bodylen -skip;
+    memmove(body, body +skip, request->value_length +1);
+    request->value= body;
+  }
+  else
+  {
+    free(body);
+  }
+
+  request->done= true;
+  pthread_cond_signal(&request->cond);
+}
+
+static bool mux_reserve(mux_connection_st& conn, size_t length)
+{
+  if (conn.length +length <= conn.capacity)
+  {
+    return true;
+  }
+
+  size_t capacity= conn.capacity ? conn.capacity : 4096;
+  while (capacity < conn.length +length)
+  {
+    capacity*= 2;
+  }
+
+  char *buffer;
+  if ((buffer= static_cast<char *>(realloc(conn.buffer, capacity))) == NULL)
+  {
+    return false;
+  }
+  conn.buffer= buffer;
+  conn.capacity= capacity;
+
+  return true;
+}
+
+static memcached_return_t mux_execute(memcached_mux_st *mux,
+                                      protocol_binary_request_header& header,
+                                      const void *extras,
+                                      const char *key, size_t key_length,
+                                      const char *value, size_t value_length,
+                                      mux_request_st& request)
+{
+  request.next= NULL;
+  request.opcode= header.request.opcode;
+  request.done= false;
+  request.rc= MEMCACHED_SUCCESS;
+  request.value= NULL;
+  request.value_length= 0;
+  request.flags= 0;
+
+  uint32_t server_key= memcached_generate_hash(mux->master, key, key_length);
+  if (server_key >= mux->server_count)
+  {
+    // The master's servers changed after the multiplexer was created
+    return MEMCACHED_NO_SERVERS;
+  }
+  mux_connection_st& conn= mux_connection(mux, server_key);
+
+  pthread_mutex_lock(&conn.mutex);
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= mux_connect(conn)))
+  {
+    pthread_mutex_unlock(&conn.mutex);
+    return rc;
+  }
+
+  size_t length= sizeof(header.bytes) +header.request.extlen +mux->prefix_length +key_length +value_length;
+  if (mux_reserve(conn, length) == false)
+  {
+    pthread_mutex_unlock(&conn.mutex);
+    return MEMCACHED_MEMORY_ALLOCATION_FAILURE;
+  }
+
+  request.opaque= ++conn.opaque;
+  header.request.opaque= request.opaque;
+
+  char *ptr= conn.buffer +conn.length;
+  memcpy(ptr, header.bytes, sizeof(header.bytes));
+  ptr+= sizeof(header.bytes);
+  memcpy(ptr, extras, header.request.extlen);
+  ptr+= header.request.extlen;
+  memcpy(ptr, mux->prefix, mux->prefix_length);
+  ptr+= mux->prefix_length;
+  memcpy(ptr, key, key_length);
+  ptr+= key_length;
+  memcpy(ptr, value, value_length);
+  conn.length+= length;
+
+  pthread_cond_init(&request.cond, NULL);
+  if (conn.tail)
+  {
+    conn.tail->next= &request;
+  }
+  else
+  {
+    conn.head= &request;
+  }
+  conn.tail= &request;
+
+  if (conn.flushing == false)
+  {
+    conn.flushing= true;
+    while (conn.length and conn.broken == false)
+    {
+      char *buffer= conn.buffer;
+      size_t capacity= conn.capacity;
+      size_t flush_length= conn.length;
+      conn.buffer= conn.flush_buffer;
+      conn.capacity= conn.flush_capacity;
+      conn.length= 0;
+      conn.flush_buffer= buffer;
+      conn.flush_capacity= capacity;
+
+      int fd= conn.fd;
+      pthread_mutex_unlock(&conn.mutex);
+      bool sent= mux_send(fd, buffer, flush_length, mux->timeout);
+      pthread_mutex_lock(&conn.mutex);
+
+      if (sent == false)
+      {
+        mux_fail(conn, MEMCACHED_WRITE_FAILURE);
+      }
+    }
+    conn.flushing= false;
+  }
+
+  while (request.done == false)
+  {
+    if (conn.reading)
+    {
+      pthread_cond_wait(&request.cond, &conn.mutex);
+      continue;
+    }
+
+    conn.reading= true;
+    while (request.done == false)
+    {
+      int fd= conn.fd;
+      pthread_mutex_unlock(&conn.mutex);
+      protocol_binary_response_header response;
+      char *body;
+      rc= mux_read(fd, response, body, mux->timeout);
+      pthread_mutex_lock(&conn.mutex);
+
+      if (memcached_failed(rc))
+      {
+        mux_fail(conn, rc);
+        break;
+      }
+
+      mux_request_st *head= conn.head;
+      if (head == NULL or response.response.opaque != head->opaque)
+      {
+        free(body);
+        mux_fail(conn, MEMCACHED_PROTOCOL_ERROR);
+        break;
+      }
+
+      if ((conn.head= head->next) == NULL)
+      {
+        conn.tail= NULL;
+      }
+      mux_complete(head, response, body);
+    }
+    conn.reading= false;
+
+    // Hand reading over to the next thread in line
+    if (conn.head)
+    {
+      pthread_cond_signal(&conn.head->cond);
+    }
+  }
+  pthread_mutex_unlock(&conn.mutex);
+  pthread_cond_destroy(&request.cond);
+
+  return request.rc;
+}
+
+static memcached_return_t mux_key_check(const memcached_mux_st *mux, const char *key, size_t key_length)
+{
+  if (key == NULL or key_length == 0)
+  {
+    return MEMCACHED_BAD_KEY_PROVIDED;
+  }
+
+  if (mux->prefix_length +key_length > MEMCACHED_MAX_KEY -1)
+  {
+    return MEMCACHED_KEY_TOO_BIG;
+  }
+
+  return MEMCACHED_SUCCESS;
+}
+
+static void mux_header(const memcached_mux_st *mux, protocol_binary_request_header& header,
+                       uint8_t opcode, uint8_t extlen, size_t key_length, size_t value_length)
+{
+  memset(header.bytes, 0, sizeof(header.bytes));
+  header.request.magic= PROTOCOL_BINARY_REQ;
+  header.request.opcode= opcode;
+  header.request.keylen= htons(uint16_t(mux->prefix_length +key_length));
+  header.request.extlen= extlen;
+  header.request.datatype= PROTOCOL_BINARY_RAW_BYTES;
+  header.request.bodylen= htonl(uint32_t(extlen +mux->prefix_length +key_length +value_length));
+}
+
+memcached_mux_st *memcached_mux_create(memcached_st *master, uint32_t connections_per_server)
+{
+  if (master == NULL or memcached_server_count(master) == 0 or memcached_behavior_get(master, MEMCACHED_BEHAVIOR_USE_UDP))
+  {
+    return NULL;
+  }
+
+  memcached_mux_st *mux= new (std::nothrow) memcached_mux_st;
+  if (mux == NULL)
+  {
+    return NULL;
+  }
+
+  mux->master= master;
+  mux->server_count= memcached_server_count(master);
+  mux->per_server= connections_per_server ? connections_per_server : 1;
+  mux->timeout= int32_t(memcached_behavior_get(master, MEMCACHED_BEHAVIOR_POLL_TIMEOUT));
+  mux->auto_eject= memcached_behavior_get(master, MEMCACHED_BEHAVIOR_AUTO_EJECT_HOSTS);
+  mux->prefix_length= 0;
+
+  memcached_return_t rc;
+  const char *prefix= static_cast<const char *>(memcached_callback_get(master, MEMCACHED_CALLBACK_NAMESPACE, &rc));
+  if (prefix)
+  {
+    mux->prefix_length= strlen(prefix);
+    memcpy(mux->prefix, prefix, mux->prefix_length);
+  }
+
+  if ((mux->connections= new (std::nothrow) mux_connection_st[mux->server_count * mux->per_server]) == NULL)
+  {
+    delete mux;
+    return NULL;
+  }
+
+  bool failed= false;
+  for (uint32_t x= 0; x < mux->server_count * mux->per_server; x++)
+  {
+    mux_connection_st& conn= mux->connections[x];
+    pthread_mutex_init(&conn.mutex, NULL);
+    pthread_cond_init(&conn.connected, NULL);
+    conn.fd= -1;
+    conn.broken= false;
+    conn.connecting= false;
+    conn.flushing= false;
+    conn.reading= false;
+    conn.connect_rc= MEMCACHED_SUCCESS;
+    conn.ejected_until= 0;
+    conn.opaque= 0;
+    conn.buffer= NULL;
+    conn.length= 0;
+    conn.capacity= 0;
+    conn.flush_buffer= NULL;
+    conn.flush_capacity= 0;
+    conn.head= conn.tail= NULL;
+    if ((conn.memc= mux_server_create(master, memcached_server_instance_by_position(master, x / mux->per_server))) == NULL)
+    {
+      failed= true;
+    }
+  }
+
+  if (failed)
+  {
+    memcached_mux_destroy(mux);
+    return NULL;
+  }
+
+  return mux;
+}
+
+memcached_st *memcached_mux_destroy(memcached_mux_st *mux)
+{
+  if (mux == NULL)
+  {
+    return NULL;
+  }
+
+  for (uint32_t x= 0; x < mux->server_count * mux->per_server; x++)
+  {
+    mux_connection_st& conn= mux->connections[x];
+    if (conn.memc)
+    {
+      memcached_free(conn.memc);
+    }
+    free(conn.buffer);
+    free(conn.flush_buffer);
+    pthread_cond_destroy(&conn.connected);
+    pthread_mutex_destroy(&conn.mutex);
+  }
+
+  memcached_st *master= mux->master;
+  delete [] mux->connections;
+  delete mux;
+
+  return master;
+}
+
+char *memcached_mux_get(memcached_mux_st *mux,
+                        const char *key, size_t key_length,
+                        size_t *value_length,
+                        uint32_t *flags,
+                        memcached_return_t *error)
+{
+  memcached_return_t unused;
+  if (error == NULL)
+  {
+    error= &unused;
+  }
+
+  if (mux == NULL)
+  {
+    *error= MEMCACHED_INVALID_ARGUMENTS;
+    return NULL;
+  }
+
+  if (memcached_failed(*error= mux_key_check(mux, key, key_length)))
+  {
+    return NULL;
+  }
+
+  protocol_binary_request_header header;
+  mux_header(mux, header, PROTOCOL_BINARY_CMD_GET, 0, key_length, 0);
+
+  mux_request_st request;
+  *error= mux_execute(mux, header, NULL, key, key_length, NULL, 0, request);
+
+  if (value_length)
+  {
+    *value_length= request.value_length;
+  }
+
+  if (flags)
+  {
+    *flags= request.flags;
+  }
+
+  return request.value;
+}
+
+memcached_return_t memcached_mux_set(memcached_mux_st *mux,
+                                     const char *key, size_t key_length,
+                                     const char *value, size_t value_length,
+                                     time_t expiration,
+                                     uint32_t flags)
+{
+  if (mux == NULL or (value == NULL and value_length))
+  {
+    return MEMCACHED_INVALID_ARGUMENTS;
+  }
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= mux_key_check(mux, key, key_length)))
+  {
+    return rc;
+  }
+
+  protocol_binary_request_set request_set;
+  mux_header(mux, request_set.message.header, PROTOCOL_BINARY_CMD_SET, sizeof(request_set.message.body), key_length, value_length);
+  request_set.message.body.flags= htonl(flags);
+  request_set.message.body.expiration= htonl(uint32_t(expiration));
+
+  mux_request_st request;
+  return mux_execute(mux, request_set.message.header, &request_set.message.body, key, key_length, value, value_length, request);
+}
+
+memcached_return_t memcached_mux_delete(memcached_mux_st *mux,
+                                        const char *key, size_t key_length)
+{
+  if (mux == NULL)
+  {
+    return MEMCACHED_INVALID_ARGUMENTS;
+  }
+
+  memcached_return_t rc;
+  if (memcached_failed(rc= mux_key_check(mux, key, key_length)))
+  {
+    return rc;
+  }
+
+  protocol_binary_request_header header;
+  mux_header(mux, header, PROTOCOL_BINARY_CMD_DELETE, 0, key_length, 0);
+
+  mux_request_st request;
+  return mux_execute(mux, header, NULL, key, key_length, NULL, 0, request);
+}
@@ -40,31 +40,150 @@
 
 #include <cassert>
 #include <cerrno>
+#include <climits>
 #include <pthread.h>
+#include <algorithm>
 #include <memory>
+#include <sys/time.h>
+#include <time.h>
+
+#if defined(__linux__)
+# include <linux/futex.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+/*
+  Fetch and release do not take a lock.  The idle clones sit in slots of
+  server_pool, and the slot indexes are kept on two Treiber stacks: "idle"
+  for slots holding a clone and "empty" for slots a release can fill.  The
+  top of each stack packs a 32 bit tag above the slot index +1 (0 being the
+  empty stack), and every change bumps the tag so that a slot which was
+  popped and pushed back between the load and the compare and swap is not
+  mistaken for an unchanged stack.
+
+  A sharded pool (memcached_pool_create_sharded()) keeps a pair of stacks
+  per shard, each on its own cache line.  A thread always starts with the
+  shard it was assigned on first use, which hands back the clone it
+  released last, and only steals from the following shards when its own
+  has nothing.
+
+  The mutex only guards the master, which is cloned when the pool grows or
+  the behaviors change.  Threads only ever wait when every clone is out,
+  and do so on an event count which release only touches if someone is
+  waiting.
+*/
+#define POOL_STACK_EMPTY uint64_t(0)
+#define POOL_CACHE_LINE 64
+
+/*
+  A release looks through the shards this many times for a free slot before
+  deciding that more clones came back than were handed out.
+*/
+#define POOL_STEAL_PASSES 64
+
+struct pool_shard_st
+{
+  uint64_t idle;
+  uint64_t empty;
+  char pad[POOL_CACHE_LINE -2 * sizeof(uint64_t)];
+} __attribute__((aligned(POOL_CACHE_LINE)));
+
+static uint32_t pool_thread_count= 0;
+static __thread uint32_t pool_thread_index= 0;
+
+static inline uint32_t pool_thread_id()
+{
+  if (pool_thread_index == 0)
+  {
+    pool_thread_index= __atomic_add_fetch(&pool_thread_count, 1, __ATOMIC_RELAXED);
+  }
+
+  return pool_thread_index;
+}
+
+static inline void pool_stack_push(uint64_t& head, uint32_t *next, uint32_t index)
+{
+  uint64_t top= __atomic_load_n(&head, __ATOMIC_RELAXED);
+  uint64_t desired;
+  do
+  {
+    __atomic_store_n(&next[index], uint32_t(top), __ATOMIC_RELAXED);
+    desired= (((top >> 32) +1) << 32) | (index +1);
+  } while (__atomic_compare_exchange_n(&head, &top, desired, true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) == false);
+}
+
+static inline bool pool_stack_pop(uint64_t& head, uint32_t *next, uint32_t& index)
+{
+  uint64_t top= __atomic_load_n(&head, __ATOMIC_SEQ_CST);
+  uint64_t desired;
+  do
+  {
+    if (uint32_t(top) == 0)
+    {
+      return false;
+    }
+
+    uint32_t below= __atomic_load_n(&next[uint32_t(top) -1], __ATOMIC_RELAXED);
+    desired= (((top >> 32) +1) << 32) | below;
+  } while (__atomic_compare_exchange_n(&head, &top, desired, true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) == false);
+
+  index= uint32_t(top) -1;
+
+  return true;
+}
+
+static inline void pool_clock(struct timespec& now)
+{
+#if defined(HAVE_CLOCK_GETTIME) && HAVE_CLOCK_GETTIME && defined(CLOCK_MONOTONIC)
+  if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)
+  {
+    return;
+  }
+#endif
+
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  now.tv_sec= tv.tv_sec;
+  now.tv_nsec= long(tv.tv_usec) * 1000;
+}
 
 struct memcached_pool_st
 {
   pthread_mutex_t mutex;
+#if !defined(__linux__)
   pthread_cond_t cond;
+#endif
   memcached_st *master;
   memcached_st **server_pool;
-  int firstfree;
+  uint32_t *next;
+  pool_shard_st *shards;
+  const uint32_t shard_count;
+  uint32_t epoch;
+  uint32_t waiters;
+  int32_t _version;
   const uint32_t size;
   uint32_t current_size;
   bool _owns_master;
   struct timespec _timeout;
 
-  memcached_pool_st(memcached_st *master_arg, size_t max_arg) :
+  memcached_pool_st(memcached_st *master_arg, size_t max_arg, uint32_t shards_arg) :
     master(master_arg),
     server_pool(NULL),
-    firstfree(-1),
+    next(NULL),
+    shards(NULL),
+    shard_count(shards_arg),
+    epoch(0),
+    waiters(0),
+    _version(master_arg->configure.version),
     size(uint32_t(max_arg)),
     current_size(0),
     _owns_master(false)
   {
     pthread_mutex_init(&mutex, NULL);
+#if !defined(__linux__)
     pthread_cond_init(&cond, NULL);
+#endif
     _timeout.tv_sec= 5;
     _timeout.tv_nsec= 0;
   }
@@ -83,10 +202,14 @@ struct memcached_pool_st
 
   ~memcached_pool_st()
   {
-    for (int x= 0; x <= firstfree; ++x)
+    for (uint32_t x= 0; shards and x < shard_count; x++)
     {
-      memcached_free(server_pool[x]);
-      server_pool[x]= NULL;
+      uint32_t index;
+      while (pool_stack_pop(shards[x].idle, next, index))
+      {
+        memcached_free(server_pool[index]);
+        server_pool[index]= NULL;
+      }
     }
 
     int error;
@@ -95,21 +218,27 @@ struct memcached_pool_st
       assert_vmsg(error != 0, "pthread_mutex_destroy() %s(%d)", strerror(error), error);
     }
 
+#if !defined(__linux__)
     if ((error= pthread_cond_destroy(&cond)) != 0)
     {
       assert_vmsg(error != 0, "pthread_cond_destroy() %s", strerror(error));
     }
+#endif
 
     delete [] server_pool;
+    delete [] next;
+    delete [] shards;
     if (_owns_master)
     {
       memcached_free(master);
     }
   }
 
+  // Caller holds the mutex
   void increment_version()
   {
     ++master->configure.version;
+    __atomic_store_n(&_version, master->configure.version, __ATOMIC_RELEASE);
   }
 
   bool compare_version(const memcached_st *arg) const
@@ -119,64 +248,267 @@ struct memcached_pool_st
 
   int32_t version() const
   {
-    return master->configure.version;
+    return __atomic_load_n(&_version, __ATOMIC_ACQUIRE);
+  }
+
+  uint32_t shard() const
+  {
+    if (shard_count == 1)
+    {
+      return 0;
+    }
+
+    return pool_thread_id() % shard_count;
+  }
+
+  memcached_st *pop()
+  {
+    const uint32_t home= shard();
+    for (uint32_t x= 0; x < shard_count; x++)
+    {
+      uint32_t index;
+      if (pool_stack_pop(shards[(home +x) % shard_count].idle, next, index))
+      {
+        memcached_st *ret= server_pool[index];
+        pool_stack_push(shards[home].empty, next, index);
+
+        return ret;
+      }
+    }
+
+    return NULL;
+  }
+
+  bool push(memcached_st *released, const uint32_t home)
+  {
+    const uint32_t passes= shard_count == 1 ? 1 : POOL_STEAL_PASSES;
+    for (uint32_t x= 0; x < passes * shard_count; x++)
+    {
+      uint32_t index;
+      if (pool_stack_pop(shards[(home +x) % shard_count].empty, next, index))
+      {
+        server_pool[index]= released;
+        pool_stack_push(shards[home].idle, next, index);
+
+        return true;
+      }
+    }
+
+    return false;
   }
+
+  memcached_st *refresh(memcached_st *);
+  memcached_st *grow(bool& exhausted);
+  bool wait(uint32_t key, const struct timespec& deadline);
+  void notify();
 };
 
+/*
+  A clone which missed a memcached_pool_behavior_set() is replaced with a
+  fresh clone of the master.  If we fail to clone, we keep the old one
+  around.
+*/
+memcached_st *memcached_pool_st::refresh(memcached_st *stale)
+{
+  if (pthread_mutex_lock(&mutex) != 0)
+  {
+    return stale;
+  }
+
+  memcached_st *memc;
+  if ((memc= memcached_clone(NULL, master)))
+  {
+    memcached_free(stale);
+    stale= memc;
+  }
+
+  int error;
+  if ((error= pthread_mutex_unlock(&mutex)) != 0)
+  {
+    assert_vmsg(error != 0, "pthread_mutex_unlock() %s", strerror(error));
+  }
+
+  return stale;
+}
 
 /**
- * Grow the connection pool by creating a connection structure and clone the
- * original memcached handle.
+ * Grow the connection pool by cloning the original memcached handle.  The
+ * new clone goes straight to the caller.
  */
-static bool grow_pool(memcached_pool_st* pool)
+memcached_st *memcached_pool_st::grow(bool& exhausted)
 {
-  assert(pool);
+  uint32_t current= __atomic_load_n(&current_size, __ATOMIC_RELAXED);
+  do
+  {
+    if (current >= size)
+    {
+      exhausted= true;
+      return NULL;
+    }
+  } while (__atomic_compare_exchange_n(&current_size, &current, current +1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == false);
+
+  exhausted= false;
+
+  memcached_st *obj= NULL;
+  if (pthread_mutex_lock(&mutex) == 0)
+  {
+    if ((obj= memcached_clone(NULL, master)))
+    {
+      obj->configure.version= master->configure.version;
+    }
+
+    int error;
+    if ((error= pthread_mutex_unlock(&mutex)) != 0)
+    {
+      assert_vmsg(error != 0, "pthread_mutex_unlock() %s", strerror(error));
+    }
+  }
+
+  if (obj == NULL)
+  {
+    __atomic_fetch_sub(&current_size, 1, __ATOMIC_RELAXED);
+  }
+
+  return obj;
+}
 
-  memcached_st *obj;
-  if (not (obj= memcached_clone(NULL, pool->master)))
+#if defined(__linux__)
+bool memcached_pool_st::wait(uint32_t key, const struct timespec& deadline)
+{
+  struct timespec now;
+  pool_clock(now);
+
+  struct timespec remaining;
+  remaining.tv_sec= deadline.tv_sec -now.tv_sec;
+  remaining.tv_nsec= deadline.tv_nsec -now.tv_nsec;
+  if (remaining.tv_nsec < 0)
+  {
+    remaining.tv_sec--;
+    remaining.tv_nsec+= 1000000000;
+  }
+
+  if (remaining.tv_sec < 0)
   {
     return false;
   }
 
-  pool->server_pool[++pool->firstfree]= obj;
-  pool->current_size++;
-  obj->configure.version= pool->version();
+  if (syscall(SYS_futex, &epoch, FUTEX_WAIT_PRIVATE, key, &remaining, NULL, 0) == -1 and errno == ETIMEDOUT)
+  {
+    return false;
+  }
 
   return true;
 }
 
+void memcached_pool_st::notify()
+{
+  __atomic_fetch_add(&epoch, 1, __ATOMIC_SEQ_CST);
+  syscall(SYS_futex, &epoch, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+#else
+bool memcached_pool_st::wait(uint32_t key, const struct timespec& deadline)
+{
+  struct timespec now;
+  pool_clock(now);
+
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+
+  struct timespec time_to_wait;
+  time_to_wait.tv_sec= tv.tv_sec +(deadline.tv_sec -now.tv_sec);
+  time_to_wait.tv_nsec= long(tv.tv_usec) * 1000 +(deadline.tv_nsec -now.tv_nsec);
+  if (time_to_wait.tv_nsec < 0)
+  {
+    time_to_wait.tv_sec--;
+    time_to_wait.tv_nsec+= 1000000000;
+  }
+  else if (time_to_wait.tv_nsec >= 1000000000)
+  {
+    time_to_wait.tv_sec++;
+    time_to_wait.tv_nsec-= 1000000000;
+  }
+
+  if (pthread_mutex_lock(&mutex) != 0)
+  {
+    return false;
+  }
+
+  int thread_ret= 0;
+  while (__atomic_load_n(&epoch, __ATOMIC_SEQ_CST) == key and thread_ret == 0)
+  {
+    thread_ret= pthread_cond_timedwait(&cond, &mutex, &time_to_wait);
+  }
+
+  int error;
+  if ((error= pthread_mutex_unlock(&mutex)) != 0)
+  {
+    assert_vmsg(error != 0, "pthread_mutex_unlock() %s", strerror(error));
+  }
+
+  return (thread_ret != ETIMEDOUT);
+}
+
+void memcached_pool_st::notify()
+{
+  if (pthread_mutex_lock(&mutex) == 0)
+  {
+    __atomic_fetch_add(&epoch, 1, __ATOMIC_SEQ_CST);
+    pthread_cond_signal(&cond);
+    pthread_mutex_unlock(&mutex);
+  }
+}
+#endif
+
 bool memcached_pool_st::init(uint32_t initial)
 {
   server_pool= new (std::nothrow) memcached_st *[size];
-  if (server_pool == NULL)
+  next= new (std::nothrow) uint32_t[size];
+  shards= new (std::nothrow) pool_shard_st[shard_count];
+  if (server_pool == NULL or next == NULL or shards == NULL)
   {
     return false;
   }
 
+  for (uint32_t x= 0; x < shard_count; x++)
+  {
+    shards[x].idle= POOL_STACK_EMPTY;
+    shards[x].empty= POOL_STACK_EMPTY;
+  }
+
+  for (uint32_t x= size; x > 0; --x)
+  {
+    server_pool[x -1]= NULL;
+    pool_stack_push(shards[(x -1) % shard_count].empty, next, x -1);
+  }
+
   /*
     Try to create the initial size of the pool. An allocation failure at
     this time is not fatal..
   */
   for (unsigned int x= 0; x < initial; ++x)
   {
-    if (grow_pool(this) == false)
+    bool exhausted;
+    memcached_st *obj;
+    if ((obj= grow(exhausted)) == NULL)
     {
       break;
     }
+
+    push(obj, x % shard_count);
   }
 
   return true;
 }
 
 
-static inline memcached_pool_st *_pool_create(memcached_st* master, uint32_t initial, uint32_t max)
+static inline memcached_pool_st *_pool_create(memcached_st* master, uint32_t initial, uint32_t max, uint32_t shards)
 {
-  if (initial == 0 or max == 0 or (initial > max))
+  if (initial == 0 or max == 0 or (initial > max) or shards == 0)
   {
     return NULL;
   }
 
-  memcached_pool_st *object= new (std::nothrow) memcached_pool_st(master, max);
+  memcached_pool_st *object= new (std::nothrow) memcached_pool_st(master, max, shards);
   if (object == NULL)
   {
     return NULL;
@@ -197,7 +529,12 @@ static inline memcached_pool_st *_pool_create(memcached_st* master, uint32_t ini
 
 memcached_pool_st *memcached_pool_create(memcached_st* master, uint32_t initial, uint32_t max)
 {
-  return _pool_create(master, initial, max);
+  return _pool_create(master, initial, max, 1);
+}
+
+memcached_pool_st *memcached_pool_create_sharded(memcached_st* master, uint32_t initial, uint32_t max, uint32_t shards)
+{
+  return _pool_create(master, initial, max, std::min(shards, max));
 }
 
 memcached_pool_st * memcached_pool(const char *option_string, size_t option_string_length)
@@ -252,71 +589,72 @@ memcached_st* memcached_pool_st::fetch(const struct timespec& relative_time, mem
 {
   rc= MEMCACHED_SUCCESS;
 
-  int error;
-  if ((error= pthread_mutex_lock(&mutex)) != 0)
-  {
-    rc= MEMCACHED_IN_PROGRESS;
-    return NULL;
-  }
+  struct timespec deadline= { 0, 0 };
+  bool waited= false;
 
-  memcached_st *ret= NULL;
-  do
+  memcached_st *ret;
+  while ((ret= pop()) == NULL)
   {
-    if (firstfree > -1)
+    bool exhausted;
+    if ((ret= grow(exhausted)))
     {
-      ret= server_pool[firstfree--];
+      return ret;
     }
-    else if (current_size == size)
-    {
-      if (relative_time.tv_sec == 0 and relative_time.tv_nsec == 0)
-      {
-        error= pthread_mutex_unlock(&mutex);
-        rc= MEMCACHED_NOTFOUND;
 
-        return NULL;
-      }
+    if (exhausted == false)
+    {
+      return NULL;
+    }
 
-      struct timespec time_to_wait= {0, 0};
-      time_to_wait.tv_sec= time(NULL) +relative_time.tv_sec;
-      time_to_wait.tv_nsec= relative_time.tv_nsec;
+    if (relative_time.tv_sec == 0 and relative_time.tv_nsec == 0)
+    {
+      rc= MEMCACHED_NOTFOUND;
+      return NULL;
+    }
 
-      int thread_ret;
-      if ((thread_ret= pthread_cond_timedwait(&cond, &mutex, &time_to_wait)) != 0)
+    if (waited == false)
+    {
+      pool_clock(deadline);
+      deadline.tv_sec+= relative_time.tv_sec;
+      deadline.tv_nsec+= relative_time.tv_nsec;
+      if (deadline.tv_nsec >= 1000000000)
       {
-        int unlock_error;
-        if ((unlock_error= pthread_mutex_unlock(&mutex)) != 0)
-        {
-          assert_vmsg(error != 0, "pthread_mutex_unlock() %s", strerror(error));
-        }
-
-        if (thread_ret == ETIMEDOUT)
-        {
-          rc= MEMCACHED_TIMEOUT;
-        }
-        else
-        {
-          errno= thread_ret;
-          rc= MEMCACHED_ERRNO;
-        }
-
-        return NULL;
+        deadline.tv_sec++;
+        deadline.tv_nsec-= 1000000000;
       }
+      waited= true;
     }
-    else if (grow_pool(this) == false)
+
+    /*
+      Announce ourselves before looking at the stack one last time, so that
+      a release either leaves us its clone or sees us and bumps the epoch.
+    */
+    uint32_t key= __atomic_load_n(&epoch, __ATOMIC_SEQ_CST);
+    __atomic_fetch_add(&waiters, 1, __ATOMIC_SEQ_CST);
+    if ((ret= pop()))
+    {
+      __atomic_fetch_sub(&waiters, 1, __ATOMIC_SEQ_CST);
+      break;
+    }
+
+    bool woken= wait(key, deadline);
+    __atomic_fetch_sub(&waiters, 1, __ATOMIC_SEQ_CST);
+
+    if (woken == false)
     {
-      int unlock_error;
-      if ((unlock_error= pthread_mutex_unlock(&mutex)) != 0)
+      if ((ret= pop()))
       {
-        assert_vmsg(error != 0, "pthread_mutex_unlock() %s", strerror(error));
+        break;
       }
 
+      rc= MEMCACHED_TIMEOUT;
       return NULL;
     }
-  } while (ret == NULL);
+  }
 
-  if ((error= pthread_mutex_unlock(&mutex)) != 0)
+  if (compare_version(ret) == false)
   {
-    assert_vmsg(error != 0, "pthread_mutex_unlock() %s", strerror(error));
+    ret= refresh(ret);
   }
 
   return ret;
@@ -331,39 +669,36 @@ bool memcached_pool_st::release(memcached_st *released, memcached_return_t& rc)
     return false;
   }
 
-  int error;
-  if ((error= pthread_mutex_lock(&mutex)))
+#ifndef NDEBUG
   {
-    rc= MEMCACHED_IN_PROGRESS;
-    return false;
+    // The next thread to fetch the handle owns its slab, nothing may still point into it.
+    memcached_slab_stat_st slab;
+    if (memcached_slab_stat(released, &slab) == MEMCACHED_SUCCESS)
+    {
+      assert_msg(slab.in_use == 0, "memcached_result_st created from a slab allocating memcached_st must be freed before it is released to the pool");
+    }
   }
+#endif
 
   /* 
     Someone updated the behavior on the object, so we clone a new memcached_st with the new settings. If we fail to clone, we keep the old one around.
   */
   if (compare_version(released) == false)
   {
-    memcached_st *memc;
-    if ((memc= memcached_clone(NULL, master)))
-    {
-      memcached_free(released);
-      released= memc;
-    }
+    released= refresh(released);
   }
 
-  server_pool[++firstfree]= released;
-
-  if (firstfree == 0 and current_size == size)
+  // More releases than fetches leave no slot to put the clone in
+  if (push(released, shard()) == false)
   {
-    /* we might have people waiting for a connection.. wake them up :-) */
-    if ((error= pthread_cond_broadcast(&cond)) != 0)
-    {
-      assert_vmsg(error != 0, "pthread_cond_broadcast() %s", strerror(error));
-    }
+    rc= MEMCACHED_INVALID_ARGUMENTS;
+    return false;
   }
 
-  if ((error= pthread_mutex_unlock(&mutex)) != 0)
+  if (__atomic_load_n(&waiters, __ATOMIC_SEQ_CST))
   {
+    /* we might have people waiting for a connection.. wake them up :-) */
+    notify();
   }
 
   return true;
@@ -465,20 +800,40 @@ memcached_return_t memcached_pool_behavior_set(memcached_pool_st *pool,
   }
 
   pool->increment_version();
+
+  /*
+    Take every idle clone off the stacks while we update it.  Fetches in the
+    meantime grow the pool or wait, and clones that are out get replaced
+    when they come back.
+  */
+  uint32_t updating= 0;
+  uint32_t index;
+  for (uint32_t x= 0; x < pool->shard_count; x++)
+  {
+    while (pool_stack_pop(pool->shards[x].idle, pool->next, index))
+    {
+      __atomic_store_n(&pool->next[index], updating, __ATOMIC_RELAXED);
+      updating= index +1;
+    }
+  }
+
   /* update the clones */
-  for (int xx= 0; xx <= pool->firstfree; ++xx)
+  while (updating)
   {
-    if (memcached_success(memcached_behavior_set(pool->server_pool[xx], flag, data)))
+    index= updating -1;
+    updating= __atomic_load_n(&pool->next[index], __ATOMIC_RELAXED);
+
+    if (memcached_success(memcached_behavior_set(pool->server_pool[index], flag, data)))
     {
-      pool->server_pool[xx]->configure.version= pool->version();
+      pool->server_pool[index]->configure.version= pool->version();
     }
     else
     {
       memcached_st *memc;
       if ((memc= memcached_clone(NULL, pool->master)))
       {
-        memcached_free(pool->server_pool[xx]);
-        pool->server_pool[xx]= memc;
+        memcached_free(pool->server_pool[index]);
+        pool->server_pool[index]= memc;
         /* I'm not sure what to do in this case.. this would happen
           if we fail to push the server list inside the client..
           I should add a testcase for this, but I believe the following
@@ -487,6 +842,8 @@ memcached_return_t memcached_pool_behavior_set(memcached_pool_st *pool,
         */
       }
     }
+
+    pool_stack_push(pool->shards[index % pool->shard_count].idle, pool->next, index);
   }
 
   if ((error= pthread_mutex_unlock(&pool->mutex)) != 0)
@@ -494,6 +851,11 @@ memcached_return_t memcached_pool_behavior_set(memcached_pool_st *pool,
     assert_vmsg(error != 0, "pthread_mutex_unlock() %s", strerror(error));
   }
 
+  if (__atomic_load_n(&pool->waiters, __ATOMIC_SEQ_CST))
+  {
+    pool->notify();
+  }
+
   return rc;
 }
 
@@ -0,0 +1,91 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+LIBTEST_LOCAL
+test_return_t continuum_lookup_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_lookup_skewed_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_lookup_benchmark_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_eject_rejoin_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_load_balance_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_64bit_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_jump_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_rendezvous_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_rendezvous_skeleton_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_maglev_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_maglev_benchmark_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_bounded_load_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_route_dispatch_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_namespace_hash_TEST(void *);
+
+LIBTEST_LOCAL
+test_return_t continuum_snapshot_TEST(void *);
+
+#ifdef	__cplusplus
+}
+#endif
@@ -42,6 +42,7 @@ extern "C" {
 #endif
 
 test_return_t memcached_increment_MEMCACHED_NO_SERVERS(memcached_st *junk);
+test_return_t memcached_last_error_message_MEMCACHED_CONNECTION_FAILURE(memcached_st *junk);
 
 #ifdef	__cplusplus
 }
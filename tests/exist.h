@@ -40,3 +40,5 @@ test_return_t memcached_exist_NOTFOUND(memcached_st *);
 test_return_t memcached_exist_SUCCESS(memcached_st *);
 test_return_t memcached_exist_by_key_NOTFOUND(memcached_st *);
 test_return_t memcached_exist_by_key_SUCCESS(memcached_st *);
+test_return_t memcached_exist_multi_TEST(memcached_st *);
+test_return_t memcached_delete_multi_by_key_TEST(memcached_st *);
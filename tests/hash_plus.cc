@@ -147,6 +147,14 @@ static test_return_t set_function_test(void *)
       list= jenkins_values;
       break;
 
+    case HASHKIT_HASH_XXH3:
+      list= xxh3_values;
+      break;
+
+    case HASHKIT_HASH_CRC32C:
+      list= crc32c_values;
+      break;
+
     case HASHKIT_HASH_CUSTOM:
     case HASHKIT_HASH_MAX:
     default:
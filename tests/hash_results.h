@@ -126,6 +126,22 @@ static uint32_t murmur_values[]= {  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
 static uint32_t murmur3_values[]= {  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
 #endif
 
+static uint32_t xxh3_values[]= { 2657470733U, 3239811088U, 3047457128U, 370129074U,
+                                 1364857384U, 363347465U, 2921030332U, 2677961388U,
+                                 4079190395U, 820289633U, 3388081101U, 3139569722U,
+                                 756241881U, 2611714491U, 4010262603U, 2409766264U,
+                                 4130112874U, 3691506295U, 917311913U, 2961176051U,
+                                 4017847959U, 147442841U, 3403049444U, 914861369U,
+                                 2460909569U };
+
+static uint32_t crc32c_values[]= { 2513123946U, 3003191520U, 503655184U, 1933619769U,
+                                   3080871056U, 1088145081U, 3871982361U, 3819992991U,
+                                   2539766218U, 2995985593U, 1468500164U, 371465635U,
+                                   1769471702U, 3623221253U, 699239898U, 3762927545U,
+                                   2887605124U, 2273338330U, 1750492962U, 3834194387U,
+                                   1653083891U, 1192520133U, 3405429948U, 3568409415U,
+                                   1047257905U };
+
 static uint32_t jenkins_values[]= { 1442444624U, 4253821186U, 1885058256U, 2120131735U,
                                     3261968576U, 3515188778U, 4232909173U, 4288625128U,
                                     1812047395U, 3689182164U, 2502979932U, 1214050606U,
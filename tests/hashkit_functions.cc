@@ -43,6 +43,7 @@ using namespace libtest;
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <algorithm>
 
 #include <libhashkit-1.0/hashkit.h>
 #include <libhashkit/is.h>
@@ -318,8 +319,191 @@ static test_return_t jenkins_run (hashkit_st *)
   return TEST_SUCCESS;
 }
 
+static test_return_t xxh3_TEST(hashkit_st *)
+{
+  uint32_t x;
+  const char **ptr;
+
+  for (ptr= list_to_hash, x= 0; *ptr; ptr++, x++)
+  {
+    test_compare(xxh3_values[x],
+                 libhashkit_xxh3(*ptr, strlen(*ptr)));
+  }
+
+  // The empty key, and keys on either side of each length class, from the
+  // xxHash reference implementation.
+  test_compare(uint32_t(0x2D068005U ^ 0x38D394C2U), libhashkit_xxh3("", 0));
+
+  struct {
+    size_t length;
+    uint32_t value;
+  } classes[]= { { 1, 2628275034U }, { 3, 2284789980U }, { 4, 1745859372U }, { 8, 1236284709U },
+                 { 9, 1860350280U }, { 16, 1245839074U }, { 17, 3853067693U }, { 128, 3491611955U },
+                 { 129, 3439422561U }, { 240, 2305044178U }, { 241, 3104541127U }, { 1024, 3855205318U } };
+
+  char buffer[1024];
+  for (size_t y= 0; y < sizeof(buffer); y++)
+  {
+    buffer[y]= char(y * 131 +7);
+  }
+
+  for (size_t y= 0; y < sizeof(classes) / sizeof(classes[0]); y++)
+  {
+    test_compare(classes[y].value, libhashkit_xxh3(buffer, classes[y].length));
+  }
+
+  return TEST_SUCCESS;
+}
+
+static uint32_t crc32c_bitwise(const char *key, size_t key_length)
+{
+  uint32_t crc= UINT32_MAX;
+  for (size_t x= 0; x < key_length; x++)
+  {
+    crc^= uint8_t(key[x]);
+    for (int bit= 0; bit < 8; bit++)
+    {
+      crc= (crc >> 1) ^ (0x82F63B78U & (0 - (crc & 1)));
+    }
+  }
 
+  return ~crc;
+}
+
+static test_return_t crc32c_TEST(hashkit_st *)
+{
+  uint32_t x;
+  const char **ptr;
+
+  for (ptr= list_to_hash, x= 0; *ptr; ptr++, x++)
+  {
+    test_compare(crc32c_values[x],
+                 libhashkit_crc32c(*ptr, strlen(*ptr)));
+  }
+
+  test_compare(0xE3069283U, libhashkit_crc32c("123456789", 9));
+
+  // Whichever implementation the CPU selects has to agree with the
+  // definition at every alignment and tail length.
+  char buffer[1024 +8];
+  for (size_t y= 0; y < sizeof(buffer); y++)
+  {
+    buffer[y]= char(y * 131 +7);
+  }
+
+  for (size_t length= 0; length < 1024; length+= length < 64 ? 1 : 61)
+  {
+    for (size_t offset= 0; offset < 8; offset++)
+    {
+      test_compare(crc32c_bitwise(buffer +offset, length),
+                   libhashkit_crc32c(buffer +offset, length));
+    }
+  }
 
+  return TEST_SUCCESS;
+}
+
+/*
+  Feeding a key in two pieces, or as a reusable prefix plus the rest, has
+  to give the same value as hashing it in one go.
+*/
+static test_return_t stream_TEST(hashkit_st *)
+{
+  char key[200];
+  for (size_t x= 0; x < sizeof(key); x++)
+  {
+    // Include bytes with the high bit set, which some hashes sign extend
+    key[x]= char(x * 37 +11);
+  }
+
+  for (int algo= int(HASHKIT_HASH_DEFAULT); algo < int(HASHKIT_HASH_MAX); algo++)
+  {
+    hashkit_hash_algorithm_t hash= static_cast<hashkit_hash_algorithm_t>(algo);
+    hashkit_stream_st stream;
+    if (hash == HASHKIT_HASH_CUSTOM or libhashkit_has_algorithm(hash) == false)
+    {
+      test_compare(HASHKIT_INVALID_ARGUMENT, hashkit_stream_init(&stream, hash));
+      continue;
+    }
+
+    for (size_t length= 0; length <= sizeof(key); length+= length < 80 ? 1 : 40)
+    {
+      uint32_t expected= libhashkit_digest(key, length, hash);
+
+      for (size_t split= 0; split <= length; split++)
+      {
+        test_compare(HASHKIT_SUCCESS, hashkit_stream_init(&stream, hash));
+        test_compare(HASHKIT_SUCCESS, hashkit_stream_update(&stream, key, split));
+        test_compare(expected, hashkit_stream_digest(&stream, key +split, length -split));
+
+        // The prefix is left as it was
+        test_compare(split, stream.length);
+        test_compare(HASHKIT_SUCCESS, hashkit_stream_update(&stream, key +split, length -split));
+        test_compare(expected, hashkit_stream_final(&stream));
+      }
+    }
+  }
+
+  hashkit_stream_st stream;
+  test_compare(HASHKIT_INVALID_ARGUMENT, hashkit_stream_init(&stream, HASHKIT_HASH_CUSTOM));
+  test_compare(HASHKIT_INVALID_ARGUMENT, hashkit_stream_init(&stream, HASHKIT_HASH_MAX));
+
+  // Algorithms seeded with the length can only buffer so much
+  test_compare(HASHKIT_SUCCESS, hashkit_stream_init(&stream, HASHKIT_HASH_JENKINS));
+  test_compare(HASHKIT_SUCCESS, hashkit_stream_update(&stream, key, sizeof(key)));
+  test_compare(HASHKIT_INVALID_ARGUMENT, hashkit_stream_update(&stream, key, HASHKIT_STREAM_BUFFER_SIZE));
+  test_compare(libhashkit_jenkins(key, sizeof(key)), hashkit_stream_final(&stream));
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Throughput of each algorithm on key sized and larger inputs.
+*/
+static test_return_t hash_benchmark_TEST(hashkit_st *)
+{
+  const size_t lengths[]= { 16, 64, 250, 4096 };
+  const size_t bytes= 16 * 1024 * 1024;
+
+  char buffer[4096];
+  for (size_t x= 0; x < sizeof(buffer); x++)
+  {
+    buffer[x]= char('a' + (x * 7) % 26);
+  }
+
+  for (int algo= int(HASHKIT_HASH_DEFAULT); algo < int(HASHKIT_HASH_MAX); algo++)
+  {
+    hashkit_hash_algorithm_t hash= static_cast<hashkit_hash_algorithm_t>(algo);
+    if (hash == HASHKIT_HASH_CUSTOM or libhashkit_has_algorithm(hash) == false)
+    {
+      continue;
+    }
+
+    for (size_t x= 0; x < sizeof(lengths) / sizeof(lengths[0]); x++)
+    {
+      size_t rounds= bytes / lengths[x];
+      uint32_t sum= 0;
+
+      Timer timer;
+      timer.reset();
+      for (size_t y= 0; y < rounds; y++)
+      {
+        buffer[y % lengths[x]]++;
+        sum+= libhashkit_digest(buffer, lengths[x], hash);
+      }
+      timer.sample();
+      test_true(sum);
+
+      struct timespec elapsed;
+      timer.difference(elapsed);
+      double seconds= std::max(double(elapsed.tv_sec) + double(elapsed.tv_nsec) / 1000000000, 0.000001);
+      Out << libhashkit_string_hash(hash) << " " << lengths[x] << " byte keys: "
+        << uint64_t(double(bytes / 1024 / 1024) / seconds) << " MB/sec";
+    }
+  }
+
+  return TEST_SUCCESS;
+}
 
 /**
   @brief now we list out the tests.
@@ -395,6 +579,14 @@ static test_return_t hashkit_set_function_test(hashkit_st *hashk)
       list= jenkins_values;
       break;
 
+    case HASHKIT_HASH_XXH3:
+      list= xxh3_values;
+      break;
+
+    case HASHKIT_HASH_CRC32C:
+      list= crc32c_values;
+      break;
+
     case HASHKIT_HASH_CUSTOM:
     case HASHKIT_HASH_MAX:
     default:
@@ -532,6 +724,10 @@ test_st hash_tests[] ={
   {"murmur", 0, (test_callback_fn*)murmur_run },
   {"murmur3", 0, (test_callback_fn*)murmur3_TEST },
   {"jenkis", 0, (test_callback_fn*)jenkins_run },
+  {"xxh3", 0, (test_callback_fn*)xxh3_TEST },
+  {"crc32c", 0, (test_callback_fn*)crc32c_TEST },
+  {"stream", 0, (test_callback_fn*)stream_TEST },
+  {"benchmark", 0, (test_callback_fn*)hash_benchmark_TEST },
   {0, 0, (test_callback_fn*)0}
 };
 
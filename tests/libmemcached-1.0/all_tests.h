@@ -58,6 +58,7 @@ test_st tests[] ={
   {"memcached_set()", false, (test_callback_fn*)set_test },
   {"memcached_set() 2", false, (test_callback_fn*)set_test2 },
   {"memcached_set() 3", false, (test_callback_fn*)set_test3 },
+  {"memcached_mset()", false, (test_callback_fn*)mset_test },
   {"memcached_add(SUCCESS)", true, (test_callback_fn*)memcached_add_SUCCESS_TEST },
   {"add", true, (test_callback_fn*)add_test },
   {"memcached_fetch_result(MEMCACHED_NOTFOUND)", true, (test_callback_fn*)memcached_fetch_result_NOT_FOUND },
@@ -68,6 +69,7 @@ test_st tests[] ={
   {"get3", false, (test_callback_fn*)get_test3 },
   {"get4", false, (test_callback_fn*)get_test4 },
   {"partial mget", false, (test_callback_fn*)get_test5 },
+  {"get/set syscalls", true, (test_callback_fn*)get_syscall_TEST },
   {"stats_servername", false, (test_callback_fn*)stats_servername_test },
   {"increment", false, (test_callback_fn*)increment_test },
   {"memcached_increment_with_initial(0)", true, (test_callback_fn*)increment_with_initial_test },
@@ -75,6 +77,7 @@ test_st tests[] ={
   {"decrement", false, (test_callback_fn*)decrement_test },
   {"memcached_decrement_with_initial(3)", true, (test_callback_fn*)decrement_with_initial_test },
   {"memcached_decrement_with_initial(999)", true, (test_callback_fn*)decrement_with_initial_999_test },
+  {"memcached_increment_multi_with_initial()", true, (test_callback_fn*)increment_multi_with_initial_test },
   {"increment_by_key", false, (test_callback_fn*)increment_by_key_test },
   {"increment_with_initial_by_key", true, (test_callback_fn*)increment_with_initial_by_key_test },
   {"decrement_by_key", false, (test_callback_fn*)decrement_by_key_test },
@@ -112,8 +115,11 @@ test_st tests[] ={
   {"memcached_exist(MEMCACHED_SUCCESS)", true, (test_callback_fn*)memcached_exist_SUCCESS },
   {"memcached_exist_by_key(MEMCACHED_NOTFOUND)", true, (test_callback_fn*)memcached_exist_by_key_NOTFOUND },
   {"memcached_exist_by_key(MEMCACHED_SUCCESS)", true, (test_callback_fn*)memcached_exist_by_key_SUCCESS },
+  {"memcached_exist_multi()", true, (test_callback_fn*)memcached_exist_multi_TEST },
+  {"memcached_delete_multi_by_key()", true, (test_callback_fn*)memcached_delete_multi_by_key_TEST },
   {"memcached_touch", 0, (test_callback_fn*)test_memcached_touch},
   {"memcached_touch_with_prefix", 0, (test_callback_fn*)test_memcached_touch_by_key},
+  {"memcached_touch_multi", 0, (test_callback_fn*)test_memcached_touch_multi},
 #if 0
   {"memcached_dump() no data", true, (test_callback_fn*)memcached_dump_TEST },
 #endif
@@ -124,6 +130,7 @@ test_st tests[] ={
 test_st touch_tests[] ={
   {"memcached_touch", 0, (test_callback_fn*)test_memcached_touch},
   {"memcached_touch_with_prefix", 0, (test_callback_fn*)test_memcached_touch_by_key},
+  {"memcached_touch_multi", 0, (test_callback_fn*)test_memcached_touch_multi},
   {0, 0, 0}
 };
 
@@ -135,6 +142,7 @@ test_st kill_TESTS[] ={
 test_st memcached_stat_tests[] ={
   {"memcached_stat() INVALID ARG", 0, (test_callback_fn*)memcached_stat_TEST},
   {"memcached_stat()", 0, (test_callback_fn*)memcached_stat_TEST2},
+  {"memcached_stat() all servers", 0, (test_callback_fn*)memcached_stat_TEST3},
   {0, 0, 0}
 };
 
@@ -249,6 +257,8 @@ test_st replication_tests[]= {
   {"mget", false, (test_callback_fn*)replication_mget_test },
   {"delete", true, (test_callback_fn*)replication_delete_test },
   {"rand_mget", false, (test_callback_fn*)replication_randomize_mget_test },
+  {"hedged_mget", false, (test_callback_fn*)replication_hedged_mget_test },
+  {"least_loaded_mget", false, (test_callback_fn*)replication_least_loaded_mget_test },
   {"miss", false, (test_callback_fn*)replication_miss_test },
   {"fail", false, (test_callback_fn*)replication_randomize_mget_fail_test },
   {0, 0, (test_callback_fn*)0}
@@ -369,6 +379,8 @@ test_st hash_tests[] ={
   {"murmur", false, (test_callback_fn*)murmur_run },
   {"murmur3", false, (test_callback_fn*)murmur3_TEST },
   {"jenkis", false, (test_callback_fn*)jenkins_run },
+  {"xxh3", false, (test_callback_fn*)xxh3_TEST },
+  {"crc32c", false, (test_callback_fn*)crc32c_TEST },
   {"memcached_get_hashkit", false, (test_callback_fn*)memcached_get_hashkit_test },
   {0, 0, (test_callback_fn*)0}
 };
@@ -380,6 +392,7 @@ test_st error_conditions[] ={
   {"memcached_get_by_key(MEMCACHED_NOTFOUND)", false, (test_callback_fn*)memcached_get_by_key_MEMCACHED_NOTFOUND },
   {"memcached_get_by_key(MEMCACHED_NOTFOUND)", false, (test_callback_fn*)memcached_get_by_key_MEMCACHED_NOTFOUND },
   {"memcached_increment(MEMCACHED_NO_SERVERS)", false, (test_callback_fn*)memcached_increment_MEMCACHED_NO_SERVERS },
+  {"memcached_last_error_message(MEMCACHED_CONNECTION_FAILURE)", false, (test_callback_fn*)memcached_last_error_message_MEMCACHED_CONNECTION_FAILURE },
   {0, 0, (test_callback_fn*)0}
 };
 
@@ -418,6 +431,9 @@ test_st memcached_server_add_TESTS[] ={
 
 test_st pool_TESTS[] ={
   {"lp:962815", true, (test_callback_fn*)regression_bug_962815 },
+  {"contention", true, (test_callback_fn*)connection_pool_contention_TEST },
+  {"sharded benchmark", true, (test_callback_fn*)connection_pool_shard_benchmark_TEST },
+  {"memcached_mux_st", true, (test_callback_fn*)memcached_mux_TEST },
   {0, 0, (test_callback_fn*)0}
 };
 
@@ -0,0 +1,1228 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+// We let libmemcached/common.h define config since we are looking at
+// library internals.
+
+#include <libmemcached/common.h>
+
+#include <libtest/test.hpp>
+
+#include <tests/continuum.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace libtest;
+
+static uint32_t continuum_random(uint64_t& state)
+{
+  state^= state << 13;
+  state^= state >> 7;
+  state^= state << 17;
+
+  return uint32_t(state >> 16);
+}
+
+static bool continuum_item_less(const memcached_continuum_item_st& a, const memcached_continuum_item_st& b)
+{
+  return a.value < b.value;
+}
+
+/* The search dispatch_host() did before the lookup layout existed. */
+static uint32_t continuum_binary_search(const std::vector<memcached_continuum_item_st>& continuum, uint32_t hash)
+{
+  const memcached_continuum_item_st *begin, *end, *left, *right, *middle;
+  begin= left= &continuum[0];
+  end= right= &continuum[0] + continuum.size();
+
+  while (left < right)
+  {
+    middle= left + (right - left) / 2;
+    if (middle->value < hash)
+      left= middle + 1;
+    else
+      right= middle;
+  }
+  if (right == end)
+    right= begin;
+  return right->index;
+}
+
+static void continuum_generate(std::vector<memcached_continuum_item_st>& continuum,
+                               uint32_t servers, uint32_t points, uint32_t mask,
+                               uint64_t& state)
+{
+  continuum.clear();
+  for (uint32_t server= 0; server < servers; server++)
+  {
+    for (uint32_t point= 0; point < points; point++)
+    {
+      memcached_continuum_item_st item;
+      item.index= server;
+      item.value= continuum_random(state) & mask;
+      continuum.push_back(item);
+    }
+  }
+  std::stable_sort(continuum.begin(), continuum.end(), continuum_item_less);
+}
+
+static test_return_t continuum_lookup_compare(uint32_t mask)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  Memcached* ptr= memcached2Memcached(memc);
+
+  uint64_t state= 88172645463325252ULL;
+  const uint32_t servers[]= { 1, 2, 3, 10, 100, 1000 };
+  std::vector<memcached_continuum_item_st> continuum;
+
+  for (size_t x= 0; x < sizeof(servers) / sizeof(servers[0]); x++)
+  {
+    continuum_generate(continuum, servers[x], MEMCACHED_POINTS_PER_SERVER, mask, state);
+    test_compare(MEMCACHED_SUCCESS,
+                 memcached_continuum_lookup_build(ptr, &continuum[0], NULL, uint32_t(continuum.size())));
+    test_true(ptr->ketama.lookup);
+
+    for (size_t point= 0; point < continuum.size(); point++)
+    {
+      uint32_t value= continuum[point].value;
+      test_compare(continuum_binary_search(continuum, value), memcached_continuum_lookup(ptr->ketama.lookup, value, 0));
+      test_compare(continuum_binary_search(continuum, value -1), memcached_continuum_lookup(ptr->ketama.lookup, value -1, 0));
+      test_compare(continuum_binary_search(continuum, value +1), memcached_continuum_lookup(ptr->ketama.lookup, value +1, 0));
+    }
+
+    test_compare(continuum_binary_search(continuum, 0), memcached_continuum_lookup(ptr->ketama.lookup, 0, 0));
+    test_compare(continuum_binary_search(continuum, UINT32_MAX), memcached_continuum_lookup(ptr->ketama.lookup, UINT32_MAX, 0));
+
+    for (size_t y= 0; y < 100000; y++)
+    {
+      uint32_t hash= continuum_random(state);
+      test_compare(continuum_binary_search(continuum, hash), memcached_continuum_lookup(ptr->ketama.lookup, hash, 0));
+    }
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t continuum_lookup_TEST(void *)
+{
+  return continuum_lookup_compare(UINT32_MAX);
+}
+
+test_return_t continuum_lookup_skewed_TEST(void *)
+{
+  // Crowd every point into a few prefixes so runs outgrow the vector scan.
+  return continuum_lookup_compare(0x8000FFFF);
+}
+
+test_return_t continuum_lookup_benchmark_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  Memcached* ptr= memcached2Memcached(memc);
+
+  uint64_t state= 2463534242ULL;
+  const uint32_t servers[]= { 10, 100, 1000 };
+  const size_t lookups= 4 * 1000 * 1000;
+  std::vector<memcached_continuum_item_st> continuum;
+  std::vector<uint32_t> hashes(4096);
+
+  for (size_t x= 0; x < hashes.size(); x++)
+  {
+    hashes[x]= continuum_random(state);
+  }
+
+  for (size_t x= 0; x < sizeof(servers) / sizeof(servers[0]); x++)
+  {
+    continuum_generate(continuum, servers[x], MEMCACHED_POINTS_PER_SERVER, UINT32_MAX, state);
+    test_compare(MEMCACHED_SUCCESS,
+                 memcached_continuum_lookup_build(ptr, &continuum[0], NULL, uint32_t(continuum.size())));
+
+    uint32_t binary_sum= 0;
+    Timer binary;
+    binary.reset();
+    for (size_t y= 0; y < lookups; y++)
+    {
+      binary_sum+= continuum_binary_search(continuum, hashes[y & (hashes.size() -1)] ^ uint32_t(y));
+    }
+    binary.sample();
+
+    uint32_t lookup_sum= 0;
+    Timer lookup;
+    lookup.reset();
+    for (size_t y= 0; y < lookups; y++)
+    {
+      lookup_sum+= memcached_continuum_lookup(ptr->ketama.lookup, hashes[y & (hashes.size() -1)] ^ uint32_t(y), 0);
+    }
+    lookup.sample();
+
+    test_compare(binary_sum, lookup_sum);
+
+    uint64_t binary_ms= std::max(binary.elapsed_milliseconds(), uint64_t(1));
+    uint64_t lookup_ms= std::max(lookup.elapsed_milliseconds(), uint64_t(1));
+    Out << servers[x] << " servers, " << continuum.size() << " points: "
+      << "binary search " << (lookups * 1000 / binary_ms) << " lookups/sec, "
+      << "prefix lookup " << (lookups * 1000 / lookup_ms) << " lookups/sec";
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Ejects and rejoins servers at random and checks that the continuum patched
+  by update_continuum() matches one hashed from scratch.
+*/
+/* Reads the continuum back out of the lookup table it lives in. */
+static void continuum_points(const Memcached *ptr, std::vector<memcached_continuum_item_st>& points, std::vector<uint32_t>& lows)
+{
+  const memcached_continuum_lookup_st *lookup= ptr->ketama.lookup;
+  uint32_t count= lookup ? lookup->count : 0;
+
+  points.resize(count);
+  lows.assign(lookup and lookup->lows ? count : 0, 0);
+  for (uint32_t x= 0; x < count; x++)
+  {
+    points[x].value= lookup->values[x];
+    points[x].index= memcached_continuum_lookup_index(lookup, x);
+    if (lookup->lows)
+    {
+      lows[x]= lookup->lows[x];
+    }
+  }
+}
+
+static test_return_t continuum_eject_rejoin(memcached_server_distribution_t distribution, bool weighted, bool ring_64bit)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  Memcached* ptr= memcached2Memcached(memc);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_AUTO_EJECT_HOSTS, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_KETAMA_64BIT, ring_64bit));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, distribution));
+
+  for (uint32_t x= 0; x < 32; x++)
+  {
+    char hostname[32];
+    snprintf(hostname, sizeof(hostname), "10.0.%u.%u", x / 8, x % 8 +1);
+    test_compare(MEMCACHED_SUCCESS,
+                 memcached_server_add_with_weight(memc, hostname, in_port_t(11211 + x % 3), weighted ? x % 5 +1 : 0));
+  }
+
+  uint64_t state= 1181783497276652981ULL;
+  std::vector<memcached_continuum_item_st> patched, rebuilt;
+  std::vector<uint32_t> patched_lows, rebuilt_lows;
+  for (uint32_t round= 0; round < 50; round++)
+  {
+    for (uint32_t flip= 0; flip < 1 + round % 3; flip++)
+    {
+      memcached_instance_st* instance= memcached_instance_list(ptr) + continuum_random(state) % memcached_server_count(ptr);
+      instance->next_retry= instance->next_retry ? 0 : time(NULL) + 3600;
+    }
+
+    test_compare(MEMCACHED_SUCCESS, run_distribution(ptr));
+    test_false(ptr->ketama.continuum);
+    continuum_points(ptr, patched, patched_lows);
+    test_compare(ring_64bit, patched_lows.size() != 0);
+
+    test_compare(MEMCACHED_SUCCESS, memcached_snapshot_detach(ptr));
+    memcached_snapshot_free(ptr);
+    memcached_continuum_cache_free(ptr);
+    test_compare(MEMCACHED_SUCCESS, run_distribution(ptr));
+
+    continuum_points(ptr, rebuilt, rebuilt_lows);
+    test_compare(patched.size(), size_t(ptr->ketama.continuum_points_counter));
+    test_compare(patched.size(), rebuilt.size());
+    for (size_t x= 0; x < patched.size(); x++)
+    {
+      test_compare(patched[x].value, rebuilt[x].value);
+      test_compare(patched[x].index, rebuilt[x].index);
+      if (ring_64bit)
+      {
+        test_compare(patched_lows[x], rebuilt_lows[x]);
+      }
+    }
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t continuum_eject_rejoin_TEST(void *)
+{
+  test_compare(TEST_SUCCESS, continuum_eject_rejoin(MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA, false, false));
+  test_compare(TEST_SUCCESS, continuum_eject_rejoin(MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA, true, false));
+  test_compare(TEST_SUCCESS, continuum_eject_rejoin(MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA_SPY, false, false));
+  test_compare(TEST_SUCCESS, continuum_eject_rejoin(MEMCACHED_DISTRIBUTION_CONSISTENT, false, false));
+  test_compare(TEST_SUCCESS, continuum_eject_rejoin(MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA, false, true));
+  test_compare(TEST_SUCCESS, continuum_eject_rejoin(MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA, true, true));
+
+  return TEST_SUCCESS;
+}
+
+static test_return_t continuum_cluster_push(memcached_st *memc, uint32_t servers)
+{
+  memcached_server_st *list= NULL;
+  for (uint32_t x= 0; x < servers; x++)
+  {
+    char hostname[32];
+    snprintf(hostname, sizeof(hostname), "10.%u.%u.%u", x / 65536, (x / 256) % 256, x % 256);
+    memcached_return_t rc;
+    list= memcached_server_list_append(list, hostname, 11211, &rc);
+    test_compare(MEMCACHED_SUCCESS, rc);
+  }
+
+  test_compare(MEMCACHED_SUCCESS, memcached_server_push(memc, list));
+  memcached_server_list_free(list);
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Share of the 32 bit hash space each server owns, measured from the arcs
+  between neighbouring points.
+*/
+static void continuum_cluster_shares(const Memcached *ptr, std::vector<double>& shares)
+{
+  shares.assign(memcached_server_count(ptr), 0);
+
+  const memcached_continuum_lookup_st *lookup= ptr->ketama.lookup;
+  uint32_t count= lookup->count;
+  for (uint32_t x= 0; x < count; x++)
+  {
+    uint32_t previous= x ? lookup->values[x -1] : lookup->values[count -1];
+    shares[memcached_continuum_lookup_index(lookup, x)]+= double(uint32_t(lookup->values[x] - previous));
+  }
+}
+
+/*
+  Clusters far past MEMCACHED_CONTINUUM_SIZE hash, stay within the expected
+  ketama spread, and route keys where the continuum says they belong.  With
+  p points a server's arc share has a relative standard deviation of about
+  1/sqrt(p) on an evenly hashed ring, so the spread is checked against
+  multiples of that rather than against what one set of hostnames happens to
+  produce.
+*/
+static test_return_t continuum_load_balance(bool weighted)
+{
+  const uint32_t servers[]= { 1000, 2000, 10000 };
+
+  for (size_t x= 0; x < sizeof(servers) / sizeof(servers[0]); x++)
+  {
+    memcached_st *memc= memcached_create(NULL);
+    test_true(memc);
+    Memcached* ptr= memcached2Memcached(memc);
+
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA));
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_KETAMA_WEIGHTED, weighted));
+
+    Timer build;
+    build.reset();
+    test_compare(TEST_SUCCESS, continuum_cluster_push(memc, servers[x]));
+    build.sample();
+
+    // Weighted rings round each server's share in single precision.
+    uint32_t points= weighted ? MEMCACHED_POINTS_PER_SERVER_KETAMA : MEMCACHED_POINTS_PER_SERVER;
+    test_compare(servers[x], memcached_server_count(memc));
+    test_true(ptr->ketama.continuum_points_counter <= servers[x] * points);
+    test_true(ptr->ketama.continuum_points_counter >= servers[x] * (points - 4));
+    test_true(ptr->ketama.continuum_points_counter > MEMCACHED_CONTINUUM_SIZE);
+    test_true(ptr->ketama.lookup);
+
+    std::vector<double> shares;
+    continuum_cluster_shares(ptr, shares);
+
+    double mean= 4294967296.0 / servers[x];
+    double variance= 0;
+    for (size_t y= 0; y < shares.size(); y++)
+    {
+      variance+= (shares[y] / mean - 1) * (shares[y] / mean - 1);
+    }
+    double deviation= sqrt(variance / shares.size());
+    double largest= *std::max_element(shares.begin(), shares.end()) / mean;
+    double expected= 1 / sqrt(double(points));
+    Out << servers[x] << (weighted ? " weighted" : "") << " servers, " << ptr->ketama.continuum_points_counter
+      << " points, built in " << build.elapsed_milliseconds() << "ms: arc share deviation " << deviation
+      << " (" << deviation / expected << " of 1/sqrt(points)), max " << largest
+      << " (" << (largest - 1) / expected << ")";
+
+    // The largest of n shares sits about sqrt(2 ln n) deviations out, the
+    // arcs summed into a share leave a longer tail on the high side.
+    test_true(deviation < 1.25 * expected);
+    test_true(largest < 1 + (sqrt(2 * log(double(servers[x]))) + 1.5) * expected);
+
+    std::vector<uint32_t> keys(servers[x]);
+    for (uint32_t y= 0; y < servers[x] * 50; y++)
+    {
+      char key[32];
+      int key_length= snprintf(key, sizeof(key), "cluster:%u", y);
+      uint32_t server_key= memcached_generate_hash(memc, key, size_t(key_length));
+      test_true(server_key < servers[x]);
+      keys[server_key]++;
+    }
+    test_true(*std::min_element(keys.begin(), keys.end()) > 0);
+
+    memcached_free(memc);
+  }
+
+  return TEST_SUCCESS;
+}
+
+test_return_t continuum_load_balance_TEST(void *)
+{
+  test_compare(TEST_SUCCESS, continuum_load_balance(false));
+  test_compare(TEST_SUCCESS, continuum_load_balance(true));
+
+  return TEST_SUCCESS;
+}
+
+/*
+  The 64 bit continuum keeps the 32 bit positions as its high word, so it
+  only moves keys whose hash lands exactly on a point.
+*/
+test_return_t continuum_64bit_TEST(void *)
+{
+  const uint32_t servers= 2000;
+  const uint32_t keys= 100000;
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  Memcached* ptr= memcached2Memcached(memc);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA));
+  test_compare(TEST_SUCCESS, continuum_cluster_push(memc, servers));
+
+  std::vector<uint32_t> narrow(keys);
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "wide:%u", x);
+    narrow[x]= memcached_generate_hash(memc, key, size_t(key_length));
+  }
+
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_KETAMA_64BIT, true));
+  test_compare(uint64_t(true), memcached_behavior_get(memc, MEMCACHED_BEHAVIOR_KETAMA_64BIT));
+  test_true(ptr->ketama.lookup->lows);
+  test_compare(servers * MEMCACHED_POINTS_PER_SERVER, ptr->ketama.continuum_points_counter);
+
+  uint32_t moved= 0;
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "wide:%u", x);
+    if (memcached_generate_hash(memc, key, size_t(key_length)) != narrow[x])
+    {
+      moved++;
+    }
+  }
+  test_true(moved < keys / 1000);
+
+  // Points sharing a high word are ordered by their low word.
+  std::vector<memcached_continuum_item_st> continuum;
+  std::vector<uint32_t> lows;
+  continuum_points(ptr, continuum, lows);
+  uint32_t collisions= 0;
+  for (uint32_t x= 1; x < ptr->ketama.continuum_points_counter; x++)
+  {
+    test_true(continuum[x -1].value <= continuum[x].value);
+    if (continuum[x -1].value == continuum[x].value)
+    {
+      test_true(lows[x -1] <= lows[x]);
+      test_compare(continuum[x].index, memcached_continuum_lookup(ptr->ketama.lookup, continuum[x].value, lows[x]));
+      collisions++;
+    }
+  }
+
+  Out << servers << " servers: " << moved << " of " << keys << " keys moved, " << collisions << " colliding points";
+
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_KETAMA_64BIT, false));
+  test_false(ptr->ketama.lookup->lows);
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "wide:%u", x);
+    test_compare(narrow[x], memcached_generate_hash(memc, key, size_t(key_length)));
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Jump hashing keeps no continuum, spreads keys evenly, and only moves keys
+  onto a server appended to the end of the list.
+*/
+test_return_t continuum_jump_TEST(void *)
+{
+  const uint32_t servers= 1000;
+  const uint32_t keys= 200000;
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  Memcached* ptr= memcached2Memcached(memc);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP));
+  test_compare(uint64_t(MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP), memcached_behavior_get(memc, MEMCACHED_BEHAVIOR_DISTRIBUTION));
+  test_compare(TEST_SUCCESS, continuum_cluster_push(memc, servers));
+  test_false(ptr->ketama.lookup);
+
+  std::vector<uint32_t> before(keys);
+  std::vector<uint32_t> load(servers +1);
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "jump:%u", x);
+    before[x]= memcached_generate_hash(memc, key, size_t(key_length));
+    test_true(before[x] < servers);
+    load[before[x]]++;
+  }
+
+  double mean= double(keys) / servers;
+  test_true(*std::min_element(load.begin(), load.end() -1) > mean * 0.6);
+  test_true(*std::max_element(load.begin(), load.end() -1) < mean * 1.4);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.255.255.255", 11211));
+  test_compare(servers +1, memcached_server_count(memc));
+
+  uint32_t moved= 0;
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "jump:%u", x);
+    uint32_t after= memcached_generate_hash(memc, key, size_t(key_length));
+    if (after != before[x])
+    {
+      test_compare(servers, after);
+      moved++;
+    }
+  }
+
+  // One server in 1001 should take roughly 1/1001 of the keys.
+  test_true(moved > keys / (servers +1) / 2);
+  test_true(moved < keys / (servers +1) * 2);
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+static test_return_t continuum_rendezvous(memcached_server_distribution_t distribution)
+{
+  const uint32_t servers= 100;
+  const uint32_t keys= 100000;
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  Memcached* ptr= memcached2Memcached(memc);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_AUTO_EJECT_HOSTS, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, distribution));
+
+  uint32_t total_weight= 0;
+  for (uint32_t x= 0; x < servers; x++)
+  {
+    char hostname[32];
+    snprintf(hostname, sizeof(hostname), "10.1.%u.%u", x / 256, x % 256);
+    test_compare(MEMCACHED_SUCCESS, memcached_server_add_with_weight(memc, hostname, 11211, x % 4 +1));
+    total_weight+= x % 4 +1;
+  }
+  test_true(ptr->rendezvous);
+  test_false(ptr->ketama.lookup);
+
+  // Keys follow the weights.
+  std::vector<uint32_t> before(keys);
+  std::vector<uint32_t> load(servers);
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "hrw:%u", x);
+    before[x]= memcached_generate_hash(memc, key, size_t(key_length));
+    test_true(before[x] < servers);
+    load[before[x]]++;
+  }
+
+  for (uint32_t x= 0; x < servers; x++)
+  {
+    double expected= double(keys) * (x % 4 +1) / total_weight;
+    test_true(load[x] > expected * 0.7);
+    test_true(load[x] < expected * 1.3);
+  }
+
+  // Replicas are distinct servers, replica 0 being the master.
+  for (uint32_t x= 0; x < 1000; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "hrw:%u", x);
+    std::vector<uint32_t> replicas;
+    for (uint32_t replica= 0; replica < 4; replica++)
+    {
+      replicas.push_back(memcached_generate_replica(memc, key, size_t(key_length), before[x], replica));
+    }
+    test_compare(before[x], replicas[0]);
+    std::sort(replicas.begin(), replicas.end());
+    test_true(std::unique(replicas.begin(), replicas.end()) == replicas.end());
+  }
+
+  // Ejecting a server moves its own keys, and on the flat distribution
+  // nothing else; they land on what was their first replica.
+  const uint32_t ejected= 42;
+  std::vector<uint32_t> second(keys);
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    if (before[x] == ejected)
+    {
+      char key[32];
+      int key_length= snprintf(key, sizeof(key), "hrw:%u", x);
+      second[x]= memcached_generate_replica(memc, key, size_t(key_length), before[x], 1);
+    }
+  }
+
+  memcached_instance_list(ptr)[ejected].next_retry= time(NULL) + 3600;
+  test_compare(MEMCACHED_SUCCESS, run_distribution(ptr));
+
+  uint32_t moved= 0;
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "hrw:%u", x);
+    uint32_t after= memcached_generate_hash(memc, key, size_t(key_length));
+    test_true(after != ejected);
+    if (before[x] == ejected)
+    {
+      if (distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS)
+      {
+        test_compare(second[x], after);
+      }
+    }
+    else if (after != before[x])
+    {
+      moved++;
+    }
+  }
+
+  if (distribution == MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS)
+  {
+    test_zero(moved);
+  }
+  else
+  {
+    test_true(moved < keys / 20);
+  }
+
+  // Rejoining puts every key back.
+  memcached_instance_list(ptr)[ejected].next_retry= 0;
+  test_compare(MEMCACHED_SUCCESS, run_distribution(ptr));
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "hrw:%u", x);
+    test_compare(before[x], memcached_generate_hash(memc, key, size_t(key_length)));
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t continuum_rendezvous_TEST(void *)
+{
+  test_compare(TEST_SUCCESS, continuum_rendezvous(MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS));
+  test_compare(TEST_SUCCESS, continuum_rendezvous(MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON));
+
+  return TEST_SUCCESS;
+}
+
+/*
+  The skeleton keeps lookups cheap on clusters where scoring every server
+  would not be.
+*/
+test_return_t continuum_rendezvous_skeleton_TEST(void *)
+{
+  const uint32_t servers= 10000;
+  const uint32_t keys= 20000;
+  const memcached_server_distribution_t distributions[]= { MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS,
+                                                            MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON };
+
+  for (size_t x= 0; x < sizeof(distributions) / sizeof(distributions[0]); x++)
+  {
+    memcached_st *memc= memcached_create(NULL);
+    test_true(memc);
+
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, distributions[x]));
+    test_compare(TEST_SUCCESS, continuum_cluster_push(memc, servers));
+
+    std::vector<uint32_t> load(servers);
+    Timer lookup;
+    lookup.reset();
+    for (uint32_t y= 0; y < keys; y++)
+    {
+      char key[32];
+      int key_length= snprintf(key, sizeof(key), "skeleton:%u", y);
+      load[memcached_generate_hash(memc, key, size_t(key_length))]++;
+    }
+    lookup.sample();
+
+    test_true(*std::max_element(load.begin(), load.end()) < 20);
+
+    uint64_t lookup_ms= std::max(lookup.elapsed_milliseconds(), uint64_t(1));
+    Out << servers << " servers, " << libmemcached_string_distribution(distributions[x]) << ": "
+      << (uint64_t(keys) * 1000 / lookup_ms) << " lookups/sec";
+
+    memcached_free(memc);
+  }
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Maglev shares follow the weights, and ejecting a server reassigns little
+  more than its own slots.
+*/
+test_return_t continuum_maglev_TEST(void *)
+{
+  const uint32_t servers= 100;
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  Memcached* ptr= memcached2Memcached(memc);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_AUTO_EJECT_HOSTS, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV));
+
+  uint32_t total_weight= 0;
+  for (uint32_t x= 0; x < servers; x++)
+  {
+    char hostname[32];
+    snprintf(hostname, sizeof(hostname), "10.2.%u.%u", x / 256, x % 256);
+    test_compare(MEMCACHED_SUCCESS, memcached_server_add_with_weight(memc, hostname, 11211, x % 3 +1));
+    total_weight+= x % 3 +1;
+  }
+  test_true(ptr->maglev);
+  test_true(ptr->maglev->size >= servers * MEMCACHED_MAGLEV_SLOTS_PER_SERVER);
+
+  std::vector<uint32_t> slots(servers);
+  std::vector<uint32_t> before(ptr->maglev->table, ptr->maglev->table + ptr->maglev->size);
+  for (uint32_t x= 0; x < ptr->maglev->size; x++)
+  {
+    test_true(before[x] < servers);
+    slots[before[x]]++;
+  }
+
+  for (uint32_t x= 0; x < servers; x++)
+  {
+    double expected= double(ptr->maglev->size) * (x % 3 +1) / total_weight;
+    test_true(slots[x] > expected * 0.95);
+    test_true(slots[x] < expected * 1.05);
+  }
+
+  const uint32_t ejected= 17;
+  memcached_instance_list(ptr)[ejected].next_retry= time(NULL) + 3600;
+  test_compare(MEMCACHED_SUCCESS, run_distribution(ptr));
+
+  uint32_t moved= 0;
+  for (uint32_t x= 0; x < ptr->maglev->size; x++)
+  {
+    test_true(ptr->maglev->table[x] != ejected);
+    if (before[x] != ejected and ptr->maglev->table[x] != before[x])
+    {
+      moved++;
+    }
+  }
+  test_true(moved < slots[ejected]);
+
+  memcached_instance_list(ptr)[ejected].next_retry= 0;
+  test_compare(MEMCACHED_SUCCESS, run_distribution(ptr));
+  for (uint32_t x= 0; x < ptr->maglev->size; x++)
+  {
+    test_compare(before[x], ptr->maglev->table[x]);
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+static test_return_t continuum_route(memcached_st *memc, uint32_t keys, std::vector<uint32_t>& routes)
+{
+  routes.resize(keys);
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "route:%u", x);
+    routes[x]= memcached_generate_hash(memc, key, size_t(key_length));
+  }
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Compares Maglev with ketama: the time to route a hash to a server, and
+  the share of keys that change server when one server leaves or joins.
+*/
+test_return_t continuum_maglev_benchmark_TEST(void *)
+{
+  const uint32_t servers[]= { 100, 1000 };
+  const memcached_server_distribution_t distributions[]= { MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA,
+                                                            MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV };
+  const uint32_t keys= 100000;
+  const size_t lookups= 20000000;
+
+  for (size_t x= 0; x < sizeof(servers) / sizeof(servers[0]); x++)
+  {
+    for (size_t y= 0; y < sizeof(distributions) / sizeof(distributions[0]); y++)
+    {
+      memcached_st *memc= memcached_create(NULL);
+      test_true(memc);
+      Memcached* ptr= memcached2Memcached(memc);
+
+      test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_AUTO_EJECT_HOSTS, true));
+      test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, distributions[y]));
+      test_compare(TEST_SUCCESS, continuum_cluster_push(memc, servers[x]));
+
+      uint64_t state= 2463534242ULL;
+      uint32_t sum= 0;
+      Timer route;
+      route.reset();
+      if (distributions[y] == MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV)
+      {
+        for (size_t z= 0; z < lookups; z++)
+        {
+          sum+= memcached_maglev_lookup(ptr->maglev, continuum_random(state));
+        }
+      }
+      else
+      {
+        for (size_t z= 0; z < lookups; z++)
+        {
+          sum+= memcached_continuum_lookup(ptr->ketama.lookup, continuum_random(state), 0);
+        }
+      }
+      route.sample();
+      test_true(sum);
+
+      std::vector<uint32_t> before, after;
+      test_compare(TEST_SUCCESS, continuum_route(memc, keys, before));
+
+      // One server leaves.
+      memcached_instance_list(ptr)[servers[x] / 2].next_retry= time(NULL) + 3600;
+      test_compare(MEMCACHED_SUCCESS, run_distribution(ptr));
+      test_compare(TEST_SUCCESS, continuum_route(memc, keys, after));
+
+      uint32_t leave_moved= 0;
+      for (uint32_t z= 0; z < keys; z++)
+      {
+        leave_moved+= before[z] != after[z];
+      }
+
+      // It comes back, and one new server joins.
+      memcached_instance_list(ptr)[servers[x] / 2].next_retry= 0;
+      test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.255.255.254", 11211));
+      test_compare(TEST_SUCCESS, continuum_route(memc, keys, after));
+
+      uint32_t join_moved= 0;
+      for (uint32_t z= 0; z < keys; z++)
+      {
+        join_moved+= before[z] != after[z];
+      }
+
+      // Ideally 1/n of the keys move either way, Maglev trades some of that
+      // for its single load lookup.
+      double ideal= double(keys) / servers[x];
+      double slack= distributions[y] == MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV ? 10 : 2;
+      test_true(leave_moved < ideal * slack);
+      test_true(join_moved < ideal * slack);
+
+      uint64_t route_ms= std::max(route.elapsed_milliseconds(), uint64_t(1));
+      Out << servers[x] << " servers, " << libmemcached_string_distribution(distributions[y]) << ": "
+        << (lookups * 1000 / route_ms) << " lookups/sec, "
+        << (100.0 * leave_moved / keys) << "% of keys moved on leave, "
+        << (100.0 * join_moved / keys) << "% on join (ideal " << (100.0 / servers[x]) << "%)";
+
+      memcached_free(memc);
+    }
+  }
+
+  return TEST_SUCCESS;
+}
+
+static test_return_t continuum_hot_reads(memcached_st *memc, uint32_t reads, std::vector<uint32_t>& shares)
+{
+  uint64_t state= 88172645463325252ULL;
+  shares.assign(memcached_server_count(memc), 0);
+  for (uint32_t x= 0; x < reads; x++)
+  {
+    // Half of the reads go to four hot keys.
+    uint32_t pick= continuum_random(state);
+    char key[32];
+    int key_length;
+    if (pick & 1)
+    {
+      key_length= snprintf(key, sizeof(key), "hot:%u", (pick >> 1) % 4);
+    }
+    else
+    {
+      key_length= snprintf(key, sizeof(key), "cold:%u", (pick >> 1) % 100000);
+    }
+
+    uint32_t server_key= memcached_generate_hash_for_read(memc, key, size_t(key_length));
+    test_true(server_key < shares.size());
+    shares[server_key]++;
+  }
+
+  return TEST_SUCCESS;
+}
+
+/*
+  With bounded loads no server takes much more than (1 + epsilon) times the
+  average of the reads, even when a few keys are hot. Reads only spill along
+  the key's replica chain, and writes keep going to the home server.
+*/
+test_return_t continuum_bounded_load_TEST(void *)
+{
+  const uint32_t servers= 20;
+  const uint32_t reads= 100000;
+  const uint32_t replicas= 3;
+  const memcached_server_distribution_t distributions[]= { MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA,
+                                                            MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP };
+
+  for (size_t x= 0; x < sizeof(distributions) / sizeof(distributions[0]); x++)
+  {
+    memcached_st *memc= memcached_create(NULL);
+    test_true(memc);
+
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, distributions[x]));
+    test_compare(TEST_SUCCESS, continuum_cluster_push(memc, servers));
+
+    std::vector<uint32_t> shares;
+    test_compare(TEST_SUCCESS, continuum_hot_reads(memc, reads, shares));
+    double average= double(reads) / servers;
+    uint32_t unbounded= *std::max_element(shares.begin(), shares.end());
+    test_true(unbounded > average * 2);
+
+    test_compare(MEMCACHED_INVALID_ARGUMENTS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_BOUNDED_LOAD, UINT16_MAX +1));
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_BOUNDED_LOAD, 25));
+    test_compare(uint64_t(25), memcached_behavior_get(memc, MEMCACHED_BEHAVIOR_BOUNDED_LOAD));
+
+    // Without replicas there is nowhere the value could be read from but home.
+    test_compare(TEST_SUCCESS, continuum_hot_reads(memc, reads, shares));
+    test_compare(unbounded, *std::max_element(shares.begin(), shares.end()));
+
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_NUMBER_OF_REPLICAS, replicas));
+    test_compare(TEST_SUCCESS, continuum_hot_reads(memc, reads, shares));
+    uint32_t most= *std::max_element(shares.begin(), shares.end());
+    test_true(most < unbounded);
+
+    /*
+      Only the home of a hot key goes past the bound, with what its whole
+      replica chain had no room for. Everything else stays within
+      1 + epsilon of the average, give or take the rounding of capacity.
+    */
+    std::vector<bool> hot_home(servers, false);
+    for (uint32_t y= 0; y < 4; y++)
+    {
+      char key[32];
+      int key_length= snprintf(key, sizeof(key), "hot:%u", y);
+      hot_home[memcached_generate_hash(memc, key, size_t(key_length))]= true;
+    }
+    for (uint32_t y= 0; y < servers; y++)
+    {
+      test_true(hot_home[y] or shares[y] < average * 1.27);
+    }
+
+    // A write lands on the home server, reads of the same key spill to its replicas.
+    for (uint32_t y= 0; y < 4; y++)
+    {
+      char key[32];
+      int key_length= snprintf(key, sizeof(key), "hot:%u", y);
+      uint32_t home= memcached_generate_hash(memc, key, size_t(key_length));
+      test_compare(home, memcached_generate_hash_with_redistribution(memc, key, size_t(key_length)));
+
+      bool spilled= false;
+      for (uint32_t z= 0; z < 100; z++)
+      {
+        uint32_t server_key= memcached_generate_hash_for_read(memc, key, size_t(key_length));
+        uint32_t replica= 0;
+        while (replica <= replicas and memcached_generate_replica(memc, key, size_t(key_length), home, replica) != server_key)
+        {
+          replica++;
+        }
+        test_true(replica <= replicas);
+        spilled|= server_key != home;
+      }
+      test_true(spilled);
+    }
+
+    Out << libmemcached_string_distribution(distributions[x]) << ": busiest server took "
+      << (most / average) << "x the average of the reads";
+
+    memcached_free(memc);
+  }
+
+  return TEST_SUCCESS;
+}
+
+static uint32_t continuum_digest(const char *key, size_t key_length, void *context)
+{
+  return hashkit_digest(static_cast<hashkit_st *>(context), key, key_length);
+}
+
+/*
+  The routines installed for each hash and distribution pair route keys
+  exactly like the generic path, which a custom hash function forces.
+*/
+test_return_t continuum_route_dispatch_TEST(void *)
+{
+  const memcached_server_distribution_t distributions[]= { MEMCACHED_DISTRIBUTION_MODULA,
+                                                            MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA,
+                                                            MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP,
+                                                            MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV,
+                                                            MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS };
+  const uint32_t keys= 2000;
+  const size_t lookups= 2000000;
+
+  for (int algo= int(HASHKIT_HASH_DEFAULT); algo < int(HASHKIT_HASH_MAX); algo++)
+  {
+    hashkit_hash_algorithm_t hash= static_cast<hashkit_hash_algorithm_t>(algo);
+    if (hash == HASHKIT_HASH_CUSTOM or libhashkit_has_algorithm(hash) == false)
+    {
+      continue;
+    }
+
+    for (size_t x= 0; x < sizeof(distributions) / sizeof(distributions[0]); x++)
+    {
+      memcached_st *memc= memcached_create(NULL);
+      test_true(memc);
+      test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, distributions[x]));
+      test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_HASH, uint64_t(hash)));
+      test_compare(TEST_SUCCESS, continuum_cluster_push(memc, 50));
+
+      memcached_st *generic= memcached_clone(NULL, memc);
+      test_true(generic);
+      hashkit_st *builtin= hashkit_clone(NULL, memcached_get_hashkit(memc));
+      hashkit_st *hashk= hashkit_clone(NULL, builtin);
+      test_compare(HASHKIT_SUCCESS, hashkit_set_custom_function(hashk, continuum_digest, builtin));
+      test_compare(MEMCACHED_SUCCESS, memcached_set_hashkit(generic, hashk));
+      hashkit_free(hashk);
+
+      std::vector<uint32_t> routes, expected;
+      test_compare(TEST_SUCCESS, continuum_route(memc, keys, routes));
+      test_compare(TEST_SUCCESS, continuum_route(generic, keys, expected));
+      test_true(routes == expected);
+
+      if (hash == HASHKIT_HASH_DEFAULT)
+      {
+        Timer specialized, indirect;
+        uint32_t sum= 0;
+        char key[]= "route:0000000";
+
+        specialized.reset();
+        for (size_t y= 0; y < lookups; y++)
+        {
+          key[6 + y % 7]++;
+          sum+= memcached_generate_hash_with_redistribution(memc, key, sizeof(key) -1);
+        }
+        specialized.sample();
+
+        indirect.reset();
+        for (size_t y= 0; y < lookups; y++)
+        {
+          key[6 + y % 7]++;
+          sum+= memcached_generate_hash_with_redistribution(generic, key, sizeof(key) -1);
+        }
+        indirect.sample();
+        test_true(sum);
+
+        Out << libmemcached_string_distribution(distributions[x]) << ": "
+          << (lookups * 1000 / std::max(specialized.elapsed_milliseconds(), uint64_t(1))) << " routes/sec installed, "
+          << (lookups * 1000 / std::max(indirect.elapsed_milliseconds(), uint64_t(1))) << " through a custom hash";
+      }
+
+      hashkit_free(builtin);
+      memcached_free(generic);
+      memcached_free(memc);
+    }
+  }
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Hashing with the namespace carried over from memcached_set_namespace()
+  routes keys exactly like hashing the namespace and key together, which a
+  custom hash function still does.
+*/
+test_return_t continuum_namespace_hash_TEST(void *)
+{
+  const uint32_t keys= 2000;
+
+  for (int algo= int(HASHKIT_HASH_DEFAULT); algo < int(HASHKIT_HASH_MAX); algo++)
+  {
+    hashkit_hash_algorithm_t hash= static_cast<hashkit_hash_algorithm_t>(algo);
+    if (hash == HASHKIT_HASH_CUSTOM or libhashkit_has_algorithm(hash) == false)
+    {
+      continue;
+    }
+
+    memcached_st *memc= memcached_create(NULL);
+    test_true(memc);
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA));
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_HASH, uint64_t(hash)));
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_HASH_WITH_PREFIX_KEY, true));
+    test_compare(MEMCACHED_SUCCESS, memcached_callback_set(memc, MEMCACHED_CALLBACK_NAMESPACE, "tenant:0042:"));
+    test_compare(TEST_SUCCESS, continuum_cluster_push(memc, 50));
+    test_true(memc->namespace_hash);
+
+    memcached_st *generic= memcached_clone(NULL, memc);
+    test_true(generic);
+    hashkit_st *builtin= hashkit_clone(NULL, memcached_get_hashkit(memc));
+    hashkit_st *hashk= hashkit_clone(NULL, builtin);
+    test_compare(HASHKIT_SUCCESS, hashkit_set_custom_function(hashk, continuum_digest, builtin));
+    test_compare(MEMCACHED_SUCCESS, memcached_set_hashkit(generic, hashk));
+    hashkit_free(hashk);
+    test_false(generic->namespace_hash);
+
+    std::vector<uint32_t> routes, expected;
+    test_compare(TEST_SUCCESS, continuum_route(memc, keys, routes));
+    test_compare(TEST_SUCCESS, continuum_route(generic, keys, expected));
+    test_true(routes == expected);
+
+    // A clone carries the namespace state along with the namespace
+    memcached_st *clone= memcached_clone(NULL, memc);
+    test_true(clone);
+    test_true(clone->namespace_hash);
+    test_compare(TEST_SUCCESS, continuum_route(clone, keys, routes));
+    test_true(routes == expected);
+    memcached_free(clone);
+
+    // As does changing the namespace
+    test_compare(MEMCACHED_SUCCESS, memcached_callback_set(memc, MEMCACHED_CALLBACK_NAMESPACE, "other:"));
+    test_compare(MEMCACHED_SUCCESS, memcached_callback_set(generic, MEMCACHED_CALLBACK_NAMESPACE, "other:"));
+    test_compare(TEST_SUCCESS, continuum_route(memc, keys, routes));
+    test_compare(TEST_SUCCESS, continuum_route(generic, keys, expected));
+    test_true(routes == expected);
+
+    hashkit_free(builtin);
+    memcached_free(generic);
+    memcached_free(memc);
+  }
+
+  return TEST_SUCCESS;
+}
+
+/*
+  Clones route with the tables their source published, and a configuration
+  change is built once and picked up by every clone.
+*/
+test_return_t continuum_snapshot_TEST(void *)
+{
+  const uint32_t keys= 4096;
+  const uint32_t clones= 8;
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, MEMCACHED_DISTRIBUTION_CONSISTENT_KETAMA));
+  test_compare(TEST_SUCCESS, continuum_cluster_push(memc, 100));
+  test_true(memc->snapshot);
+
+  std::vector<uint32_t> expected, routes;
+  test_compare(TEST_SUCCESS, continuum_route(memc, keys, expected));
+
+  std::vector<memcached_st *> pool;
+  for (uint32_t x= 0; x < clones; x++)
+  {
+    memcached_st *clone= memcached_clone(NULL, memc);
+    test_true(clone);
+    test_true(clone->snapshot == memc->snapshot);
+    test_true(clone->ketama.lookup == memc->ketama.lookup);
+    test_compare(TEST_SUCCESS, continuum_route(clone, keys, routes));
+    test_true(routes == expected);
+    pool.push_back(clone);
+  }
+
+  // The master rebuilds, each clone then only swaps the snapshot in.
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(memc, MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV));
+  test_true(memc->maglev);
+  test_compare(TEST_SUCCESS, continuum_route(memc, keys, expected));
+  for (uint32_t x= 0; x < clones; x++)
+  {
+    test_compare(MEMCACHED_SUCCESS, memcached_behavior_set_distribution(pool[x], MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV));
+    test_true(pool[x]->snapshot == memc->snapshot);
+    test_true(pool[x]->maglev == memc->maglev);
+    test_compare(TEST_SUCCESS, continuum_route(pool[x], keys, routes));
+    test_true(routes == expected);
+  }
+
+  // A clone with an ejected server gets tables of its own, the others keep theirs.
+  Memcached* ejecting= memcached2Memcached(pool[0]);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(pool[0], MEMCACHED_BEHAVIOR_AUTO_EJECT_HOSTS, true));
+  memcached_instance_list(ejecting)[7].next_retry= time(NULL) + 3600;
+  test_compare(MEMCACHED_SUCCESS, run_distribution(ejecting));
+  test_false(ejecting->snapshot);
+  test_true(ejecting->maglev != memc->maglev);
+  test_compare(TEST_SUCCESS, continuum_route(pool[0], keys, routes));
+  for (uint32_t x= 0; x < keys; x++)
+  {
+    test_true(routes[x] != 7);
+  }
+  test_compare(TEST_SUCCESS, continuum_route(pool[1], keys, routes));
+  test_true(routes == expected);
+
+  // Once the server is back it shares again.
+  memcached_instance_list(ejecting)[7].next_retry= 0;
+  test_compare(MEMCACHED_SUCCESS, run_distribution(ejecting));
+  test_compare(TEST_SUCCESS, continuum_route(pool[0], keys, routes));
+  test_true(routes == expected);
+
+  // The snapshot outlives the handle that built it.
+  memcached_free(memc);
+  for (uint32_t x= 0; x < clones; x++)
+  {
+    test_compare(TEST_SUCCESS, continuum_route(pool[x], keys, routes));
+    test_true(routes == expected);
+    memcached_free(pool[x]);
+  }
+
+  return TEST_SUCCESS;
+}
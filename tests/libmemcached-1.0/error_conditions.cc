@@ -62,3 +62,30 @@ test_return_t memcached_increment_MEMCACHED_NO_SERVERS(memcached_st *)
 
   return TEST_SUCCESS;
 }
+
+test_return_t memcached_last_error_message_MEMCACHED_CONNECTION_FAILURE(memcached_st *)
+{
+  memcached_st *memc_ptr= memcached_create(NULL);
+  test_true(memc_ptr);
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc_ptr, "127.0.0.1", 1));
+
+  // More failures than the error ring holds, the latest one is still reported.
+  for (uint32_t x= 0; x < 64; x++)
+  {
+    memcached_return_t rc;
+    size_t value_length;
+    uint32_t flags;
+    test_null(memcached_get(memc_ptr, test_literal_param("dead key"), &value_length, &flags, &rc));
+    test_true(memcached_failed(rc));
+    test_compare(rc, memcached_last_error(memc_ptr));
+    test_true(strstr(memcached_last_error_message(memc_ptr), memcached_strerror(memc_ptr, rc)));
+  }
+
+  const memcached_instance_st *instance= memcached_server_instance_by_position(memc_ptr, 0);
+  test_true(memcached_failed(memcached_server_error_return(instance)));
+  test_true(strstr(memcached_server_error(instance), "127.0.0.1:1"));
+
+  memcached_free(memc_ptr);
+
+  return TEST_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+// We let libmemcached/common.h define config since we are looking at
+// library internals.
+
+#include <libmemcached/common.h>
+
+#include <libtest/test.hpp>
+
+#include <tests/error_ring.h>
+
+#include <string>
+
+using namespace libtest;
+
+/*
+  Only the start of a long detail is kept, the host is read from the
+  instance when the message is built and is shown whole.
+*/
+test_return_t error_ring_long_message_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+
+  std::string detail(1500, 'd');
+  test_compare(MEMCACHED_UNKNOWN_READ_FAILURE,
+               memcached_set_error(*memc, MEMCACHED_UNKNOWN_READ_FAILURE, MEMCACHED_AT, detail.c_str(), detail.size()));
+  std::string message(memcached_last_error_message(memc));
+  test_true(message.find(std::string(128, 'd')) != std::string::npos);
+  test_true(message.find(detail) == std::string::npos);
+
+  std::string path("/tmp/");
+  path.append(600, 's');
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add_unix_socket(memc, path.c_str()));
+  memcached_instance_st *instance= memcached_instance_fetch(memc, 0);
+
+  test_compare(MEMCACHED_CONNECTION_FAILURE,
+               memcached_set_error(*instance, MEMCACHED_CONNECTION_FAILURE, MEMCACHED_AT, memcached_literal_param("refused")));
+  message= memcached_server_error(instance);
+  test_true(message.find("socket: " +path) != std::string::npos);
+  message= memcached_last_error_message(memc);
+  test_true(message.find("socket: " +path) != std::string::npos);
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+/*
+  The handle and its instances share one message buffer, asking for a
+  different error has to build its message again.
+*/
+test_return_t error_ring_shared_message_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.0.0.1", 11211));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.0.0.2", 11212));
+  memcached_instance_st *first= memcached_instance_fetch(memc, 0);
+  memcached_instance_st *second= memcached_instance_fetch(memc, 1);
+
+  memcached_set_error(*first, MEMCACHED_CONNECTION_FAILURE, MEMCACHED_AT, memcached_literal_param("first"));
+  memcached_set_error(*second, MEMCACHED_TIMEOUT, MEMCACHED_AT, memcached_literal_param("second"));
+
+  for (uint32_t x= 0; x < 2; x++)
+  {
+    std::string message(memcached_server_error(first));
+    test_true(message.find("first,  host: 10.0.0.1:11211") != std::string::npos);
+
+    message= memcached_server_error(second);
+    test_true(message.find("second,  host: 10.0.0.2:11212") != std::string::npos);
+
+    message= memcached_last_error_message(memc);
+    test_true(message.find("second,  host: 10.0.0.2:11212") != std::string::npos);
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t error_ring_wrap_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+
+  // The cached message follows the newest error, also once the ring wraps.
+  for (uint32_t x= 0; x < 10; x++)
+  {
+    char detail[32];
+    int length= snprintf(detail, sizeof(detail), "error %u", x);
+    memcached_set_error(*memc, MEMCACHED_UNKNOWN_READ_FAILURE, MEMCACHED_AT, detail, size_t(length));
+    test_compare(MEMCACHED_UNKNOWN_READ_FAILURE, memcached_last_error(memc));
+
+    std::string message(memcached_last_error_message(memc));
+    test_true(message.find(detail) != std::string::npos);
+    test_compare(message, std::string(memcached_last_error_message(memc)));
+  }
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
@@ -72,3 +72,58 @@ test_return_t memcached_exist_by_key_SUCCESS(memcached_st *memc)
 
   return TEST_SUCCESS;
 }
+
+test_return_t memcached_exist_multi_TEST(memcached_st *memc)
+{
+  const char *keys[]= { "frog", "toad", "newt", "eft" };
+  size_t key_length[]= { 4, 4, 4, 3 };
+  memcached_return_t results[4];
+
+  test_compare(MEMCACHED_SUCCESS, memcached_set(memc, test_literal_param("frog"), 0, 0, 0, 0));
+  test_compare(MEMCACHED_SUCCESS, memcached_set(memc, test_literal_param("newt"), 0, 0, 0, 0));
+
+  test_compare(MEMCACHED_SOME_ERRORS, memcached_exist_multi(memc, keys, key_length, 4, results));
+  test_compare(MEMCACHED_SUCCESS, results[0]);
+  test_compare(MEMCACHED_NOTFOUND, results[1]);
+  test_compare(MEMCACHED_SUCCESS, results[2]);
+  test_compare(MEMCACHED_NOTFOUND, results[3]);
+
+  // Unlike memcached_exist(), nothing was stored for the missing keys
+  test_compare(MEMCACHED_NOTFOUND, memcached_exist(memc, test_literal_param("toad")));
+
+  test_compare(MEMCACHED_SOME_ERRORS, memcached_delete_multi(memc, keys, key_length, 4, results));
+  test_compare(MEMCACHED_SUCCESS, results[0]);
+  test_compare(MEMCACHED_NOTFOUND, results[1]);
+  test_compare(MEMCACHED_SUCCESS, results[2]);
+  test_compare(MEMCACHED_NOTFOUND, results[3]);
+
+  test_compare(MEMCACHED_SOME_ERRORS, memcached_exist_multi(memc, keys, key_length, 4, results));
+  for (size_t x= 0; x < 4; ++x)
+  {
+    test_compare(MEMCACHED_NOTFOUND, results[x]);
+  }
+
+  return TEST_SUCCESS;
+}
+
+test_return_t memcached_delete_multi_by_key_TEST(memcached_st *memc)
+{
+  const char *keys[]= { "frog", "toad", "newt" };
+  size_t key_length[]= { 4, 4, 4 };
+  memcached_return_t results[3];
+
+  for (size_t x= 0; x < 3; ++x)
+  {
+    test_compare(MEMCACHED_SUCCESS, memcached_set_by_key(memc, test_literal_param("master"), keys[x], key_length[x], 0, 0, 0, 0));
+  }
+
+  test_compare(MEMCACHED_SUCCESS, memcached_exist_multi_by_key(memc, test_literal_param("master"), keys, key_length, 3, results));
+  test_compare(MEMCACHED_SUCCESS, memcached_delete_multi_by_key(memc, test_literal_param("master"), keys, key_length, 3, results));
+  for (size_t x= 0; x < 3; ++x)
+  {
+    test_compare(MEMCACHED_SUCCESS, results[x]);
+    test_compare(MEMCACHED_NOTFOUND, memcached_exist_by_key(memc, test_literal_param("master"), keys[x], key_length[x]));
+  }
+
+  return TEST_SUCCESS;
+}
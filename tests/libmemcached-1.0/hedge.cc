@@ -0,0 +1,196 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+// We let libmemcached/common.h define config since we are looking at
+// library internals.
+
+#include <libmemcached/common.h>
+
+#include <libtest/test.hpp>
+
+#include <tests/hedge.h>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+
+#include <string>
+
+using namespace libtest;
+
+test_return_t hedge_table_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+
+  // Enough keys to grow the table a few times.
+  for (uint32_t x= 0; x < 1000; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "hedge:%u", x);
+    test_compare(MEMCACHED_SUCCESS, memcached_hedge_add(*memc, key, size_t(key_length), x % 4, x % 4));
+  }
+  test_compare(1000U, memc->hedge->count);
+  test_true(memc->hedge->size >= 2000U);
+
+  // Asking for a key twice from the same server is remembered once.
+  test_compare(MEMCACHED_SUCCESS, memcached_hedge_add(*memc, memcached_literal_param("hedge:7"), 3, 3));
+  test_compare(1000U, memc->hedge->count);
+
+  for (uint32_t x= 0; x < 1000; x++)
+  {
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "hedge:%u", x);
+    memcached_hedge_key_st *entry= memcached_hedge_find(*memc, key, size_t(key_length), x % 4);
+    test_true(entry);
+    test_compare(x % 4, entry->sent_to);
+    test_false(memcached_hedge_find(*memc, key, size_t(key_length), (x +1) % 4));
+  }
+
+  memcached_hedge_reset(*memc);
+  test_zero(memc->hedge->count);
+  test_false(memcached_hedge_find(*memc, memcached_literal_param("hedge:7"), 3));
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+static void hedge_reply(int fd, const char *key, const char *value)
+{
+  protocol_binary_response_header header= {};
+  uint32_t flags= 0;
+  size_t key_length= strlen(key);
+  size_t value_length= strlen(value);
+
+  header.response.magic= PROTOCOL_BINARY_RES;
+  header.response.opcode= PROTOCOL_BINARY_CMD_GETK;
+  header.response.keylen= htons(uint16_t(key_length));
+  header.response.extlen= sizeof(flags);
+  header.response.bodylen= htonl(uint32_t(sizeof(flags) +key_length +value_length));
+
+  std::string packet((const char *)header.bytes, sizeof(header.bytes));
+  packet.append((const char *)&flags, sizeof(flags));
+  packet.append(key, key_length);
+  packet.append(value, value_length);
+  fatal_assert(send(fd, packet.data(), packet.size(), 0) == ssize_t(packet.size()));
+}
+
+// The GETK waiting on the server's end of the socket, if there is one.
+static std::string hedge_request(int fd)
+{
+  char buffer[1024];
+  ssize_t length= recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+  if (length < ssize_t(sizeof(protocol_binary_request_header)))
+  {
+    return std::string();
+  }
+
+  protocol_binary_request_header header;
+  memcpy(header.bytes, buffer, sizeof(header.bytes));
+  if (header.request.opcode != PROTOCOL_BINARY_CMD_GETK)
+  {
+    return std::string();
+  }
+
+  return std::string(buffer +sizeof(header.bytes), ntohs(header.request.keylen));
+}
+
+/*
+  Two servers on socket pairs, the key's home never answers in time. The
+  first fetch has to hedge to the replica, hand back its copy, and drop the
+  one the home server sends afterwards.
+*/
+test_return_t hedge_fetch_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_BINARY_PROTOCOL, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.3.0.1", 11211));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.3.0.2", 11211));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_NUMBER_OF_REPLICAS, 1));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE, 50));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_POLL_TIMEOUT, 20));
+
+  int peer[2][2];
+  for (uint32_t x= 0; x < 2; x++)
+  {
+    test_zero(socketpair(AF_UNIX, SOCK_STREAM, 0, peer[x]));
+    test_true(fcntl(peer[x][0], F_SETFL, fcntl(peer[x][0], F_GETFL) | O_NONBLOCK) != -1);
+    memcached_instance_fetch(memc, x)->fd= peer[x][0];
+    memcached_instance_fetch(memc, x)->state= MEMCACHED_SERVER_STATE_CONNECTED;
+  }
+
+  const char *keys[]= { "hedged" };
+  size_t key_length[]= { strlen(keys[0]) };
+  uint32_t home= memcached_generate_hash_with_redistribution(memc, keys[0], key_length[0]);
+  uint32_t replica= (home +1) % 2;
+
+  // mget only sends, it does not wait for the hedge.
+  test_compare(MEMCACHED_SUCCESS, memcached_mget(memc, keys, key_length, 1));
+  test_compare(std::string(keys[0]), hedge_request(peer[home][1]));
+  test_compare(std::string(), hedge_request(peer[replica][1]));
+  test_true(memc->hedge->is_armed);
+
+  // The replica's answer is already waiting when the hedge goes out.
+  hedge_reply(peer[replica][1], keys[0], "replica");
+
+  memcached_return_t rc;
+  memcached_result_st *result= memcached_fetch_result(memc, NULL, &rc);
+  test_compare(MEMCACHED_SUCCESS, rc);
+  test_true(result);
+  test_compare(std::string("replica"), std::string(memcached_result_value(result), memcached_result_length(result)));
+  test_compare(std::string(keys[0]), hedge_request(peer[replica][1]));
+  test_false(memc->hedge->is_armed);
+  test_compare(replica, memcached_hedge_find(*memc, keys[0], key_length[0], home)->hedged_to);
+
+  // Timing out tells us nothing about the home server's latency.
+  test_zero(memcached_instance_fetch(memc, home)->latency.samples);
+
+  // The home server's late copy is dropped.
+  hedge_reply(peer[home][1], keys[0], "home");
+  test_false(memcached_fetch_result(memc, result, &rc));
+  test_compare(MEMCACHED_END, rc);
+  test_false(memc->pending_instances);
+
+  memcached_free(memc);
+  for (uint32_t x= 0; x < 2; x++)
+  {
+    close(peer[x][1]);
+  }
+
+  return TEST_SUCCESS;
+}
@@ -39,6 +39,11 @@
 
 using namespace libtest;
 
+#include "tests/continuum.h"
+#include "tests/error_ring.h"
+#include "tests/hedge.h"
+#include "tests/io.h"
+#include "tests/mux.h"
 #include "tests/string.h"
 
 /*
@@ -52,12 +57,66 @@ test_st string_tests[] ={
   {"string append", false, string_alloc_append },
   {"string append failure (too big)", false, string_alloc_append_toobig },
   {"string_alloc_append_multiple", false, string_alloc_append_multiple },
+  {"string alloc from slab", false, string_alloc_slab },
+  {"string alloc inline in result", false, string_alloc_inline },
   {0, 0, 0}
 };
 
 
+test_st continuum_tests[] ={
+  {"continuum lookup", false, continuum_lookup_TEST },
+  {"continuum lookup with skewed runs", false, continuum_lookup_skewed_TEST },
+  {"continuum lookup benchmark", false, continuum_lookup_benchmark_TEST },
+  {"continuum eject and rejoin", false, continuum_eject_rejoin_TEST },
+  {"continuum load balance", false, continuum_load_balance_TEST },
+  {"continuum 64 bit", false, continuum_64bit_TEST },
+  {"continuum jump", false, continuum_jump_TEST },
+  {"continuum rendezvous", false, continuum_rendezvous_TEST },
+  {"continuum rendezvous skeleton", false, continuum_rendezvous_skeleton_TEST },
+  {"continuum maglev", false, continuum_maglev_TEST },
+  {"continuum maglev benchmark", false, continuum_maglev_benchmark_TEST },
+  {"continuum bounded load", false, continuum_bounded_load_TEST },
+  {"continuum route dispatch", false, continuum_route_dispatch_TEST },
+  {"continuum namespace hash", false, continuum_namespace_hash_TEST },
+  {"continuum snapshot", false, continuum_snapshot_TEST },
+  {0, 0, 0}
+};
+
+test_st error_ring_tests[] ={
+  {"error ring long message", false, error_ring_long_message_TEST },
+  {"error ring shared message", false, error_ring_shared_message_TEST },
+  {"error ring wrap", false, error_ring_wrap_TEST },
+  {0, 0, 0}
+};
+
+test_st hedge_tests[] ={
+  {"hedge table", false, hedge_table_TEST },
+  {"hedge on first fetch", false, hedge_fetch_TEST },
+  {0, 0, 0}
+};
+
+test_st io_tests[] ={
+  {"io active lists", false, io_active_lists_TEST },
+  {"io active lists after sort_hosts()", false, io_active_sort_hosts_TEST },
+  {"io active lists after close_socket()", false, io_active_close_socket_TEST },
+  {"io batch drained at the bytes watermark", false, io_batch_watermark_TEST },
+  {"io batch drains quiet hits", false, io_batch_quiet_watermark_TEST },
+  {0, 0, 0}
+};
+
+test_st mux_tests[] ={
+  {"mux retry_timeout backoff", false, mux_backoff_TEST },
+  {"mux auto eject", false, mux_auto_eject_TEST },
+  {0, 0, 0}
+};
+
 collection_st collection[] ={
   {"string", 0, 0, string_tests},
+  {"continuum", 0, 0, continuum_tests},
+  {"error ring", 0, 0, error_ring_tests},
+  {"hedge", 0, 0, hedge_tests},
+  {"io", 0, 0, io_tests},
+  {"mux", 0, 0, mux_tests},
   {0, 0, 0, 0}
 };
 
@@ -0,0 +1,412 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+// We let libmemcached/common.h define config since we are looking at
+// library internals.
+
+#include <libmemcached/common.h>
+
+#include <libtest/test.hpp>
+
+#include <tests/io.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/socket.h>
+
+#include <string>
+#include <vector>
+
+using namespace libtest;
+
+static test_return_t io_cluster_add(memcached_st *memc, uint32_t first, uint32_t servers)
+{
+  for (uint32_t x= first; x < first +servers; x++)
+  {
+    char hostname[32];
+    snprintf(hostname, sizeof(hostname), "10.1.0.%u", x);
+    test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, hostname, 11211));
+  }
+
+  return TEST_SUCCESS;
+}
+
+static uint32_t io_list_count(memcached_instance_st *head, memcached_instance_link_st memcached_instance_st::*link)
+{
+  uint32_t count= 0;
+  for (memcached_instance_st *instance= head; instance; instance= (instance->*link).next)
+  {
+    count++;
+  }
+
+  return count;
+}
+
+static memcached_instance_st *io_instance_by_name(memcached_st *memc, const char *hostname)
+{
+  for (uint32_t x= 0; x < memcached_server_count(memc); x++)
+  {
+    memcached_instance_st *instance= memcached_instance_fetch(memc, x);
+    if (strcmp(instance->hostname(), hostname) == 0)
+    {
+      return instance;
+    }
+  }
+
+  return NULL;
+}
+
+test_return_t io_active_lists_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(TEST_SUCCESS, io_cluster_add(memc, 0, 4));
+  test_false(memc->pending_instances);
+  test_false(memc->dirty_instances);
+
+  memcached_instance_response_increment(memcached_instance_fetch(memc, 1));
+  test_true(memc->pending_instances == memcached_instance_fetch(memc, 1));
+
+  // With a single server pending there is nothing to poll.
+  memcached_return_t rc;
+  test_true(memcached_io_get_readable_server(memc, rc) == memcached_instance_fetch(memc, 1));
+
+  memcached_instance_response_increment(memcached_instance_fetch(memc, 1));
+  memcached_instance_response_increment(memcached_instance_fetch(memc, 3));
+  test_compare(2U, io_list_count(memc->pending_instances, &memcached_instance_st::pending));
+
+  memcached_instance_st *dirty= memcached_instance_fetch(memc, 2);
+  dirty->write_buffer_offset= 1;
+  memcached_instance_dirty_update(dirty);
+  test_true(memc->dirty_instances == dirty);
+
+  // Growing the server list moves the instances, the lists have to follow.
+  test_compare(TEST_SUCCESS, io_cluster_add(memc, 4, 64));
+
+  test_compare(2U, io_list_count(memc->pending_instances, &memcached_instance_st::pending));
+  for (memcached_instance_st *instance= memc->pending_instances; instance; instance= instance->pending.next)
+  {
+    test_true(instance == memcached_instance_fetch(memc, 1) or instance == memcached_instance_fetch(memc, 3));
+  }
+  test_compare(1U, io_list_count(memc->dirty_instances, &memcached_instance_st::dirty));
+  test_true(memc->dirty_instances == memcached_instance_fetch(memc, 2));
+
+  dirty= memcached_instance_fetch(memc, 2);
+  dirty->write_buffer_offset= 0;
+  memcached_instance_dirty_update(dirty);
+  test_false(memc->dirty_instances);
+
+  memcached_instance_response_decrement(memcached_instance_fetch(memc, 1));
+  test_compare(2U, io_list_count(memc->pending_instances, &memcached_instance_st::pending));
+  memcached_instance_response_decrement(memcached_instance_fetch(memc, 1));
+  test_true(memc->pending_instances == memcached_instance_fetch(memc, 3));
+  memcached_instance_response_reset(memcached_instance_fetch(memc, 3));
+  test_false(memc->pending_instances);
+  test_false(memcached_io_get_readable_server(memc, rc));
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t io_active_sort_hosts_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_SORT_HOSTS, true));
+  test_compare(TEST_SUCCESS, io_cluster_add(memc, 10, 8));
+
+  memcached_instance_response_increment(io_instance_by_name(memc, "10.1.0.12"));
+  memcached_instance_response_increment(io_instance_by_name(memc, "10.1.0.15"));
+  memcached_instance_st *dirty= io_instance_by_name(memc, "10.1.0.17");
+  dirty->write_buffer_offset= 1;
+  memcached_instance_dirty_update(dirty);
+
+  // The new server sorts ahead of every server already there, so sort_hosts()
+  // shifts the whole array and the lists have to be threaded again.
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.0.0.1", 11211));
+  test_true(strcmp(memcached_instance_fetch(memc, 0)->hostname(), "10.0.0.1") == 0);
+
+  test_compare(2U, io_list_count(memc->pending_instances, &memcached_instance_st::pending));
+  for (memcached_instance_st *instance= memc->pending_instances; instance; instance= instance->pending.next)
+  {
+    test_true(instance == io_instance_by_name(memc, "10.1.0.12") or instance == io_instance_by_name(memc, "10.1.0.15"));
+    test_compare(1U, instance->response_count());
+    test_true(*instance->pending.prev_next == instance);
+  }
+  test_compare(1U, io_list_count(memc->dirty_instances, &memcached_instance_st::dirty));
+  test_true(memc->dirty_instances == io_instance_by_name(memc, "10.1.0.17"));
+  test_true(memc->dirty_instances->dirty.prev_next == &memc->dirty_instances);
+
+  memcached_instance_response_reset(io_instance_by_name(memc, "10.1.0.12"));
+  memcached_instance_response_reset(io_instance_by_name(memc, "10.1.0.15"));
+  test_false(memc->pending_instances);
+  dirty= io_instance_by_name(memc, "10.1.0.17");
+  dirty->write_buffer_offset= 0;
+  memcached_instance_dirty_update(dirty);
+  test_false(memc->dirty_instances);
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t io_active_close_socket_TEST(void *)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(TEST_SUCCESS, io_cluster_add(memc, 0, 4));
+
+  for (uint32_t x= 0; x < 4; x++)
+  {
+    memcached_instance_st *instance= memcached_instance_fetch(memc, x);
+    memcached_instance_response_increment(instance);
+    instance->write_buffer_offset= 1;
+    memcached_instance_dirty_update(instance);
+  }
+  test_compare(4U, io_list_count(memc->pending_instances, &memcached_instance_st::pending));
+  test_compare(4U, io_list_count(memc->dirty_instances, &memcached_instance_st::dirty));
+
+  // Closing one in the middle leaves its neighbours linked to each other.
+  memcached_instance_fetch(memc, 2)->close_socket();
+  test_compare(3U, io_list_count(memc->pending_instances, &memcached_instance_st::pending));
+  test_compare(3U, io_list_count(memc->dirty_instances, &memcached_instance_st::dirty));
+  for (memcached_instance_st *instance= memc->pending_instances; instance; instance= instance->pending.next)
+  {
+    test_true(instance != memcached_instance_fetch(memc, 2));
+  }
+  for (memcached_instance_st *instance= memc->dirty_instances; instance; instance= instance->dirty.next)
+  {
+    test_true(instance != memcached_instance_fetch(memc, 2));
+  }
+  test_false(memcached_instance_fetch(memc, 2)->pending.prev_next);
+  test_false(memcached_instance_fetch(memc, 2)->dirty.prev_next);
+
+  // memcached_quit() closes the rest.
+  memcached_quit(memc);
+  test_false(memc->pending_instances);
+  test_false(memc->dirty_instances);
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+static bool io_read_all(int fd, void *buffer, size_t length)
+{
+  char *ptr= static_cast<char *>(buffer);
+  while (length)
+  {
+    ssize_t nr= recv(fd, ptr, length, 0);
+    if (nr <= 0)
+    {
+      return false;
+    }
+    ptr+= nr;
+    length-= size_t(nr);
+  }
+
+  return true;
+}
+
+struct io_batch_server_st {
+  int fd;
+  size_t touches;
+  size_t hits;
+};
+
+/*
+  Answers every TOUCH with "not found", every GETQ with a hit that carries
+  a value and the NOOP with a NOOP, writing each reply before it reads the
+  next request, so it stops reading as soon as nobody reads what it writes.
+*/
+static void *io_batch_server(void *arg)
+{
+  io_batch_server_st *server= static_cast<io_batch_server_st *>(arg);
+  char body[1024];
+
+  protocol_binary_request_header request;
+  while (io_read_all(server->fd, request.bytes, sizeof(request.bytes)))
+  {
+    uint32_t bodylen= ntohl(request.request.bodylen);
+    if (bodylen > sizeof(body) or io_read_all(server->fd, body, bodylen) == false)
+    {
+      break;
+    }
+
+    struct {
+      protocol_binary_response_header header;
+      uint32_t flags;
+      char value[200];
+    } response;
+    memset(&response, 0, sizeof(response));
+    response.header.response.magic= PROTOCOL_BINARY_RES;
+    response.header.response.opcode= request.request.opcode;
+    response.header.response.opaque= request.request.opaque;
+    size_t length= sizeof(response.header);
+    if (request.request.opcode == PROTOCOL_BINARY_CMD_TOUCH)
+    {
+      response.header.response.status= htons(PROTOCOL_BINARY_RESPONSE_KEY_ENOENT);
+      server->touches++;
+    }
+    else if (request.request.opcode == PROTOCOL_BINARY_CMD_GETQ)
+    {
+      response.header.response.extlen= sizeof(response.flags);
+      response.header.response.bodylen= htonl(uint32_t(sizeof(response.flags) +sizeof(response.value)));
+      memset(response.value, 'v', sizeof(response.value));
+      length+= sizeof(response.flags) +sizeof(response.value);
+      server->hits++;
+    }
+    else if (request.request.opcode != PROTOCOL_BINARY_CMD_NOOP)
+    {
+      break;
+    }
+
+    if (send(server->fd, &response, length, 0) != ssize_t(length))
+    {
+      break;
+    }
+  }
+  close(server->fd);
+
+  return NULL;
+}
+
+/*
+  A batch far larger than the socket buffers in both directions only
+  completes if its replies are read while it is still sending. With the
+  message watermark out of the way it is io_bytes_watermark that has to
+  make memcached_purge() drain them into the batch's results.
+*/
+test_return_t io_batch_watermark_TEST(void *)
+{
+  const size_t number_of_keys= 100000;
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_BINARY_PROTOCOL, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_IO_MSG_WATERMARK, UINT32_MAX));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.4.0.1", 11211));
+
+  int peer[2];
+  test_zero(socketpair(AF_UNIX, SOCK_STREAM, 0, peer));
+  test_true(fcntl(peer[0], F_SETFL, fcntl(peer[0], F_GETFL) | O_NONBLOCK) != -1);
+  memcached_instance_fetch(memc, 0)->fd= peer[0];
+  memcached_instance_fetch(memc, 0)->state= MEMCACHED_SERVER_STATE_CONNECTED;
+
+  io_batch_server_st server= { peer[1], 0, 0 };
+  pthread_t thread;
+  test_zero(pthread_create(&thread, NULL, io_batch_server, &server));
+
+  std::vector<std::string> storage(number_of_keys);
+  std::vector<const char *> keys(number_of_keys);
+  std::vector<size_t> key_length(number_of_keys);
+  for (size_t x= 0; x < number_of_keys; x++)
+  {
+    char key[32];
+    int length= snprintf(key, sizeof(key), "batch:%lu", static_cast<unsigned long>(x));
+    storage[x].assign(key, size_t(length));
+    keys[x]= storage[x].c_str();
+    key_length[x]= storage[x].size();
+  }
+
+  std::vector<memcached_return_t> results(number_of_keys, MEMCACHED_SUCCESS);
+  test_compare(MEMCACHED_SOME_ERRORS,
+               memcached_touch_multi(memc, &keys[0], &key_length[0], number_of_keys, 0, &results[0]));
+  for (size_t x= 0; x < number_of_keys; x++)
+  {
+    test_compare(MEMCACHED_NOTFOUND, results[x]);
+  }
+
+  memcached_free(memc);
+  test_zero(pthread_join(thread, NULL));
+  test_compare(number_of_keys, server.touches);
+
+  return TEST_SUCCESS;
+}
+
+/*
+  exist_multi() in the binary protocol sends nothing but GETQ, so until the
+  final NOOP no reply is counted as outstanding. Every hit still streams
+  its value back, and unless the quiet requests count toward the watermark
+  those values fill both socket buffers long before the NOOP is sent.
+*/
+test_return_t io_batch_quiet_watermark_TEST(void *)
+{
+  const size_t number_of_keys= 100000;
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_BINARY_PROTOCOL, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "10.4.0.1", 11211));
+
+  int peer[2];
+  test_zero(socketpair(AF_UNIX, SOCK_STREAM, 0, peer));
+  test_true(fcntl(peer[0], F_SETFL, fcntl(peer[0], F_GETFL) | O_NONBLOCK) != -1);
+  memcached_instance_fetch(memc, 0)->fd= peer[0];
+  memcached_instance_fetch(memc, 0)->state= MEMCACHED_SERVER_STATE_CONNECTED;
+
+  io_batch_server_st server= { peer[1], 0, 0 };
+  pthread_t thread;
+  test_zero(pthread_create(&thread, NULL, io_batch_server, &server));
+
+  std::vector<std::string> storage(number_of_keys);
+  std::vector<const char *> keys(number_of_keys);
+  std::vector<size_t> key_length(number_of_keys);
+  for (size_t x= 0; x < number_of_keys; x++)
+  {
+    char key[32];
+    int length= snprintf(key, sizeof(key), "quiet:%lu", static_cast<unsigned long>(x));
+    storage[x].assign(key, size_t(length));
+    keys[x]= storage[x].c_str();
+    key_length[x]= storage[x].size();
+  }
+
+  std::vector<memcached_return_t> results(number_of_keys, MEMCACHED_NOTFOUND);
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_exist_multi(memc, &keys[0], &key_length[0], number_of_keys, &results[0]));
+  for (size_t x= 0; x < number_of_keys; x++)
+  {
+    test_compare(MEMCACHED_SUCCESS, results[x]);
+  }
+
+  memcached_free(memc);
+  test_zero(pthread_join(thread, NULL));
+  test_compare(number_of_keys, server.hits);
+
+  return TEST_SUCCESS;
+}
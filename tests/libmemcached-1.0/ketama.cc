@@ -77,7 +77,7 @@ test_return_t ketama_compatibility_libmemcached(memcached_st *)
   /* VDEAAAAA hashes to fffcd1b5, after the last continuum point, and lets
    * us test the boundary wraparound.
    */
-  test_true(memcached_generate_hash(memc, (char *)"VDEAAAAA", 8) == memc->ketama.continuum[0].index);
+  test_true(memcached_generate_hash(memc, (char *)"VDEAAAAA", 8) == memcached_continuum_lookup_index(memc->ketama.lookup, 0));
 
   /* verify the standard ketama set. */
   for (uint32_t x= 0; x < 99; x++)
@@ -138,7 +138,7 @@ test_return_t user_supplied_bug18(memcached_st *trash)
   /* VDEAAAAA hashes to fffcd1b5, after the last continuum point, and lets
    * us test the boundary wraparound.
    */
-  test_true(memcached_generate_hash(memc, (char *)"VDEAAAAA", 8) == memc->ketama.continuum[0].index);
+  test_true(memcached_generate_hash(memc, (char *)"VDEAAAAA", 8) == memcached_continuum_lookup_index(memc->ketama.lookup, 0));
 
   /* verify the standard ketama set. */
   for (x= 0; x < 99; x++)
@@ -269,7 +269,7 @@ test_return_t ketama_compatibility_spymemcached(memcached_st *)
   /* VDEAAAAA hashes to fffcd1b5, after the last continuum point, and lets
    * us test the boundary wraparound.
    */
-  test_true(memcached_generate_hash(memc, (char *)"VDEAAAAA", 8) == memc->ketama.continuum[0].index);
+  test_true(memcached_generate_hash(memc, (char *)"VDEAAAAA", 8) == memcached_continuum_lookup_index(memc->ketama.lookup, 0));
 
   /* verify the standard ketama set. */
   for (uint32_t x= 0; x < 99; x++)
@@ -56,6 +56,8 @@
 
 #include <cerrno>
 #include <memory>
+#include <string>
+#include <vector>
 #include <pthread.h>
 #include <semaphore.h>
 #include <signal.h>
@@ -466,7 +468,7 @@ test_return_t libmemcached_string_behavior_test(memcached_st *)
   {
     test_true(libmemcached_string_behavior(memcached_behavior_t(x)));
   }
-  test_compare(37, int(MEMCACHED_BEHAVIOR_MAX));
+  test_compare(42, int(MEMCACHED_BEHAVIOR_MAX));
 
   return TEST_SUCCESS;
 }
@@ -477,7 +479,7 @@ test_return_t libmemcached_string_distribution_test(memcached_st *)
   {
     test_true(libmemcached_string_distribution(memcached_server_distribution_t(x)));
   }
-  test_compare(7, int(MEMCACHED_DISTRIBUTION_CONSISTENT_MAX));
+  test_compare(11, int(MEMCACHED_DISTRIBUTION_CONSISTENT_MAX));
 
   return TEST_SUCCESS;
 }
@@ -1184,6 +1186,62 @@ test_return_t set_test3(memcached_st *memc)
   return TEST_SUCCESS;
 }
 
+test_return_t mset_test(memcached_st *memc)
+{
+  const size_t number_of_keys= 64;
+
+  std::vector<std::string> key_storage;
+  std::vector<const char *> keys;
+  std::vector<size_t> key_length;
+  std::vector<uint32_t> flags;
+  for (size_t x= 0; x < number_of_keys; x++)
+  {
+    char key[16];
+    snprintf(key, sizeof(key), "mset%u", uint32_t(x));
+    key_storage.push_back(key);
+    flags.push_back(uint32_t(x));
+  }
+
+  for (size_t x= 0; x < number_of_keys; x++)
+  {
+    keys.push_back(key_storage[x].c_str());
+    key_length.push_back(key_storage[x].size());
+  }
+
+  // An empty key fails on its own without holding up the rest of the batch
+  key_length[7]= 0;
+
+  std::vector<memcached_return_t> results(number_of_keys);
+  test_compare(MEMCACHED_SOME_ERRORS,
+               memcached_mset(memc, &keys[0], &key_length[0],
+                              &keys[0], &key_length[0],
+                              NULL, &flags[0],
+                              number_of_keys, &results[0]));
+
+  for (size_t x= 0; x < number_of_keys; x++)
+  {
+    if (x == 7)
+    {
+      test_compare(MEMCACHED_BAD_KEY_PROVIDED, results[x]);
+      continue;
+    }
+    test_compare(MEMCACHED_SUCCESS, results[x]);
+
+    size_t value_length;
+    uint32_t value_flags;
+    memcached_return_t rc;
+    char *value= memcached_get(memc, keys[x], key_length[x], &value_length, &value_flags, &rc);
+    test_compare(MEMCACHED_SUCCESS, rc);
+    test_true(value);
+    test_compare(key_length[x], value_length);
+    test_memcmp(keys[x], value, value_length);
+    test_compare(flags[x], value_flags);
+    free(value);
+  }
+
+  return TEST_SUCCESS;
+}
+
 test_return_t mget_end(memcached_st *memc)
 {
   const char *keys[]= { "foo", "foo2" };
@@ -1331,6 +1389,63 @@ test_return_t increment_with_initial_999_test(memcached_st *memc)
   return __increment_with_initial_test(memc, 999);
 }
 
+test_return_t increment_multi_with_initial_test(memcached_st *memc)
+{
+  const char *keys[]= { "counter_a", "counter_b", "counter_c" };
+  size_t key_length[]= { 9, 9, 9 };
+  uint64_t offset[]= { 1, 5, 10 };
+  uint64_t initial[]= { 100, 200, 300 };
+  uint64_t values[3];
+  memcached_return_t results[3];
+
+  test_compare(MEMCACHED_SUCCESS, memcached_flush_buffers(memc));
+
+  if (memcached_behavior_get(memc, MEMCACHED_BEHAVIOR_BINARY_PROTOCOL) == 0)
+  {
+    test_compare(MEMCACHED_INVALID_ARGUMENTS,
+                 memcached_increment_multi_with_initial(memc, keys, key_length, offset, initial, NULL, 3, values, results));
+    return TEST_SUCCESS;
+  }
+
+  memcached_return_t rc;
+  for (size_t x= 0; x < 3; x++)
+  {
+    rc= memcached_delete(memc, keys[x], key_length[x], 0);
+    test_true(rc == MEMCACHED_SUCCESS or rc == MEMCACHED_NOTFOUND);
+  }
+
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_increment_multi_with_initial(memc, keys, key_length, offset, initial, NULL, 3, values, results));
+  for (size_t x= 0; x < 3; x++)
+  {
+    test_compare(MEMCACHED_SUCCESS, results[x]);
+    test_compare(initial[x], values[x]);
+  }
+
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_increment_multi_with_initial(memc, keys, key_length, offset, initial, NULL, 3, values, results));
+  for (size_t x= 0; x < 3; x++)
+  {
+    test_compare(initial[x] +offset[x], values[x]);
+  }
+
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_decrement_multi_with_initial(memc, keys, key_length, offset, initial, NULL, 3, values, results));
+  for (size_t x= 0; x < 3; x++)
+  {
+    test_compare(initial[x], values[x]);
+  }
+
+  // Without a values array the quiet opcodes are used
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_increment_multi_with_initial(memc, keys, key_length, offset, initial, NULL, 3, NULL, results));
+  uint64_t new_number;
+  test_compare(MEMCACHED_SUCCESS, memcached_increment(memc, keys[2], key_length[2], 0, &new_number));
+  test_compare(initial[2] +offset[2], new_number);
+
+  return TEST_SUCCESS;
+}
+
 test_return_t decrement_test(memcached_st *memc)
 {
   test_compare(return_value_based_on_buffering(memc),
@@ -3842,6 +3957,34 @@ test_return_t jenkins_run (memcached_st *)
   return TEST_SUCCESS;
 }
 
+test_return_t xxh3_TEST(memcached_st *)
+{
+  uint32_t x;
+  const char **ptr;
+
+  for (ptr= list_to_hash, x= 0; *ptr; ptr++, x++)
+  {
+    test_compare(xxh3_values[x],
+                 memcached_generate_hash_value(*ptr, strlen(*ptr), MEMCACHED_HASH_XXH3));
+  }
+
+  return TEST_SUCCESS;
+}
+
+test_return_t crc32c_TEST(memcached_st *)
+{
+  uint32_t x;
+  const char **ptr;
+
+  for (ptr= list_to_hash, x= 0; *ptr; ptr++, x++)
+  {
+    test_compare(crc32c_values[x],
+                 memcached_generate_hash_value(*ptr, strlen(*ptr), MEMCACHED_HASH_CRC32C));
+  }
+
+  return TEST_SUCCESS;
+}
+
 static uint32_t hash_md5_test_function(const char *string, size_t string_length, void *)
 {
   return libhashkit_md5(string, string_length);
@@ -63,6 +63,7 @@ test_return_t check_for_1_2_3(memcached_st *memc);
 test_return_t clone_test(memcached_st *memc);
 test_return_t connection_test(memcached_st *memc);
 test_return_t crc_run (memcached_st *);
+test_return_t crc32c_TEST(memcached_st *);
 test_return_t decrement_by_key_test(memcached_st *memc);
 test_return_t decrement_test(memcached_st *memc);
 test_return_t decrement_with_initial_by_key_test(memcached_st *memc);
@@ -89,6 +90,7 @@ test_return_t increment_by_key_test(memcached_st *memc);
 test_return_t increment_test(memcached_st *memc);
 test_return_t increment_with_initial_by_key_test(memcached_st *memc);
 test_return_t increment_with_initial_test(memcached_st *memc);
+test_return_t increment_multi_with_initial_test(memcached_st *memc);
 test_return_t increment_with_initial_999_test(memcached_st *memc);
 test_return_t init_test(memcached_st *not_used);
 test_return_t jenkins_run (memcached_st *);
@@ -154,6 +156,7 @@ test_return_t set_namespace_and_binary(memcached_st *memc);
 test_return_t set_test(memcached_st *memc);
 test_return_t set_test2(memcached_st *memc);
 test_return_t set_test3(memcached_st *memc);
+test_return_t mset_test(memcached_st *memc);
 test_return_t stats_servername_test(memcached_st *memc);
 test_return_t test_get_last_disconnect(memcached_st *memc);
 test_return_t test_multiple_get_last_disconnect(memcached_st *);
@@ -180,6 +183,7 @@ test_return_t util_version_test(memcached_st *memc);
 test_return_t version_string_test(memcached_st *);
 test_return_t wrong_failure_counter_test(memcached_st *memc);
 test_return_t wrong_failure_counter_two_test(memcached_st *memc);
+test_return_t xxh3_TEST(memcached_st *);
 test_return_t kill_HUP_TEST(memcached_st *memc);
 test_return_t regression_996813_TEST(memcached_st*);
 test_return_t regression_994772_TEST(memcached_st*);
@@ -37,6 +37,20 @@
 #include <mem_config.h>
 #include <libtest/test.hpp>
 
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__x86_64__)
+# include <stddef.h>
+# include <sys/prctl.h>
+# include <sys/syscall.h>
+# include <linux/audit.h>
+# include <linux/filter.h>
+# include <linux/seccomp.h>
+# define HAVE_SYSCALL_FILTER 1
+#endif
+
 /*
   Test cases
 */
@@ -217,3 +231,115 @@ test_return_t get_test5(memcached_st *memc)
 
   return TEST_SUCCESS;
 }
+
+#ifdef HAVE_SYSCALL_FILTER
+#define SYSCALL_ALLOW(__nr) \
+  BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, (__nr), 0, 1), \
+  BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW)
+
+/*
+  Only the socket I/O the protocol needs is let through; anything else
+  (gettimeofday() falling out of the vDSO, a stray fcntl(), ...) kills
+  the process.
+*/
+static bool restrict_syscalls_to_socket_io(void)
+{
+  struct sock_filter filter[]= {
+    BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(struct seccomp_data, arch)),
+    BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, AUDIT_ARCH_X86_64, 1, 0),
+    BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_KILL),
+    BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(struct seccomp_data, nr)),
+    SYSCALL_ALLOW(__NR_sendto),
+    SYSCALL_ALLOW(__NR_sendmsg),
+    SYSCALL_ALLOW(__NR_recvfrom),
+    SYSCALL_ALLOW(__NR_recvmsg),
+    SYSCALL_ALLOW(__NR_poll),
+    SYSCALL_ALLOW(__NR_ppoll),
+    SYSCALL_ALLOW(__NR_exit),
+    SYSCALL_ALLOW(__NR_exit_group),
+    BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_KILL),
+  };
+
+  struct sock_fprog program;
+  program.len= (unsigned short)(sizeof(filter) / sizeof(filter[0]));
+  program.filter= filter;
+
+  if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) == -1)
+  {
+    return false;
+  }
+
+  return prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &program) == 0;
+}
+#endif
+
+/*
+  Once a connection is established a cached set or get should cost
+  nothing but send/recv/poll. Run a batch of them in a child that is
+  killed on any other syscall.
+*/
+test_return_t get_syscall_TEST(memcached_st *memc)
+{
+#ifdef HAVE_SYSCALL_FILTER
+  // Warm up the connection and the allocator before the filter goes on.
+  for (uint32_t x= 0; x < 10; x++)
+  {
+    test_compare(return_value_based_on_buffering(memc),
+                 memcached_set(memc, test_literal_param(__func__),
+                               test_literal_param(__func__),
+                               time_t(0), uint32_t(0)));
+    memcached_return_t rc;
+    size_t value_length;
+    uint32_t flags;
+    char *value= memcached_get(memc, test_literal_param(__func__),
+                               &value_length, &flags, &rc);
+    test_compare(MEMCACHED_SUCCESS, rc);
+    test_true(value);
+    free(value);
+  }
+
+  pid_t child= fork();
+  test_true(child != -1);
+
+  if (child == 0)
+  {
+    if (restrict_syscalls_to_socket_io() == false)
+    {
+      _exit(EXIT_FAILURE);
+    }
+
+    for (uint32_t x= 0; x < 1000; x++)
+    {
+      if (memcached_failed(memcached_set(memc, test_literal_param(__func__),
+                                         test_literal_param(__func__),
+                                         time_t(0), uint32_t(0))))
+      {
+        _exit(EXIT_FAILURE);
+      }
+
+      memcached_return_t rc;
+      size_t value_length;
+      uint32_t flags;
+      char *value= memcached_get(memc, test_literal_param(__func__),
+                                 &value_length, &flags, &rc);
+      if (memcached_failed(rc) or value == NULL)
+      {
+        _exit(EXIT_FAILURE);
+      }
+      free(value);
+    }
+
+    _exit(EXIT_SUCCESS);
+  }
+
+  int status;
+  test_compare(child, waitpid(child, &status, 0));
+  test_true(WIFEXITED(status));
+  test_compare(EXIT_SUCCESS, WEXITSTATUS(status));
+
+  return TEST_SUCCESS;
+#else
+  (void)memc;
+  return TEST_SKIPPED;
+#endif
+}
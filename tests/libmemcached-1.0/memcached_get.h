@@ -41,4 +41,5 @@ test_return_t get_test2(memcached_st*);
 test_return_t get_test3(memcached_st*);
 test_return_t get_test4(memcached_st*);
 test_return_t get_test5(memcached_st*);
+test_return_t get_syscall_TEST(memcached_st*);
 
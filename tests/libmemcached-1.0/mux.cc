@@ -0,0 +1,261 @@
+/*  vim:expandtab:shiftwidth=2:tabstop=2:smarttab:
+ * 
+ *  Libmemcached library
+ *
+ *  Copyright (C) 2011 Data Differential, http://datadifferential.com/
+ *  Copyright (C) 2006-2009 Brian Aker All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are
+ *  met:
+ *
+ *      * Redistributions of source code must retain the above copyright
+ *  notice, this list of conditions and the following disclaimer.
+ *
+ *      * Redistributions in binary form must reproduce the above
+ *  copyright notice, this list of conditions and the following disclaimer
+ *  in the documentation and/or other materials provided with the
+ *  distribution.
+ *
+ *      * The names of its contributors may not be used to endorse or
+ *  promote products derived from this software without specific prior
+ *  written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+// We let libmemcached/common.h define config since we are looking at
+// library internals.
+
+#include <libmemcached/common.h>
+#include <libmemcachedutil-1.0/util.h>
+
+#include <libtest/test.hpp>
+
+#include <tests/mux.h>
+
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+using namespace libtest;
+
+static void mux_socket_path(char *path, size_t length, const char *suffix)
+{
+  snprintf(path, length, "/tmp/libmemcached_mux_test.%d.%s", int(getpid()), suffix);
+}
+
+static bool mux_read_all(int fd, void *buffer, size_t length)
+{
+  char *ptr= static_cast<char *>(buffer);
+  while (length)
+  {
+    ssize_t nr= recv(fd, ptr, length, 0);
+    if (nr <= 0)
+    {
+      return false;
+    }
+    ptr+= nr;
+    length-= size_t(nr);
+  }
+
+  return true;
+}
+
+struct mux_server_st {
+  int fd;
+  size_t requests;
+};
+
+/*
+  Accepts one connection and answers VERSION, which opens it, then SET with
+  success and anything else with "not found" until the client quits.
+*/
+static void *mux_server(void *arg)
+{
+  mux_server_st *server= static_cast<mux_server_st *>(arg);
+
+  int fd;
+  if ((fd= accept(server->fd, NULL, NULL)) == -1)
+  {
+    return NULL;
+  }
+
+  char body[1024];
+  protocol_binary_request_header request;
+  while (mux_read_all(fd, request.bytes, sizeof(request.bytes)))
+  {
+    uint32_t bodylen= ntohl(request.request.bodylen);
+    if (bodylen > sizeof(body) or mux_read_all(fd, body, bodylen) == false)
+    {
+      break;
+    }
+
+    if (request.request.opcode == PROTOCOL_BINARY_CMD_QUIT)
+    {
+      break;
+    }
+
+    const char version[]= "1.4.15";
+    char reply[sizeof(protocol_binary_response_header) +sizeof(version)];
+    protocol_binary_response_header response= {};
+    response.response.magic= PROTOCOL_BINARY_RES;
+    response.response.opcode= request.request.opcode;
+    response.response.opaque= request.request.opaque;
+    size_t reply_length= sizeof(response.bytes);
+    if (request.request.opcode == PROTOCOL_BINARY_CMD_VERSION)
+    {
+      response.response.bodylen= htonl(uint32_t(sizeof(version) -1));
+      memcpy(reply +sizeof(response.bytes), version, sizeof(version) -1);
+      reply_length+= sizeof(version) -1;
+    }
+    else
+    {
+      if (request.request.opcode != PROTOCOL_BINARY_CMD_SET)
+      {
+        response.response.status= htons(PROTOCOL_BINARY_RESPONSE_KEY_ENOENT);
+      }
+      server->requests++;
+    }
+    memcpy(reply, response.bytes, sizeof(response.bytes));
+
+    if (send(fd, reply, reply_length, 0) != ssize_t(reply_length))
+    {
+      break;
+    }
+  }
+  close(fd);
+
+  return NULL;
+}
+
+/*
+  Once a server has refused server_failure_limit connects, the requests
+  that follow fail without trying it until retry_timeout has passed.
+*/
+test_return_t mux_backoff_TEST(void *)
+{
+  char dead[256];
+  mux_socket_path(dead, sizeof(dead), "dead");
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_SERVER_FAILURE_LIMIT, 2));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_RETRY_TIMEOUT, 30));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add_unix_socket(memc, dead));
+
+  memcached_mux_st *mux= memcached_mux_create(memc, 1);
+  test_true(mux);
+
+  memcached_return_t rc;
+  for (uint32_t x= 0; x < 2; x++)
+  {
+    test_null(memcached_mux_get(mux, test_literal_param("mux:backoff"), NULL, NULL, &rc));
+    test_true(memcached_failed(rc));
+    test_true(rc != MEMCACHED_SERVER_TEMPORARILY_DISABLED);
+  }
+
+  test_null(memcached_mux_get(mux, test_literal_param("mux:backoff"), NULL, NULL, &rc));
+  test_compare(MEMCACHED_SERVER_TEMPORARILY_DISABLED, rc);
+  test_compare(MEMCACHED_SERVER_TEMPORARILY_DISABLED,
+               memcached_mux_set(mux, test_literal_param("mux:backoff"), test_literal_param("value"), 0, 0));
+
+  test_true(memcached_mux_destroy(mux) == memc);
+  memcached_free(memc);
+
+  // The multiplexer does not speak UDP
+  memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_USE_UDP, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add(memc, "localhost", 11211));
+  test_null(memcached_mux_create(memc, 1));
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+/*
+  With auto-eject, a server that reaches server_failure_limit is passed
+  over and its keys go to the next server.
+*/
+test_return_t mux_auto_eject_TEST(void *)
+{
+  char dead[256];
+  char live[256];
+  mux_socket_path(dead, sizeof(dead), "dead");
+  mux_socket_path(live, sizeof(live), "live");
+
+  int listener= socket(AF_UNIX, SOCK_STREAM, 0);
+  test_true(listener != -1);
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family= AF_UNIX;
+  test_true(strlen(live) < sizeof(address.sun_path));
+  memcpy(address.sun_path, live, strlen(live) +1);
+  unlink(live);
+  test_zero(bind(listener, (struct sockaddr *)&address, sizeof(address)));
+  test_zero(listen(listener, 1));
+
+  mux_server_st server= { listener, 0 };
+  pthread_t thread;
+  test_zero(pthread_create(&thread, NULL, mux_server, &server));
+
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_AUTO_EJECT_HOSTS, true));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_SERVER_FAILURE_LIMIT, 1));
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_RETRY_TIMEOUT, 30));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add_unix_socket(memc, dead));
+  test_compare(MEMCACHED_SUCCESS, memcached_server_add_unix_socket(memc, live));
+
+  // A key that the master places on the dead server
+  char key[64];
+  int key_length= 0;
+  for (uint32_t x= 0; x < 1000; x++)
+  {
+    key_length= snprintf(key, sizeof(key), "mux:eject:%u", x);
+    if (memcached_generate_hash(memc, key, size_t(key_length)) == 0)
+    {
+      break;
+    }
+  }
+  test_zero(memcached_generate_hash(memc, key, size_t(key_length)));
+
+  memcached_mux_st *mux= memcached_mux_create(memc, 1);
+  test_true(mux);
+
+  memcached_return_t rc= memcached_mux_set(mux, key, size_t(key_length), test_literal_param("value"), 0, 0);
+  test_true(memcached_failed(rc));
+  test_true(rc != MEMCACHED_SERVER_MARKED_DEAD);
+
+  test_compare(MEMCACHED_SERVER_MARKED_DEAD,
+               memcached_mux_set(mux, key, size_t(key_length), test_literal_param("value"), 0, 0));
+  test_zero(server.requests);
+
+  // Ejected, so the key now lands on the live server
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_mux_set(mux, key, size_t(key_length), test_literal_param("value"), 0, 0));
+  test_null(memcached_mux_get(mux, key, size_t(key_length), NULL, NULL, &rc));
+  test_compare(MEMCACHED_NOTFOUND, rc);
+
+  test_true(memcached_mux_destroy(mux) == memc);
+  memcached_free(memc);
+
+  test_zero(pthread_join(thread, NULL));
+  test_compare(size_t(2), server.requests);
+  close(listener);
+  unlink(live);
+
+  return TEST_SUCCESS;
+}
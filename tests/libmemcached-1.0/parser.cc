@@ -143,6 +143,12 @@ static test_return_t __check_distribution_RANDOM(memcached_st *memc, const scann
   return TEST_SUCCESS;
 }
 
+static test_return_t __check_distribution_JUMP(memcached_st *memc, const scanner_string_st &)
+{
+  test_true(memcached_behavior_get(memc, MEMCACHED_BEHAVIOR_DISTRIBUTION) == MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP);
+  return TEST_SUCCESS;
+}
+
 scanner_variable_t test_server_strings[]= {
   { ARRAY, make_scanner_string("--server=localhost"), make_scanner_string("localhost"), __check_host },
   { ARRAY, make_scanner_string("--server=10.0.2.1"), make_scanner_string("10.0.2.1"), __check_host },
@@ -217,6 +223,7 @@ scanner_variable_t distribution_strings[]= {
   { ARRAY,  make_scanner_string("--DISTRIBUTION=consistent,MD5"), scanner_string_null, NULL },
   { ARRAY,  make_scanner_string("--DISTRIBUTION=random"), scanner_string_null, __check_distribution_RANDOM },
   { ARRAY,  make_scanner_string("--DISTRIBUTION=modula"), scanner_string_null, NULL },
+  { ARRAY,  make_scanner_string("--DISTRIBUTION=jump"), scanner_string_null, __check_distribution_JUMP },
   { NIL, scanner_string_null, scanner_string_null, NULL}
 };
 
@@ -40,6 +40,7 @@
 
 using namespace libtest;
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 #include <string>
@@ -495,3 +496,336 @@ test_return_t regression_bug_962815(memcached_st *memc)
 
   return TEST_SUCCESS;
 }
+
+struct pool_contention_st {
+  memcached_pool_st *pool;
+  size_t rounds;
+  uint32_t failures;
+};
+
+static void *contention_thread(void *ctx)
+{
+  pool_contention_st *context= (pool_contention_st *)ctx;
+
+  for (size_t x= 0; x < context->rounds; x++)
+  {
+    struct timespec relative_time= { 5, 0 };
+    memcached_return_t rc;
+    memcached_st *mc= memcached_pool_fetch(context->pool, &relative_time, &rc);
+    if (mc == NULL)
+    {
+      __sync_fetch_and_add(&context->failures, 1);
+      continue;
+    }
+
+    // Nobody else may be holding the same clone
+    if (memcached_set_user_data(mc, ctx) != NULL)
+    {
+      __sync_fetch_and_add(&context->failures, 1);
+    }
+
+    if (memcached_set_user_data(mc, NULL) != ctx)
+    {
+      __sync_fetch_and_add(&context->failures, 1);
+    }
+
+    if (memcached_failed(memcached_pool_release(context->pool, mc)))
+    {
+      __sync_fetch_and_add(&context->failures, 1);
+    }
+  }
+
+  return NULL;
+}
+
+/*
+  More threads than clones, all fetching and releasing as fast as they can
+  while the behaviors change underneath them.
+*/
+test_return_t connection_pool_contention_TEST(memcached_st *memc)
+{
+  pthread_t pid[NUM_THREADS];
+  pool_contention_st context= { memcached_pool_create(memc, 1, 4), 20000, 0 };
+  test_true(context.pool);
+
+  Timer timer;
+  timer.reset();
+  for (size_t x= 0; x < NUM_THREADS; x++)
+  {
+    test_compare(0, pthread_create(&pid[x], NULL, contention_thread, (void*)&context));
+  }
+
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_pool_behavior_set(context.pool, MEMCACHED_BEHAVIOR_IO_MSG_WATERMARK, 9999));
+
+  for (size_t x= 0; x < NUM_THREADS; x++)
+  {
+    test_compare(0, pthread_join(pid[x], NULL));
+  }
+  timer.sample();
+  test_zero(context.failures);
+
+  Out << (NUM_THREADS * context.rounds * 1000 / std::max(timer.elapsed_milliseconds(), uint64_t(1)))
+    << " fetch and release pairs/sec across " << NUM_THREADS << " threads";
+
+  // Every clone handed out afterwards carries the new behavior
+  memcached_st *mmc[4];
+  for (size_t x= 0; x < 4; x++)
+  {
+    memcached_return_t rc;
+    mmc[x]= memcached_pool_fetch(context.pool, NULL, &rc);
+    test_compare(MEMCACHED_SUCCESS, rc);
+    test_compare(uint64_t(9999), memcached_behavior_get(mmc[x], MEMCACHED_BEHAVIOR_IO_MSG_WATERMARK));
+  }
+
+  // An exhausted pool times out rather than growing
+  {
+    struct timespec relative_time= { 0, 50000000 };
+    memcached_return_t rc;
+    test_null(memcached_pool_fetch(context.pool, &relative_time, &rc));
+    test_compare(MEMCACHED_TIMEOUT, rc);
+  }
+
+  for (size_t x= 0; x < 4; x++)
+  {
+    test_compare(MEMCACHED_SUCCESS, memcached_pool_release(context.pool, mmc[x]));
+  }
+
+  test_true(memcached_pool_destroy(context.pool) == memc);
+
+  return TEST_SUCCESS;
+}
+
+#if defined(__linux__)
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+/*
+  Cache misses of this process and the threads it starts from now on, or -1
+  when the kernel will not count them for us.
+*/
+static int cache_miss_counter()
+{
+#if defined(__linux__)
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type= PERF_TYPE_HARDWARE;
+  attr.size= sizeof(attr);
+  attr.config= PERF_COUNT_HW_CACHE_MISSES;
+  attr.inherit= 1;
+  attr.exclude_kernel= 1;
+  attr.exclude_hv= 1;
+
+  return int(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+  return -1;
+#endif
+}
+
+static int64_t cache_misses(int counter)
+{
+  uint64_t count;
+  if (counter == -1 or read(counter, &count, sizeof(count)) != sizeof(count))
+  {
+    return -1;
+  }
+
+  return int64_t(count);
+}
+
+struct pool_affinity_st {
+  memcached_pool_st *pool;
+  size_t rounds;
+  uint32_t failures;
+  uint32_t same;
+};
+
+static void *affinity_thread(void *ctx)
+{
+  pool_affinity_st *context= (pool_affinity_st *)ctx;
+  memcached_st *last= NULL;
+  uint32_t same= 0;
+
+  for (size_t x= 0; x < context->rounds; x++)
+  {
+    struct timespec relative_time= { 5, 0 };
+    memcached_return_t rc;
+    memcached_st *mc= memcached_pool_fetch(context->pool, &relative_time, &rc);
+    if (mc == NULL)
+    {
+      __sync_fetch_and_add(&context->failures, 1);
+      continue;
+    }
+
+    if (mc == last)
+    {
+      same++;
+    }
+
+    // Work the way a request would, through the handle's own continuum
+    char key[32];
+    int key_length= snprintf(key, sizeof(key), "affinity:%u", uint32_t(x));
+    if (memcached_generate_hash(mc, key, size_t(key_length)) >= memcached_server_count(mc))
+    {
+      __sync_fetch_and_add(&context->failures, 1);
+    }
+
+    if (memcached_failed(memcached_pool_release(context->pool, mc)))
+    {
+      __sync_fetch_and_add(&context->failures, 1);
+    }
+    last= mc;
+  }
+
+  __sync_fetch_and_add(&context->same, same);
+
+  return NULL;
+}
+
+/*
+  Fetch and release throughput, cache misses and how often a thread gets
+  back the handle it used last, for a single stack pool and a sharded one
+  from 1 to 128 threads.
+*/
+#define SHARD_BENCHMARK_THREADS 128
+test_return_t connection_pool_shard_benchmark_TEST(memcached_st *memc)
+{
+  const uint32_t shards= 16;
+  const size_t operations= 256000;
+
+  for (uint32_t threads= 1; threads <= SHARD_BENCHMARK_THREADS; threads*= 2)
+  {
+    for (uint32_t sharded= 0; sharded < 2; sharded++)
+    {
+      pool_affinity_st context= { sharded ? memcached_pool_create_sharded(memc, 32, 32, shards) : memcached_pool_create(memc, 32, 32),
+                                  operations / threads, 0, 0 };
+      test_true(context.pool);
+
+      int counter= cache_miss_counter();
+      pthread_t pid[SHARD_BENCHMARK_THREADS];
+
+      Timer timer;
+      timer.reset();
+      for (size_t x= 0; x < threads; x++)
+      {
+        test_compare(0, pthread_create(&pid[x], NULL, affinity_thread, (void*)&context));
+      }
+
+      for (size_t x= 0; x < threads; x++)
+      {
+        test_compare(0, pthread_join(pid[x], NULL));
+      }
+      timer.sample();
+      int64_t misses= cache_misses(counter);
+      if (counter != -1)
+      {
+        close(counter);
+      }
+
+      test_zero(context.failures);
+
+      Out << threads << " threads " << (sharded ? "sharded: " : "single stack: ")
+        << (context.rounds * threads * 1000 / std::max(timer.elapsed_milliseconds(), uint64_t(1))) << " fetches/sec, "
+        << (context.same * 100 / (context.rounds * threads)) << "% same handle, "
+        << (misses == -1 ? int64_t(-1) : misses / int64_t(context.rounds * threads)) << " cache misses per fetch";
+
+      test_true(memcached_pool_destroy(context.pool) == memc);
+    }
+  }
+
+  return TEST_SUCCESS;
+}
+
+struct mux_context_st {
+  memcached_mux_st *mux;
+  uint32_t id;
+  uint32_t failures;
+};
+
+static void *mux_thread(void *ctx)
+{
+  mux_context_st *context= (mux_context_st *)ctx;
+
+  for (uint32_t x= 0; x < 200; x++)
+  {
+    char key[64];
+    char value[64];
+    int key_length= snprintf(key, sizeof(key), "mux:%u:%u", context->id, x);
+    int value_length= snprintf(value, sizeof(value), "value %u %u", context->id, x);
+
+    if (memcached_failed(memcached_mux_set(context->mux, key, size_t(key_length), value, size_t(value_length), 0, context->id)))
+    {
+      context->failures++;
+      continue;
+    }
+
+    size_t length;
+    uint32_t flags;
+    memcached_return_t rc;
+    char *fetched= memcached_mux_get(context->mux, key, size_t(key_length), &length, &flags, &rc);
+    if (memcached_failed(rc) or fetched == NULL or length != size_t(value_length) or
+        memcmp(fetched, value, length) or flags != context->id)
+    {
+      context->failures++;
+    }
+    free(fetched);
+
+    if (memcached_failed(memcached_mux_delete(context->mux, key, size_t(key_length))))
+    {
+      context->failures++;
+    }
+
+    if (memcached_mux_get(context->mux, key, size_t(key_length), NULL, NULL, &rc) or rc != MEMCACHED_NOTFOUND)
+    {
+      context->failures++;
+    }
+  }
+
+  return NULL;
+}
+
+/*
+  Many threads share one connection per server through the multiplexer,
+  and every thread gets its own answers back.
+*/
+test_return_t memcached_mux_TEST(memcached_st *memc)
+{
+  memcached_mux_st *mux= memcached_mux_create(memc, 1);
+  test_true(mux);
+
+  pthread_t pid[NUM_THREADS];
+  mux_context_st context[NUM_THREADS];
+  for (uint32_t x= 0; x < NUM_THREADS; x++)
+  {
+    context[x].mux= mux;
+    context[x].id= x;
+    context[x].failures= 0;
+    test_compare(0, pthread_create(&pid[x], NULL, mux_thread, (void*)&context[x]));
+  }
+
+  for (uint32_t x= 0; x < NUM_THREADS; x++)
+  {
+    test_compare(0, pthread_join(pid[x], NULL));
+    test_zero(context[x].failures);
+  }
+
+  // What went in through the multiplexer is there for everyone else
+  test_compare(MEMCACHED_SUCCESS, memcached_mux_set(mux, test_literal_param("mux:shared"), test_literal_param("shared"), 0, 7));
+  size_t length;
+  uint32_t flags;
+  memcached_return_t rc;
+  char *value= memcached_get(memc, test_literal_param("mux:shared"), &length, &flags, &rc);
+  test_compare(MEMCACHED_SUCCESS, rc);
+  test_compare(test_literal_param_size("shared"), length);
+  test_compare(7U, flags);
+  free(value);
+
+  memcached_mux_get(mux, NULL, 0, NULL, NULL, &rc);
+  test_compare(MEMCACHED_BAD_KEY_PROVIDED, rc);
+
+  test_true(memcached_mux_destroy(mux) == memc);
+
+  return TEST_SUCCESS;
+}
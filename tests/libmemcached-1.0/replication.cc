@@ -261,6 +261,68 @@ test_return_t replication_randomize_mget_test(memcached_st *memc)
   return TEST_SUCCESS;
 }
 
+static test_return_t replication_mget_behavior(memcached_st *memc,
+                                               const memcached_behavior_t flag,
+                                               const uint64_t data)
+{
+  memcached_result_st result_obj;
+  memcached_st *memc_clone= memcached_clone(NULL, memc);
+  test_true(memc_clone);
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_behavior_set(memc_clone, MEMCACHED_BEHAVIOR_NUMBER_OF_REPLICAS, 3));
+  test_compare(MEMCACHED_SUCCESS,
+               memcached_behavior_set(memc_clone, flag, data));
+  test_compare(data, memcached_behavior_get(memc_clone, flag));
+
+  const char *keys[]= { "key1", "key2", "key3", "key4", "key5", "key6", "key7" };
+  size_t len[]= { 4, 4, 4, 4, 4, 4, 4 };
+
+  for (size_t x= 0; x < test_array_length(keys); ++x)
+  {
+    test_compare(MEMCACHED_SUCCESS,
+                 memcached_set(memc, keys[x], len[x], "1", 1, 0, 0));
+  }
+
+  memcached_quit(memc);
+
+  // Enough rounds for every server to have a latency estimate
+  for (size_t round= 0; round < 32; ++round)
+  {
+    test_compare(MEMCACHED_SUCCESS,
+                 memcached_mget(memc_clone, keys, len, test_array_length(keys)));
+
+    memcached_result_st *results= memcached_result_create(memc_clone, &result_obj);
+    test_true(results);
+
+    size_t hits= 0;
+    memcached_return_t rc;
+    while ((results= memcached_fetch_result(memc_clone, &result_obj, &rc)) != NULL)
+    {
+      ++hits;
+    }
+    test_compare(test_array_length(keys), hits);
+    memcached_result_free(&result_obj);
+  }
+  memcached_free(memc_clone);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t replication_hedged_mget_test(memcached_st *memc)
+{
+  memcached_st *memc_clone= memcached_clone(NULL, memc);
+  test_compare(MEMCACHED_INVALID_ARGUMENTS,
+               memcached_behavior_set(memc_clone, MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE, 100));
+  memcached_free(memc_clone);
+
+  return replication_mget_behavior(memc, MEMCACHED_BEHAVIOR_HEDGED_READ_PERCENTILE, 50);
+}
+
+test_return_t replication_least_loaded_mget_test(memcached_st *memc)
+{
+  return replication_mget_behavior(memc, MEMCACHED_BEHAVIOR_REPLICA_READ_LEAST_LOADED, 1);
+}
+
 test_return_t replication_delete_test(memcached_st *memc_just_cloned)
 {
   memcached_flush(memc_just_cloned, 0);
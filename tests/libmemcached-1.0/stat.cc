@@ -100,3 +100,28 @@ test_return_t memcached_stat_TEST2(memcached_st *memc)
 
   return TEST_SUCCESS;
 }
+
+test_return_t memcached_stat_TEST3(memcached_st *memc)
+{
+  memcached_return_t rc;
+  memcached_stat_st *stats= memcached_stat(memc, NULL, &rc);
+  test_compare(MEMCACHED_SUCCESS, rc);
+  test_true(stats);
+
+  // Every server was asked at once, make sure each reply landed in its own slot
+  for (uint32_t x= 0; x < memcached_server_count(memc); x++)
+  {
+    ASSERT_TRUE(stats[x].pid > 0);
+    ASSERT_TRUE(stats[x].version[0]);
+    ASSERT_TRUE(stats[x].pointer_size);
+    ASSERT_TRUE(stats[x].threads);
+    ASSERT_TRUE(stats[x].curr_connections);
+  }
+  memcached_stat_free(NULL, stats);
+
+  stats= memcached_stat(memc, (char*)"BAD_ARG_VALUE", &rc);
+  test_compare(MEMCACHED_INVALID_ARGUMENTS, rc);
+  memcached_stat_free(NULL, stats);
+
+  return TEST_SUCCESS;
+}
@@ -38,3 +38,4 @@
 
 test_return_t memcached_stat_TEST(memcached_st *);
 test_return_t memcached_stat_TEST2(memcached_st *);
+test_return_t memcached_stat_TEST3(memcached_st *);
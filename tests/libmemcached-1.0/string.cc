@@ -43,6 +43,7 @@
 #include <libmemcached-1.0/memcached.h>
 
 #include "libmemcached/string.hpp"
+#include "libmemcached/slab.hpp"
 #include "libmemcached/is.h"
 
 #include <libtest/test.hpp>
@@ -190,3 +191,170 @@ test_return_t string_alloc_append_multiple(void*)
 
   return TEST_SUCCESS;
 }
+
+test_return_t string_alloc_slab(void*)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+
+  memcached_slab_stat_st stat;
+  test_compare(MEMCACHED_SUCCESS, memcached_slab_stat(memc, &stat));
+  test_zero(stat.pages);
+  test_compare(MEMCACHED_SUCCESS, memcached_behavior_set(memc, MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR, true));
+  test_compare(1, memcached_behavior_get(memc, MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR));
+
+  char buffer[1000];
+  memset(buffer, 'x', sizeof(buffer));
+  for (size_t x= 0; x < 64; x++)
+  {
+    memcached_result_st *result= memcached_result_create(memc, NULL);
+    test_true(result);
+    test_true(memcached_is_allocated(result));
+    for (size_t y= 0; y <= x; y++)
+    {
+      test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(result, buffer, sizeof(buffer)));
+    }
+    test_compare(sizeof(buffer) * (x +1), memcached_result_length(result));
+
+    // The value handed back is the caller's to free.
+    char *value= memcached_result_take_value(result);
+    test_true(value);
+    test_zero(memcmp(value, buffer, sizeof(buffer)));
+    free(value);
+    test_zero(memcached_result_length(result));
+    memcached_result_free(result);
+  }
+
+  test_compare(MEMCACHED_SUCCESS, memcached_slab_stat(memc, &stat));
+  test_true(stat.allocations > 0);
+  test_compare(stat.allocations, stat.frees);
+  test_zero(stat.in_use);
+  test_zero(stat.requested);
+  test_true(stat.high_water >= 64 * sizeof(buffer));
+  test_true(stat.reserved >= stat.high_water);
+  test_compare(1.0, stat.fragmentation);
+
+  // Freed blocks are reused without new pages.
+  uint64_t pages= 0;
+  for (size_t round= 0; round < 2; round++)
+  {
+    memcached_result_st *results[16];
+    for (size_t x= 0; x < 16; x++)
+    {
+      results[x]= memcached_result_create(memc, NULL);
+      test_true(results[x]);
+      test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(results[x], buffer, sizeof(buffer)));
+    }
+    test_compare(MEMCACHED_SUCCESS, memcached_slab_stat(memc, &stat));
+    test_true(stat.in_use > 0);
+    test_true(stat.fragmentation > 0 and stat.fragmentation < 1);
+    if (round)
+    {
+      test_compare(pages, stat.pages);
+    }
+    pages= stat.pages;
+    for (size_t x= 0; x < 16; x++)
+    {
+      memcached_result_free(results[x]);
+    }
+  }
+
+  // Values past the largest class go to the allocators.
+  memcached_string_st *string= memcached_string_create(memc, NULL, 0);
+  test_true(string);
+  for (size_t x= 0; x < 100; x++)
+  {
+    test_compare(MEMCACHED_SUCCESS, memcached_string_append(string, buffer, sizeof(buffer)));
+  }
+  memcached_string_free(string);
+  test_compare(MEMCACHED_SUCCESS, memcached_slab_stat(memc, &stat));
+  test_true(stat.large_allocations > 0);
+  test_zero(stat.in_use);
+
+  // Each size lands in the smallest power of two class that holds it.
+  const size_t sizes[][2]= { { 1, 32 }, { 32, 32 }, { 33, 64 }, { 64, 64 }, { 65, 128 },
+                             { 1000, 1024 }, { 1025, 2048 }, { MEMCACHED_SLAB_MAX_SIZE, MEMCACHED_SLAB_MAX_SIZE } };
+  for (size_t x= 0; x < sizeof(sizes) / sizeof(sizes[0]); x++)
+  {
+    void *block= memcached_slab_alloc(memc, sizes[x][0]);
+    test_true(block);
+    test_compare(MEMCACHED_SUCCESS, memcached_slab_stat(memc, &stat));
+    test_compare(sizes[x][1], stat.in_use);
+    memcached_slab_free(memc, block, sizes[x][0]);
+  }
+
+  // The handle's own result never holds slab memory, in_use is only what callers hold.
+  test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(&memc->result, buffer, sizeof(buffer)));
+  test_compare(MEMCACHED_SUCCESS, memcached_slab_stat(memc, &stat));
+  test_zero(stat.in_use);
+  memcached_result_reset(&memc->result);
+
+  // A clone gets a slab of its own.
+  memcached_st *clone= memcached_clone(NULL, memc);
+  test_true(clone);
+  test_compare(1, memcached_behavior_get(clone, MEMCACHED_BEHAVIOR_SLAB_ALLOCATOR));
+  test_compare(MEMCACHED_SUCCESS, memcached_slab_stat(clone, &stat));
+  test_zero(stat.pages);
+  memcached_free(clone);
+
+  test_compare(MEMCACHED_INVALID_ARGUMENTS, memcached_slab_stat(memc, NULL));
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
+
+test_return_t string_alloc_inline(void*)
+{
+  memcached_st *memc= memcached_create(NULL);
+  test_true(memc);
+
+  memcached_result_st *result= memcached_result_create(memc, NULL);
+  test_true(result);
+  const char *inline_value= (const char *)result +offsetof(memcached_result_st, item_value);
+
+  // The buffer was appended, every field that was there before keeps its offset.
+  test_true(offsetof(memcached_result_st, item_value) > offsetof(memcached_result_st, options));
+
+  // Small values live in the result.
+  test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(result, test_literal_param("counter")));
+  test_true(memcached_result_value(result) == inline_value);
+  char *value= memcached_result_take_value(result);
+  test_true(value);
+  test_true(value != inline_value);
+  test_compare(0, strcmp(value, "counter"));
+  free(value);
+  test_zero(memcached_result_length(result));
+  test_true(memcached_result_value(result) == inline_value);
+
+  // Larger ones move to the heap, keeping what was there.
+  char buffer[MEMCACHED_RESULT_INLINE_SIZE * 4];
+  memset(buffer, 'x', sizeof(buffer));
+  test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(result, buffer, MEMCACHED_RESULT_INLINE_SIZE / 2));
+  test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(result, buffer, sizeof(buffer)));
+  test_true(memcached_result_value(result) != inline_value);
+  test_compare(sizeof(buffer) + MEMCACHED_RESULT_INLINE_SIZE / 2, memcached_result_length(result));
+  test_zero(memcmp(memcached_result_value(result), buffer, MEMCACHED_RESULT_INLINE_SIZE / 2));
+  test_zero(memcmp(memcached_result_value(result) + MEMCACHED_RESULT_INLINE_SIZE / 2, buffer, sizeof(buffer)));
+
+  // A heap buffer is handed over and small values go back inline.
+  const char *heap_value= memcached_result_value(result);
+  value= memcached_result_take_value(result);
+  test_true(value == heap_value);
+  free(value);
+  test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(result, test_literal_param("token")));
+  test_true(memcached_result_value(result) == inline_value);
+
+  memcached_result_free(result);
+
+  // A result on the stack points at itself too.
+  memcached_result_st stack_result;
+  test_true(memcached_result_create(memc, &stack_result));
+  test_compare(MEMCACHED_SUCCESS, memcached_result_set_value(&stack_result, test_literal_param("token")));
+  test_true(memcached_result_value(&stack_result) == stack_result.item_value);
+  memcached_result_free(&stack_result);
+
+  memcached_free(memc);
+
+  return TEST_SUCCESS;
+}
@@ -150,3 +150,28 @@ test_return_t test_memcached_touch_by_key(memcached_st *memc)
 
 
 
+
+test_return_t test_memcached_touch_multi(memcached_st *memc)
+{
+  test_skip(TEST_SUCCESS, pre_touch(memc));
+
+  const char *keys[]= { "touch_multi_1", "touch_multi_2", "touch_multi_3" };
+  size_t key_length[]= { 13, 13, 13 };
+  memcached_return_t results[3];
+
+  test_compare(MEMCACHED_SUCCESS, 
+               memcached_set(memc, keys[0], key_length[0], test_literal_param("touchval"), 2, 0));
+  test_compare(MEMCACHED_SUCCESS, 
+               memcached_set(memc, keys[2], key_length[2], test_literal_param("touchval"), 2, 0));
+
+  memcached_return_t rc= memcached_touch_multi(memc, keys, key_length, 3, 60 *60, results);
+  ASSERT_EQ_(MEMCACHED_SOME_ERRORS, rc, "%s", memcached_last_error_message(memc));
+  test_compare(MEMCACHED_SUCCESS, results[0]);
+  test_compare(MEMCACHED_NOTFOUND, results[1]);
+  test_compare(MEMCACHED_SUCCESS, results[2]);
+
+  test_compare(MEMCACHED_SUCCESS, memcached_exist(memc, keys[0], key_length[0]));
+  test_compare(MEMCACHED_SUCCESS, memcached_exist(memc, keys[2], key_length[2]));
+
+  return TEST_SUCCESS;
+}
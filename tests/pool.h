@@ -42,3 +42,6 @@ test_return_t connection_pool_test(memcached_st *);
 test_return_t connection_pool2_test(memcached_st *);
 test_return_t connection_pool3_test(memcached_st *);
 test_return_t regression_bug_962815(memcached_st *);
+test_return_t connection_pool_contention_TEST(memcached_st *);
+test_return_t connection_pool_shard_benchmark_TEST(memcached_st *);
+test_return_t memcached_mux_TEST(memcached_st *);
@@ -51,4 +51,8 @@ test_return_t replication_randomize_mget_fail_test(memcached_st *memc);
 
 test_return_t replication_miss_test(memcached_st *memc);
 
+test_return_t replication_hedged_mget_test(memcached_st *memc);
+
+test_return_t replication_least_loaded_mget_test(memcached_st *memc);
+
 test_return_t check_replication_sanity_TEST(memcached_st*);
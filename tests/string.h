@@ -62,6 +62,12 @@ test_return_t string_alloc_append_toobig(void *);
 LIBTEST_LOCAL
 test_return_t string_alloc_append_multiple(void *);
 
+LIBTEST_LOCAL
+test_return_t string_alloc_slab(void *);
+
+LIBTEST_LOCAL
+test_return_t string_alloc_inline(void *);
+
 #ifdef	__cplusplus
 }
 #endif
@@ -219,17 +219,21 @@ extern int config_debug;
      CONSISTENT = 314,
      MODULA = 315,
      RANDOM = 316,
-     CSL_TRUE = 317,
-     CSL_FALSE = 318,
-     CSL_FLOAT = 319,
-     NUMBER = 320,
-     PORT = 321,
-     WEIGHT_START = 322,
-     IPADDRESS = 323,
-     HOSTNAME = 324,
-     STRING = 325,
-     QUOTED_STRING = 326,
-     FILE_PATH = 327
+     JUMP = 317,
+     RENDEZVOUS = 318,
+     RENDEZVOUS_SKELETON = 319,
+     MAGLEV = 320,
+     CSL_TRUE = 321,
+     CSL_FALSE = 322,
+     CSL_FLOAT = 323,
+     NUMBER = 324,
+     PORT = 325,
+     WEIGHT_START = 326,
+     IPADDRESS = 327,
+     HOSTNAME = 328,
+     STRING = 329,
+     QUOTED_STRING = 330,
+     FILE_PATH = 331
    };
 #endif
 
@@ -260,7 +264,7 @@ int config_parse ();
 /* Copy the second part of user declarations.  */
 
 /* Line 390 of yacc.c  */
-#line 264 "libmemcached/csl/parser.cc"
+#line 268 "libmemcached/csl/parser.cc"
 
 #ifdef short
 # undef short
@@ -478,22 +482,22 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  72
+#define YYFINAL  76
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   75
+#define YYLAST   79
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  76
+#define YYNTOKENS  80
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  12
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  68
+#define YYNRULES  72
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  86
+#define YYNSTATES  90
 
 /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   327
+#define YYMAXUTOK   331
 
 #define YYTRANSLATE(YYX)						\
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -504,10 +508,10 @@ static const yytype_uint8 yytranslate[] =
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,    75,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,    64,     2,     2,     2,     2,     2,
+       2,     2,    79,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    68,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    65,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    69,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -532,8 +536,9 @@ static const yytype_uint8 yytranslate[] =
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    66,
-      67,    68,    69,    70,    71,    72,    73,    74
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    70,    71,    72,    73,    74,    75,    76,
+      77,    78
 };
 
 #if YYDEBUG
@@ -547,40 +552,43 @@ static const yytype_uint8 yyprhs[] =
       81,    83,    85,    87,    89,    91,    93,    95,    97,    99,
      101,   103,   105,   107,   109,   111,   113,   115,   117,   119,
      121,   123,   124,   126,   127,   129,   131,   133,   135,   137,
-     139,   141,   143,   145,   147,   149,   151,   153,   155
+     139,   141,   143,   145,   147,   149,   151,   153,   155,   157,
+     159,   161,   163
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
 static const yytype_int8 yyrhs[] =
 {
-      77,     0,    -1,    78,    -1,    77,    75,    78,    -1,    79,
+      81,     0,    -1,    82,    -1,    81,    79,    82,    -1,    83,
       -1,     3,    -1,    10,    -1,     4,    -1,     5,    -1,     6,
-      -1,     7,    -1,     8,    75,    86,    -1,    11,    71,    83,
-      84,    -1,    11,    70,    83,    84,    -1,    12,    86,    84,
-      -1,     9,    86,    -1,    48,    67,    -1,    49,    67,    -1,
-      80,    -1,    47,    86,    -1,    46,    -1,    20,    87,    -1,
-      20,    87,    64,    85,    -1,    21,    85,    -1,    81,    67,
-      -1,    82,    -1,    40,    -1,    33,    -1,    19,    -1,    25,
+      -1,     7,    -1,     8,    79,    90,    -1,    11,    75,    87,
+      88,    -1,    11,    74,    87,    88,    -1,    12,    90,    88,
+      -1,     9,    90,    -1,    48,    71,    -1,    49,    71,    -1,
+      84,    -1,    47,    90,    -1,    46,    -1,    20,    91,    -1,
+      20,    91,    68,    89,    -1,    21,    89,    -1,    85,    71,
+      -1,    86,    -1,    40,    -1,    33,    -1,    19,    -1,    25,
       -1,    23,    -1,    24,    -1,    29,    -1,    30,    -1,    32,
       -1,    34,    -1,    35,    -1,    36,    -1,    37,    -1,    17,
       -1,    18,    -1,    22,    -1,    28,    -1,    31,    -1,    38,
       -1,    39,    -1,    45,    -1,    43,    -1,    44,    -1,    41,
-      -1,    42,    -1,    -1,    68,    -1,    -1,    69,    -1,    50,
+      -1,    42,    -1,    -1,    72,    -1,    -1,    73,    -1,    50,
       -1,    51,    -1,    52,    -1,    53,    -1,    54,    -1,    55,
-      -1,    56,    -1,    57,    -1,    58,    -1,    72,    -1,    73,
-      -1,    59,    -1,    60,    -1,    61,    -1
+      -1,    56,    -1,    57,    -1,    58,    -1,    76,    -1,    77,
+      -1,    59,    -1,    60,    -1,    61,    -1,    62,    -1,    63,
+      -1,    64,    -1,    65,    -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   203,   203,   204,   208,   210,   212,   214,   219,   224,
-     228,   232,   243,   253,   263,   272,   276,   280,   284,   288,
-     300,   304,   317,   330,   337,   344,   353,   359,   363,   367,
-     371,   375,   379,   383,   387,   391,   395,   399,   403,   410,
-     414,   418,   422,   426,   430,   434,   438,   442,   446,   450,
-     454,   461,   462,   467,   468,   473,   477,   481,   485,   489,
-     493,   497,   501,   505,   512,   516,   523,   527,   531
+       0,   207,   207,   208,   212,   214,   216,   218,   223,   228,
+     232,   236,   247,   257,   267,   276,   280,   284,   288,   292,
+     304,   308,   321,   334,   341,   348,   357,   363,   367,   371,
+     375,   379,   383,   387,   391,   395,   399,   403,   407,   414,
+     418,   422,   426,   430,   434,   438,   442,   446,   450,   454,
+     458,   465,   466,   471,   472,   477,   481,   485,   489,   493,
+     497,   501,   505,   509,   516,   520,   527,   531,   535,   539,
+     543,   547,   551
 };
 #endif
 
@@ -601,12 +609,13 @@ static const char *const yytname[] =
   "USER_DATA", "USE_UDP", "VERIFY_KEY", "_TCP_KEEPALIVE", "_TCP_KEEPIDLE",
   "_TCP_NODELAY", "FETCH_VERSION", "NAMESPACE", "POOL_MIN", "POOL_MAX",
   "MD5", "CRC", "FNV1_64", "FNV1A_64", "FNV1_32", "FNV1A_32", "HSIEH",
-  "MURMUR", "JENKINS", "CONSISTENT", "MODULA", "RANDOM", "CSL_TRUE",
-  "CSL_FALSE", "','", "'='", "CSL_FLOAT", "NUMBER", "PORT", "WEIGHT_START",
-  "IPADDRESS", "HOSTNAME", "STRING", "QUOTED_STRING", "FILE_PATH", "' '",
-  "$accept", "begin", "statement", "expression", "behaviors",
-  "behavior_number", "behavior_boolean", "optional_port",
-  "optional_weight", "hash", "string", "distribution", YY_NULL
+  "MURMUR", "JENKINS", "CONSISTENT", "MODULA", "RANDOM", "JUMP",
+  "RENDEZVOUS", "RENDEZVOUS_SKELETON", "MAGLEV", "CSL_TRUE", "CSL_FALSE",
+  "','", "'='", "CSL_FLOAT", "NUMBER", "PORT", "WEIGHT_START", "IPADDRESS",
+  "HOSTNAME", "STRING", "QUOTED_STRING", "FILE_PATH", "' '", "$accept",
+  "begin", "statement", "expression", "behaviors", "behavior_number",
+  "behavior_boolean", "optional_port", "optional_weight", "hash", "string",
+  "distribution", YY_NULL
 };
 #endif
 
@@ -621,21 +630,22 @@ static const yytype_uint16 yytoknum[] =
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
      305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,    44,    61,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,    32
+     315,   316,   317,   318,   319,   320,   321,   322,    44,    61,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,    32
 };
 # endif
 
 /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    76,    77,    77,    78,    78,    78,    78,    78,    78,
-      78,    78,    79,    79,    79,    79,    79,    79,    79,    80,
-      80,    80,    80,    80,    80,    80,    80,    81,    81,    81,
-      81,    81,    81,    81,    81,    81,    81,    81,    81,    82,
-      82,    82,    82,    82,    82,    82,    82,    82,    82,    82,
-      82,    83,    83,    84,    84,    85,    85,    85,    85,    85,
-      85,    85,    85,    85,    86,    86,    87,    87,    87
+       0,    80,    81,    81,    82,    82,    82,    82,    82,    82,
+      82,    82,    83,    83,    83,    83,    83,    83,    83,    84,
+      84,    84,    84,    84,    84,    84,    84,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    85,    85,    85,    86,
+      86,    86,    86,    86,    86,    86,    86,    86,    86,    86,
+      86,    87,    87,    88,    88,    89,    89,    89,    89,    89,
+      89,    89,    89,    89,    90,    90,    91,    91,    91,    91,
+      91,    91,    91
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
@@ -647,7 +657,8 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     0,     1,     0,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1
 };
 
 /* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
@@ -660,40 +671,40 @@ static const yytype_uint8 yydefact[] =
       42,    32,    33,    43,    34,    27,    35,    36,    37,    38,
       44,    45,    26,    49,    50,    47,    48,    46,    20,     0,
        0,     0,     0,     2,     4,    18,     0,    25,     0,    64,
-      65,    15,    51,    51,    53,    66,    67,    68,    21,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    23,    19,
-      16,    17,     1,     0,    24,    11,    52,    53,    53,    54,
-      14,     0,     3,    13,    12,    22
+      65,    15,    51,    51,    53,    66,    67,    68,    69,    70,
+      71,    72,    21,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    23,    19,    16,    17,     1,     0,    24,    11,
+      52,    53,    53,    54,    14,     0,     3,    13,    12,    22
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,    42,    43,    44,    45,    46,    47,    77,    80,    68,
-      51,    58
+      -1,    42,    43,    44,    45,    46,    47,    81,    84,    72,
+      51,    62
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -62
+#define YYPACT_NINF -66
 static const yytype_int8 yypact[] =
 {
-      -2,   -62,   -62,   -62,   -62,   -62,   -61,   -24,   -62,   -20,
-     -24,   -62,   -62,   -62,   -48,    13,   -62,   -62,   -62,   -62,
-     -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,
-     -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,   -24,
-     -42,   -15,     0,   -62,   -62,   -62,   -11,   -62,   -24,   -62,
-     -62,   -62,   -10,   -10,   -12,   -62,   -62,   -62,    -5,   -62,
-     -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,   -62,
-     -62,   -62,   -62,    -2,   -62,   -62,   -62,   -12,   -12,   -62,
-     -62,    13,   -62,   -62,   -62,   -62
+      -2,   -66,   -66,   -66,   -66,   -66,   -54,   -65,   -66,   -61,
+     -65,   -66,   -66,   -66,    -5,    13,   -66,   -66,   -66,   -66,
+     -66,   -66,   -66,   -66,   -66,   -66,   -66,   -66,   -66,   -66,
+     -66,   -66,   -66,   -66,   -66,   -66,   -66,   -66,   -66,   -65,
+     -21,   -20,     0,   -66,   -66,   -66,   -19,   -66,   -65,   -66,
+     -66,   -66,   -11,   -11,    -1,   -66,   -66,   -66,   -66,   -66,
+     -66,   -66,     5,   -66,   -66,   -66,   -66,   -66,   -66,   -66,
+     -66,   -66,   -66,   -66,   -66,   -66,   -66,    -2,   -66,   -66,
+     -66,    -1,    -1,   -66,   -66,    13,   -66,   -66,   -66,   -66
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-     -62,   -62,   -13,   -62,   -62,   -62,   -62,     8,   -23,    -9,
-      14,   -62
+     -66,   -66,    -3,   -66,   -66,   -66,   -66,    22,   -33,    -9,
+      14,   -66
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
@@ -702,18 +713,18 @@ static const yytype_int8 yypgoto[] =
 #define YYTABLE_NINF -1
 static const yytype_uint8 yytable[] =
 {
-      72,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-      10,    55,    56,    57,    48,    11,    12,    13,    14,    15,
-      16,    17,    18,    19,    54,    70,    20,    21,    22,    23,
+      76,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    49,    50,    52,    53,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    54,    48,    20,    21,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    49,    50,
-      52,    53,    71,    69,    83,    84,    74,    79,    76,    81,
-      82,    78,    75,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    85,     0,     0,    73
+      34,    35,    36,    37,    38,    39,    40,    41,    87,    88,
+      74,    75,    78,    73,    55,    56,    57,    58,    59,    60,
+      61,    80,    79,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    83,    85,    86,    82,    89,     0,     0,    77
 };
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-62)))
+  (!!((Yystate) == (-66)))
 
 #define yytable_value_is_error(Yytable_value) \
   YYID (0)
@@ -721,13 +732,13 @@ static const yytype_uint8 yytable[] =
 static const yytype_int8 yycheck[] =
 {
        0,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    59,    60,    61,    75,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    10,    67,    28,    29,    30,    31,
+      12,    76,    77,    74,    75,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    10,    79,    28,    29,    30,    31,
       32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    72,    73,
-      70,    71,    67,    39,    77,    78,    67,    69,    68,    64,
-      73,    53,    48,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    81,    -1,    -1,    75
+      42,    43,    44,    45,    46,    47,    48,    49,    81,    82,
+      71,    71,    71,    39,    59,    60,    61,    62,    63,    64,
+      65,    72,    48,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    73,    68,    77,    53,    85,    -1,    -1,    79
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -738,11 +749,11 @@ static const yytype_uint8 yystos[] =
       12,    17,    18,    19,    20,    21,    22,    23,    24,    25,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    77,    78,    79,    80,    81,    82,    75,    72,
-      73,    86,    70,    71,    86,    59,    60,    61,    87,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    85,    86,
-      67,    67,     0,    75,    67,    86,    68,    83,    83,    69,
-      84,    64,    78,    84,    84,    85
+      48,    49,    81,    82,    83,    84,    85,    86,    79,    76,
+      77,    90,    74,    75,    90,    59,    60,    61,    62,    63,
+      64,    65,    91,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    89,    90,    71,    71,     0,    79,    71,    90,
+      72,    87,    87,    73,    88,    68,    82,    88,    88,    89
 };
 
 #define yyerrok		(yyerrstatus = 0)
@@ -1570,25 +1581,25 @@ yyreduce:
     {
         case 4:
 /* Line 1792 of yacc.c  */
-#line 209 "libmemcached/csl/parser.yy"
+#line 213 "libmemcached/csl/parser.yy"
     { }
     break;
 
   case 5:
 /* Line 1792 of yacc.c  */
-#line 211 "libmemcached/csl/parser.yy"
+#line 215 "libmemcached/csl/parser.yy"
     { }
     break;
 
   case 6:
 /* Line 1792 of yacc.c  */
-#line 213 "libmemcached/csl/parser.yy"
+#line 217 "libmemcached/csl/parser.yy"
     { }
     break;
 
   case 7:
 /* Line 1792 of yacc.c  */
-#line 215 "libmemcached/csl/parser.yy"
+#line 219 "libmemcached/csl/parser.yy"
     {
             context->set_end();
             YYACCEPT;
@@ -1597,7 +1608,7 @@ yyreduce:
 
   case 8:
 /* Line 1792 of yacc.c  */
-#line 220 "libmemcached/csl/parser.yy"
+#line 224 "libmemcached/csl/parser.yy"
     {
             context->rc= MEMCACHED_PARSE_USER_ERROR;
             parser_abort(context, "ERROR called directly");
@@ -1606,7 +1617,7 @@ yyreduce:
 
   case 9:
 /* Line 1792 of yacc.c  */
-#line 225 "libmemcached/csl/parser.yy"
+#line 229 "libmemcached/csl/parser.yy"
     {
             memcached_reset(context->memc);
           }
@@ -1614,7 +1625,7 @@ yyreduce:
 
   case 10:
 /* Line 1792 of yacc.c  */
-#line 229 "libmemcached/csl/parser.yy"
+#line 233 "libmemcached/csl/parser.yy"
     {
             yydebug= 1;
           }
@@ -1622,7 +1633,7 @@ yyreduce:
 
   case 11:
 /* Line 1792 of yacc.c  */
-#line 233 "libmemcached/csl/parser.yy"
+#line 237 "libmemcached/csl/parser.yy"
     {
             if ((context->rc= memcached_parse_configure_file(*context->memc, (yyvsp[(3) - (3)].string).c_str, (yyvsp[(3) - (3)].string).size)) != MEMCACHED_SUCCESS)
             {
@@ -1633,7 +1644,7 @@ yyreduce:
 
   case 12:
 /* Line 1792 of yacc.c  */
-#line 244 "libmemcached/csl/parser.yy"
+#line 248 "libmemcached/csl/parser.yy"
     {
             if (memcached_failed(context->rc= memcached_server_add_with_weight(context->memc, (yyvsp[(2) - (4)].server).c_str, (yyvsp[(3) - (4)].number), uint32_t((yyvsp[(4) - (4)].number)))))
             {
@@ -1647,7 +1658,7 @@ yyreduce:
 
   case 13:
 /* Line 1792 of yacc.c  */
-#line 254 "libmemcached/csl/parser.yy"
+#line 258 "libmemcached/csl/parser.yy"
     {
             if (memcached_failed(context->rc= memcached_server_add_with_weight(context->memc, (yyvsp[(2) - (4)].server).c_str, (yyvsp[(3) - (4)].number), uint32_t((yyvsp[(4) - (4)].number)))))
             {
@@ -1661,7 +1672,7 @@ yyreduce:
 
   case 14:
 /* Line 1792 of yacc.c  */
-#line 264 "libmemcached/csl/parser.yy"
+#line 268 "libmemcached/csl/parser.yy"
     {
             if (memcached_failed(context->rc= memcached_server_add_unix_socket_with_weight(context->memc, (yyvsp[(2) - (3)].string).c_str, uint32_t((yyvsp[(3) - (3)].number)))))
             {
@@ -1674,7 +1685,7 @@ yyreduce:
 
   case 15:
 /* Line 1792 of yacc.c  */
-#line 273 "libmemcached/csl/parser.yy"
+#line 277 "libmemcached/csl/parser.yy"
     {
             memcached_set_configuration_file(context->memc, (yyvsp[(2) - (2)].string).c_str, (yyvsp[(2) - (2)].string).size);
           }
@@ -1682,7 +1693,7 @@ yyreduce:
 
   case 16:
 /* Line 1792 of yacc.c  */
-#line 277 "libmemcached/csl/parser.yy"
+#line 281 "libmemcached/csl/parser.yy"
     {
             context->memc->configure.initial_pool_size= uint32_t((yyvsp[(2) - (2)].number));
           }
@@ -1690,7 +1701,7 @@ yyreduce:
 
   case 17:
 /* Line 1792 of yacc.c  */
-#line 281 "libmemcached/csl/parser.yy"
+#line 285 "libmemcached/csl/parser.yy"
     {
             context->memc->configure.max_pool_size= uint32_t((yyvsp[(2) - (2)].number));
           }
@@ -1698,7 +1709,7 @@ yyreduce:
 
   case 19:
 /* Line 1792 of yacc.c  */
-#line 289 "libmemcached/csl/parser.yy"
+#line 293 "libmemcached/csl/parser.yy"
     {
             if (memcached_callback_get(context->memc, MEMCACHED_CALLBACK_PREFIX_KEY, NULL))
             {
@@ -1714,7 +1725,7 @@ yyreduce:
 
   case 20:
 /* Line 1792 of yacc.c  */
-#line 301 "libmemcached/csl/parser.yy"
+#line 305 "libmemcached/csl/parser.yy"
     {
             memcached_flag(*context->memc, MEMCACHED_FLAG_IS_FETCHING_VERSION, true);
           }
@@ -1722,7 +1733,7 @@ yyreduce:
 
   case 21:
 /* Line 1792 of yacc.c  */
-#line 305 "libmemcached/csl/parser.yy"
+#line 309 "libmemcached/csl/parser.yy"
     {
             // Check to see if DISTRIBUTION has already been set
             if ((context->rc= memcached_behavior_set(context->memc, MEMCACHED_BEHAVIOR_DISTRIBUTION, (yyvsp[(2) - (2)].distribution))) != MEMCACHED_SUCCESS)
@@ -1739,7 +1750,7 @@ yyreduce:
 
   case 22:
 /* Line 1792 of yacc.c  */
-#line 318 "libmemcached/csl/parser.yy"
+#line 322 "libmemcached/csl/parser.yy"
     {
             // Check to see if DISTRIBUTION has already been set
             if ((context->rc= memcached_behavior_set(context->memc, MEMCACHED_BEHAVIOR_DISTRIBUTION, (yyvsp[(2) - (4)].distribution))) != MEMCACHED_SUCCESS)
@@ -1756,7 +1767,7 @@ yyreduce:
 
   case 23:
 /* Line 1792 of yacc.c  */
-#line 331 "libmemcached/csl/parser.yy"
+#line 335 "libmemcached/csl/parser.yy"
     {
             if (context->set_hash((yyvsp[(2) - (2)].hash)) == false)
             {
@@ -1767,7 +1778,7 @@ yyreduce:
 
   case 24:
 /* Line 1792 of yacc.c  */
-#line 338 "libmemcached/csl/parser.yy"
+#line 342 "libmemcached/csl/parser.yy"
     {
             if ((context->rc= memcached_behavior_set(context->memc, (yyvsp[(1) - (2)].behavior), (yyvsp[(2) - (2)].number))) != MEMCACHED_SUCCESS)
             {
@@ -1778,7 +1789,7 @@ yyreduce:
 
   case 25:
 /* Line 1792 of yacc.c  */
-#line 345 "libmemcached/csl/parser.yy"
+#line 349 "libmemcached/csl/parser.yy"
     {
             if ((context->rc= memcached_behavior_set(context->memc, (yyvsp[(1) - (1)].behavior), true)) != MEMCACHED_SUCCESS)
             {
@@ -1791,14 +1802,14 @@ yyreduce:
 
   case 26:
 /* Line 1792 of yacc.c  */
-#line 354 "libmemcached/csl/parser.yy"
+#line 358 "libmemcached/csl/parser.yy"
     {
           }
     break;
 
   case 27:
 /* Line 1792 of yacc.c  */
-#line 360 "libmemcached/csl/parser.yy"
+#line 364 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_REMOVE_FAILED_SERVERS;
           }
@@ -1806,7 +1817,7 @@ yyreduce:
 
   case 28:
 /* Line 1792 of yacc.c  */
-#line 364 "libmemcached/csl/parser.yy"
+#line 368 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_CONNECT_TIMEOUT;
           }
@@ -1814,7 +1825,7 @@ yyreduce:
 
   case 29:
 /* Line 1792 of yacc.c  */
-#line 368 "libmemcached/csl/parser.yy"
+#line 372 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_IO_MSG_WATERMARK;
           }
@@ -1822,7 +1833,7 @@ yyreduce:
 
   case 30:
 /* Line 1792 of yacc.c  */
-#line 372 "libmemcached/csl/parser.yy"
+#line 376 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_IO_BYTES_WATERMARK;
           }
@@ -1830,7 +1841,7 @@ yyreduce:
 
   case 31:
 /* Line 1792 of yacc.c  */
-#line 376 "libmemcached/csl/parser.yy"
+#line 380 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_IO_KEY_PREFETCH;
           }
@@ -1838,7 +1849,7 @@ yyreduce:
 
   case 32:
 /* Line 1792 of yacc.c  */
-#line 380 "libmemcached/csl/parser.yy"
+#line 384 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_NUMBER_OF_REPLICAS;
           }
@@ -1846,7 +1857,7 @@ yyreduce:
 
   case 33:
 /* Line 1792 of yacc.c  */
-#line 384 "libmemcached/csl/parser.yy"
+#line 388 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_POLL_TIMEOUT;
           }
@@ -1854,7 +1865,7 @@ yyreduce:
 
   case 34:
 /* Line 1792 of yacc.c  */
-#line 388 "libmemcached/csl/parser.yy"
+#line 392 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_RCV_TIMEOUT;
           }
@@ -1862,7 +1873,7 @@ yyreduce:
 
   case 35:
 /* Line 1792 of yacc.c  */
-#line 392 "libmemcached/csl/parser.yy"
+#line 396 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_RETRY_TIMEOUT;
           }
@@ -1870,7 +1881,7 @@ yyreduce:
 
   case 36:
 /* Line 1792 of yacc.c  */
-#line 396 "libmemcached/csl/parser.yy"
+#line 400 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_SND_TIMEOUT;
           }
@@ -1878,7 +1889,7 @@ yyreduce:
 
   case 37:
 /* Line 1792 of yacc.c  */
-#line 400 "libmemcached/csl/parser.yy"
+#line 404 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_SOCKET_RECV_SIZE;
           }
@@ -1886,7 +1897,7 @@ yyreduce:
 
   case 38:
 /* Line 1792 of yacc.c  */
-#line 404 "libmemcached/csl/parser.yy"
+#line 408 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_SOCKET_SEND_SIZE;
           }
@@ -1894,7 +1905,7 @@ yyreduce:
 
   case 39:
 /* Line 1792 of yacc.c  */
-#line 411 "libmemcached/csl/parser.yy"
+#line 415 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_BINARY_PROTOCOL;
           }
@@ -1902,7 +1913,7 @@ yyreduce:
 
   case 40:
 /* Line 1792 of yacc.c  */
-#line 415 "libmemcached/csl/parser.yy"
+#line 419 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_BUFFER_REQUESTS;
           }
@@ -1910,7 +1921,7 @@ yyreduce:
 
   case 41:
 /* Line 1792 of yacc.c  */
-#line 419 "libmemcached/csl/parser.yy"
+#line 423 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_HASH_WITH_PREFIX_KEY;
           }
@@ -1918,7 +1929,7 @@ yyreduce:
 
   case 42:
 /* Line 1792 of yacc.c  */
-#line 423 "libmemcached/csl/parser.yy"
+#line 427 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_NOREPLY;
           }
@@ -1926,7 +1937,7 @@ yyreduce:
 
   case 43:
 /* Line 1792 of yacc.c  */
-#line 427 "libmemcached/csl/parser.yy"
+#line 431 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_RANDOMIZE_REPLICA_READ;
           }
@@ -1934,7 +1945,7 @@ yyreduce:
 
   case 44:
 /* Line 1792 of yacc.c  */
-#line 431 "libmemcached/csl/parser.yy"
+#line 435 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_SORT_HOSTS;
           }
@@ -1942,7 +1953,7 @@ yyreduce:
 
   case 45:
 /* Line 1792 of yacc.c  */
-#line 435 "libmemcached/csl/parser.yy"
+#line 439 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_SUPPORT_CAS;
           }
@@ -1950,7 +1961,7 @@ yyreduce:
 
   case 46:
 /* Line 1792 of yacc.c  */
-#line 439 "libmemcached/csl/parser.yy"
+#line 443 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_TCP_NODELAY;
           }
@@ -1958,7 +1969,7 @@ yyreduce:
 
   case 47:
 /* Line 1792 of yacc.c  */
-#line 443 "libmemcached/csl/parser.yy"
+#line 447 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_TCP_KEEPALIVE;
           }
@@ -1966,7 +1977,7 @@ yyreduce:
 
   case 48:
 /* Line 1792 of yacc.c  */
-#line 447 "libmemcached/csl/parser.yy"
+#line 451 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_TCP_KEEPIDLE;
           }
@@ -1974,7 +1985,7 @@ yyreduce:
 
   case 49:
 /* Line 1792 of yacc.c  */
-#line 451 "libmemcached/csl/parser.yy"
+#line 455 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_USE_UDP;
           }
@@ -1982,7 +1993,7 @@ yyreduce:
 
   case 50:
 /* Line 1792 of yacc.c  */
-#line 455 "libmemcached/csl/parser.yy"
+#line 459 "libmemcached/csl/parser.yy"
     {
             (yyval.behavior)= MEMCACHED_BEHAVIOR_VERIFY_KEY;
           }
@@ -1990,31 +2001,31 @@ yyreduce:
 
   case 51:
 /* Line 1792 of yacc.c  */
-#line 461 "libmemcached/csl/parser.yy"
+#line 465 "libmemcached/csl/parser.yy"
     { (yyval.number)= MEMCACHED_DEFAULT_PORT;}
     break;
 
   case 52:
 /* Line 1792 of yacc.c  */
-#line 463 "libmemcached/csl/parser.yy"
+#line 467 "libmemcached/csl/parser.yy"
     { }
     break;
 
   case 53:
 /* Line 1792 of yacc.c  */
-#line 467 "libmemcached/csl/parser.yy"
+#line 471 "libmemcached/csl/parser.yy"
     { (yyval.number)= 1; }
     break;
 
   case 54:
 /* Line 1792 of yacc.c  */
-#line 469 "libmemcached/csl/parser.yy"
+#line 473 "libmemcached/csl/parser.yy"
     { }
     break;
 
   case 55:
 /* Line 1792 of yacc.c  */
-#line 474 "libmemcached/csl/parser.yy"
+#line 478 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_MD5;
           }
@@ -2022,7 +2033,7 @@ yyreduce:
 
   case 56:
 /* Line 1792 of yacc.c  */
-#line 478 "libmemcached/csl/parser.yy"
+#line 482 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_CRC;
           }
@@ -2030,7 +2041,7 @@ yyreduce:
 
   case 57:
 /* Line 1792 of yacc.c  */
-#line 482 "libmemcached/csl/parser.yy"
+#line 486 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_FNV1_64;
           }
@@ -2038,7 +2049,7 @@ yyreduce:
 
   case 58:
 /* Line 1792 of yacc.c  */
-#line 486 "libmemcached/csl/parser.yy"
+#line 490 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_FNV1A_64;
           }
@@ -2046,7 +2057,7 @@ yyreduce:
 
   case 59:
 /* Line 1792 of yacc.c  */
-#line 490 "libmemcached/csl/parser.yy"
+#line 494 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_FNV1_32;
           }
@@ -2054,7 +2065,7 @@ yyreduce:
 
   case 60:
 /* Line 1792 of yacc.c  */
-#line 494 "libmemcached/csl/parser.yy"
+#line 498 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_FNV1A_32;
           }
@@ -2062,7 +2073,7 @@ yyreduce:
 
   case 61:
 /* Line 1792 of yacc.c  */
-#line 498 "libmemcached/csl/parser.yy"
+#line 502 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_HSIEH;
           }
@@ -2070,7 +2081,7 @@ yyreduce:
 
   case 62:
 /* Line 1792 of yacc.c  */
-#line 502 "libmemcached/csl/parser.yy"
+#line 506 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_MURMUR;
           }
@@ -2078,7 +2089,7 @@ yyreduce:
 
   case 63:
 /* Line 1792 of yacc.c  */
-#line 506 "libmemcached/csl/parser.yy"
+#line 510 "libmemcached/csl/parser.yy"
     {
             (yyval.hash)= MEMCACHED_HASH_JENKINS;
           }
@@ -2086,7 +2097,7 @@ yyreduce:
 
   case 64:
 /* Line 1792 of yacc.c  */
-#line 513 "libmemcached/csl/parser.yy"
+#line 517 "libmemcached/csl/parser.yy"
     {
             (yyval.string)= (yyvsp[(1) - (1)].string);
           }
@@ -2094,7 +2105,7 @@ yyreduce:
 
   case 65:
 /* Line 1792 of yacc.c  */
-#line 517 "libmemcached/csl/parser.yy"
+#line 521 "libmemcached/csl/parser.yy"
     {
             (yyval.string)= (yyvsp[(1) - (1)].string);
           }
@@ -2102,7 +2113,7 @@ yyreduce:
 
   case 66:
 /* Line 1792 of yacc.c  */
-#line 524 "libmemcached/csl/parser.yy"
+#line 528 "libmemcached/csl/parser.yy"
     {
             (yyval.distribution)= MEMCACHED_DISTRIBUTION_CONSISTENT;
           }
@@ -2110,7 +2121,7 @@ yyreduce:
 
   case 67:
 /* Line 1792 of yacc.c  */
-#line 528 "libmemcached/csl/parser.yy"
+#line 532 "libmemcached/csl/parser.yy"
     {
             (yyval.distribution)= MEMCACHED_DISTRIBUTION_MODULA;
           }
@@ -2118,15 +2129,47 @@ yyreduce:
 
   case 68:
 /* Line 1792 of yacc.c  */
-#line 532 "libmemcached/csl/parser.yy"
+#line 536 "libmemcached/csl/parser.yy"
     {
             (yyval.distribution)= MEMCACHED_DISTRIBUTION_RANDOM;
           }
     break;
 
+  case 69:
+/* Line 1792 of yacc.c  */
+#line 540 "libmemcached/csl/parser.yy"
+    {
+            (yyval.distribution)= MEMCACHED_DISTRIBUTION_CONSISTENT_JUMP;
+          }
+    break;
+
+  case 70:
+/* Line 1792 of yacc.c  */
+#line 544 "libmemcached/csl/parser.yy"
+    {
+            (yyval.distribution)= MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS;
+          }
+    break;
+
+  case 71:
+/* Line 1792 of yacc.c  */
+#line 548 "libmemcached/csl/parser.yy"
+    {
+            (yyval.distribution)= MEMCACHED_DISTRIBUTION_CONSISTENT_RENDEZVOUS_SKELETON;
+          }
+    break;
+
+  case 72:
+/* Line 1792 of yacc.c  */
+#line 552 "libmemcached/csl/parser.yy"
+    {
+            (yyval.distribution)= MEMCACHED_DISTRIBUTION_CONSISTENT_MAGLEV;
+          }
+    break;
+
 
 /* Line 1792 of yacc.c  */
-#line 2130 "libmemcached/csl/parser.cc"
+#line 2173 "libmemcached/csl/parser.cc"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2358,7 +2401,7 @@ yyreturn:
 
 
 /* Line 2055 of yacc.c  */
-#line 537 "libmemcached/csl/parser.yy"
+#line 557 "libmemcached/csl/parser.yy"
  
 
 void Context::start() 
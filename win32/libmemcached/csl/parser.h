@@ -105,17 +105,21 @@ extern int config_debug;
      CONSISTENT = 314,
      MODULA = 315,
      RANDOM = 316,
-     CSL_TRUE = 317,
-     CSL_FALSE = 318,
-     CSL_FLOAT = 319,
-     NUMBER = 320,
-     PORT = 321,
-     WEIGHT_START = 322,
-     IPADDRESS = 323,
-     HOSTNAME = 324,
-     STRING = 325,
-     QUOTED_STRING = 326,
-     FILE_PATH = 327
+     JUMP = 317,
+     RENDEZVOUS = 318,
+     RENDEZVOUS_SKELETON = 319,
+     MAGLEV = 320,
+     CSL_TRUE = 321,
+     CSL_FALSE = 322,
+     CSL_FLOAT = 323,
+     NUMBER = 324,
+     PORT = 325,
+     WEIGHT_START = 326,
+     IPADDRESS = 327,
+     HOSTNAME = 328,
+     STRING = 329,
+     QUOTED_STRING = 330,
+     FILE_PATH = 331
    };
 #endif
 
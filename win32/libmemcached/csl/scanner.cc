@@ -378,8 +378,8 @@ static void yy_fatal_error (yyconst char msg[] ,yyscan_t yyscanner );
 	*yy_cp = '\0'; \
 	yyg->yy_c_buf_p = yy_cp;
 
-#define YY_NUM_RULES 66
-#define YY_END_OF_BUFFER 67
+#define YY_NUM_RULES 70
+#define YY_END_OF_BUFFER 71
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -387,67 +387,70 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[538] =
+static yyconst flex_int16_t yy_accept[566] =
     {   0,
-        0,    0,   67,   65,    5,    5,    1,   65,   65,   65,
-        2,   65,   65,   65,   65,   65,   65,   65,   65,   65,
-       65,   65,   65,   65,   65,   65,    0,   64,    0,   49,
-        0,    0,    0,    2,    3,    0,    0,    0,    0,    0,
+        0,    0,   71,   69,    5,    5,    1,   69,    1,   69,
+       69,    2,   69,    1,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,    0,   68,
+        0,   49,    0,    0,    0,    2,    3,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    6,   49,   49,   49,   49,   49,
-       49,   49,   49,   49,   49,   49,   49,   49,   49,    4,
-       63,   63,    2,    3,   63,   54,   63,   63,   45,   63,
-       63,   63,   63,   63,   64,    0,   63,   53,   63,   63,
-       63,   63,   63,   63,   49,   49,   49,   49,   49,   49,
+        0,    0,    0,    0,    0,    0,    0,    0,    6,    0,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,    4,   67,   67,    2,    3,   67,
+       58,   67,   67,   45,   67,   67,   67,   67,   67,   67,
+       68,    0,   67,   67,   57,   67,   67,   67,   67,   67,
 
+       67,   67,   49,   49,   49,   49,   49,   49,   49,   49,
        49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
-       49,   49,   49,   49,   49,    4,    0,   63,    2,    3,
-       63,    0,   63,   63,   63,   63,   63,   63,   63,   63,
-       63,   63,   63,   47,   49,   49,   49,   49,   49,   49,
-        0,   49,   49,   49,   49,   49,   49,   49,   49,   49,
-       49,   49,   49,   49,   49,   49,   49,   49,    4,   63,
-       63,    3,   63,   63,   43,   48,   63,    0,   59,   63,
-       63,   63,   63,   63,   42,   63,   49,   49,   49,   49,
-       49,   49,   49,    0,    0,    0,   49,   49,   49,   49,
-       49,   49,    0,   49,   49,   49,    0,   49,   49,   49,
-
-        0,    0,   49,   49,    4,    0,   63,    3,   63,   63,
-        0,   63,   63,   63,   63,   51,   60,   52,   63,   49,
-       49,   49,   49,   49,   49,    0,   15,    0,    0,    0,
-       49,   49,   49,    0,    0,   49,    0,   49,   49,   49,
-        0,   49,    0,   49,    0,    0,    0,    0,   49,    4,
-       62,   63,   63,   63,   63,   63,   57,   55,   41,   61,
-       44,   49,   49,   49,   49,   49,    0,    0,    0,    0,
-        0,   49,   49,   49,    0,    0,   49,    0,   49,    0,
-       49,    0,   49,    0,   49,    0,    0,    0,    0,   49,
-       62,   63,   63,   58,   56,    0,    0,   49,   49,   49,
-
-        0,    0,    0,    0,    0,   49,   19,    0,    0,    0,
-        0,   49,    0,    0,    0,    7,    0,    0,    8,    0,
-       49,    0,    0,   34,    0,    0,   62,   63,   46,    0,
-        0,   49,    0,   49,    0,    0,    0,    0,    0,   49,
-        0,    0,    0,    0,   49,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   50,    0,    0,
-       49,    0,   49,    0,    0,    0,    0,    0,   49,    0,
-        0,   38,   37,   49,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   35,    0,    0,    0,    0,
+       49,   49,   49,    4,    0,   67,    2,    3,   67,    0,
+       67,   67,   67,   67,   67,   67,   53,   67,   67,   67,
+       67,   67,   67,   67,   47,   49,   49,   49,   49,   49,
+       49,    0,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,    4,
+       67,   67,    3,   67,   67,   43,   48,   67,    0,   63,
+       67,   67,   67,   67,   67,   67,   67,   42,   67,   49,
+       49,   49,   49,   49,   49,   49,    0,    0,    0,   49,
+
+       49,   49,   49,   49,   49,    0,   49,   49,   49,    0,
+       49,   49,   49,    0,    0,   49,   49,    4,    0,   67,
+        3,   67,   67,    0,   67,   67,   67,   67,   56,   51,
+       64,   52,   67,   67,   49,   49,   49,   49,   49,   49,
+        0,   15,    0,    0,    0,   49,   49,   49,    0,    0,
+       49,    0,   49,   49,   49,    0,   49,    0,   49,    0,
+        0,    0,    0,   49,    4,   66,   67,   67,   67,   67,
+       67,   61,   59,   41,   65,   67,   44,   49,   49,   49,
+       49,   49,    0,    0,    0,    0,    0,   49,   49,   49,
+        0,    0,   49,    0,   49,    0,   49,    0,   49,    0,
+
+       49,    0,    0,    0,    0,   49,   66,   67,   67,   62,
+       60,   67,    0,    0,   49,   49,   49,    0,    0,    0,
+        0,    0,   49,   19,    0,    0,    0,    0,   49,    0,
+        0,    0,    7,    0,    0,    8,    0,   49,    0,    0,
+       34,    0,    0,   66,   67,   46,   67,    0,    0,   49,
+        0,   49,    0,    0,    0,    0,    0,   49,    0,    0,
+        0,    0,   49,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   50,   54,    0,    0,   49,
+        0,   49,    0,    0,    0,    0,    0,   49,    0,    0,
+       38,   37,   49,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,   35,    0,    0,    0,    0,    0,
         0,   49,    0,    0,    0,    0,    0,   39,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,   29,    0,    0,
-        0,    0,   36,    0,    0,    0,    0,   49,    0,    0,
+        0,    0,   36,   67,    0,    0,    0,    0,   49,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   30,    0,    0,   33,    0,    0,    0,    0,
-       49,    0,    0,    0,    0,    0,    0,    0,    0,   23,
-        0,    0,   26,    0,    0,    0,   32,    0,    0,    0,
-        0,   13,   40,    0,    0,    0,    0,    0,   21,    0,
-        0,    0,    0,    0,   31,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   25,    0,    0,    9,
-       10,   11,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,   12,    0,    0,   17,    0,    0,    0,    0,
-        0,    0,    0,    0,   18,    0,    0,    0,   27,   28,
-        0,    0,    0,    0,    0,   14,   16,   20,    0,    0,
-        0,    0,    0,    0,   22,   24,    0
+        0,    0,    0,   30,    0,    0,   33,   67,    0,    0,
+        0,    0,   49,    0,    0,    0,    0,    0,    0,    0,
+        0,   23,    0,    0,   26,    0,    0,    0,   32,   67,
+        0,    0,    0,    0,   13,   40,    0,    0,    0,    0,
+        0,   21,    0,    0,    0,    0,    0,   31,   67,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       25,    0,    0,   67,    9,   10,   11,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   67,   12,    0,
+        0,   17,    0,    0,    0,    0,    0,    0,   67,    0,
+        0,   18,    0,    0,    0,   27,   28,   55,    0,    0,
+        0,    0,    0,   14,   16,   20,    0,    0,    0,    0,
+        0,    0,   22,   24,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -461,11 +464,11 @@ static yyconst flex_int32_t yy_ec[256] =
        19,    1,   20,    1,   21,   22,   23,   24,   25,   26,
        27,   28,   29,   30,   31,   32,   33,   34,   35,   36,
        37,   38,   39,   40,   41,   42,   43,   44,   45,   46,
-        1,   47,    1,    1,   48,    1,   49,   50,   51,   52,
+        1,   47,    1,    1,   48,    1,   21,   22,   23,   24,
 
-       53,   54,   55,   56,   57,   58,   59,   60,   61,   62,
-       63,   64,   65,   66,   67,   68,   69,   70,   71,   72,
-       73,   74,    1,    1,    1,    1,    1,    1,    1,    1,
+       25,   26,   27,   28,   29,   30,   31,   32,   33,   34,
+       35,   36,   37,   38,   39,   40,   41,   42,   43,   44,
+       45,   46,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -482,556 +485,609 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[75] =
+static yyconst flex_int32_t yy_meta[49] =
     {   0,
-        1,    1,    1,    1,    2,    1,    1,    2,    2,    1,
-        2,    2,    2,    2,    2,    2,    2,    1,    1,    1,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    1,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[543] =
+static yyconst flex_int16_t yy_base[566] =
     {   0,
-        0,  615,  615, 1763, 1763, 1763, 1763,   70,  603,  579,
-       67,   74,    0,   57,   52,   59,   73,   58,   64,   74,
-      585,   77,   79,   77,   65,  581,  101, 1763,  579,  138,
-      202,  215,  217,  230,  237,  250,  252,  259,  261,  268,
-      281,  288,  296,  309,  318,  380,  326,  354,  356,  362,
-      364,  400,  406,  561, 1763,  454,  253,   73,   80,   85,
-       90,   78,  372,   79,  326,  398,   92,   77,   94,  457,
-      411,  520,  533,  486,  504,  437,  546,  548,  553,  558,
-      564,  570,  578,  583,  595,  643,    0,  611,  619,  624,
-      631,  661,  668,  673,  123,  132,  237,  235,  240,  248,
-
-      552,  295,  302,  315,  402,  363,  359,  423,  392,  412,
-      542,  417,  443,  461,  449,  688,  719,  732,  745,  757,
-      770,  776,  778,  783,  789,  795,  804,  806,  812,  841,
-      848,  850,  856,  703,  468,  544,  551,  534,  584,  581,
-      844,  605,  631,  642,  633,  636,  663,  551,  654,  656,
-      653,  532,  666,  762,  770,  531,  781,  810,  908,  921,
-      879,  928,  907,  942,  944,  949,  951,  956,  958,  963,
-      973,  980,  986, 1005, 1011, 1017,  802,  816,  813,  823,
-      833,  846,  126,  833,  854,  841,  846,  850,  875,  522,
-      519,  913,  935,  935,  939,  977,  969,  992,  518,  983,
-
-     1002,  982,  511, 1006, 1056, 1073, 1086, 1763, 1071, 1099,
-     1101, 1115, 1121, 1108, 1133, 1135, 1143, 1145, 1150, 1002,
-     1011, 1105, 1122, 1117,  449, 1114, 1763, 1122, 1119, 1139,
-     1131, 1136, 1133, 1135, 1143, 1144, 1149, 1154,  447, 1142,
-     1153, 1144, 1158, 1149, 1163, 1162, 1177, 1178, 1164, 1763,
-     1227, 1213, 1240, 1215, 1246, 1259, 1248, 1261, 1268, 1274,
-     1276,  444,  442, 1178, 1194, 1230, 1216, 1242, 1247,  441,
-      436, 1266, 1244,  435, 1261, 1274, 1262, 1259,  432, 1257,
-      407, 1265,  287, 1266, 1262, 1279, 1281, 1270, 1287,  410,
-     1330, 1343, 1345, 1350, 1352, 1276, 1283, 1290,  409, 1296,
-
-     1337, 1324, 1327, 1331, 1325, 1346,    0, 1336, 1340, 1330,
-     1341, 1330, 1354, 1354, 1352, 1763, 1357, 1346, 1763, 1347,
-      387, 1351, 1363, 1763, 1349, 1375, 1413, 1415, 1420, 1381,
-     1401, 1405, 1391, 1392, 1398, 1409,  384, 1400, 1418, 1416,
-     1416, 1418,  372,  336, 1419, 1410, 1425, 1415, 1414, 1425,
-     1426, 1412, 1430, 1461, 1424, 1436, 1450, 1483, 1451, 1450,
-      346, 1460, 1464, 1455,  342, 1452, 1471, 1457,  327,  337,
-     1463, 1763, 1763,  335, 1458, 1471, 1476, 1461, 1481, 1471,
-     1467, 1486, 1476, 1485, 1490, 1763, 1467, 1473, 1475, 1493,
-     1487, 1503, 1513, 1509, 1524, 1520, 1524, 1763, 1512, 1510,
-
-     1514, 1513, 1522, 1520, 1516, 1515, 1534, 1763, 1520, 1531,
-     1529, 1517, 1763, 1528, 1539, 1536, 1542, 1534, 1534, 1551,
-     1535, 1551, 1556, 1573, 1559, 1576,  320, 1577, 1564,  319,
-      329,  325, 1763, 1564, 1582, 1763, 1585, 1570, 1578, 1576,
-      305, 1578, 1580, 1589, 1575, 1583, 1581,  302, 1582, 1763,
-     1595, 1580, 1763, 1582, 1584, 1599, 1763, 1590, 1588, 1606,
-     1591, 1763, 1763, 1625, 1616, 1632, 1636, 1626, 1763, 1629,
-      280,  266, 1633, 1634, 1763, 1632, 1626,  262, 1626, 1628,
-     1635, 1641, 1632, 1642, 1643, 1634, 1763, 1628, 1629, 1763,
-     1763, 1763,  260, 1640, 1656,  253, 1648, 1657, 1658, 1659,
-
-     1662, 1663, 1763, 1685, 1672, 1763,  243, 1690, 1692, 1676,
-      237,  221, 1694, 1687, 1763, 1680,  229, 1678, 1763, 1763,
-     1696,  217,  208, 1684, 1698, 1763, 1763, 1763, 1699, 1687,
-     1705, 1688, 1704,  202, 1763, 1763, 1763, 1756,  154, 1758,
-      131, 1760
+       49,  190,  255,    0,    0,    0,    0,   97,    0,  249,
+      279,  237,  653,    0, 1502,  442,  311,  339,  222,  368,
+      374,  491,  404, 1940,  490,  418,  406,  145,    0,    0,
+      193,  317,  819,  353,  389,  425, 1078,  513,  522,  537,
+      546,  561,  575,  584,  599,  608,  621,  630,  279,  645,
+     1512,  662,  676,  685,  484,  694,  709,    0,    0,    0,
+      450,  257,  410,  465,  496,  519,  507, 1941,  508,  462,
+      478,  521,  526,  541, 1249, 1521, 1530, 1322, 1415,  722,
+     1539,  731,  740, 1548,  751, 1557,  760,  780,  789,  802,
+     1566,    0,    0,  812, 1575,  834,  843,  853,  869,  883,
+
+      898,  907,  533,  553,  546,  542,  542,  544,  594,  570,
+      566,  572,  212,  572,  567,  442,  589,  625,  533,  614,
+      615,  627,  615, 1915, 1584, 1593, 1602, 1922,  922,  932,
+      947,  956,  493,  971,  980,  989, 1611,  998, 1013, 1022,
+     1035, 1044, 1062, 1071, 1620,  659,  655,  263,  642,  660,
+      685,  304,  690,  691,  695,  695,  696,  705,  722,  706,
+      720,  717,  762,  747,  740,  746,  775,  556,  755, 1929,
+     1629, 1638, 1936, 1092, 1101, 1647, 1656, 1110, 1665, 1674,
+     1121, 1135, 1148, 1159, 1170, 1180, 1189, 1683, 1203,  748,
+      762,  759,  774,  769,  780,  610,  764,  785,  783,  798,
+
+      803,  815,  833,  834,  818,  821,  821,  826,  847,  833,
+      849,  871,  852,  486,  847,  881,  864, 1943, 1692, 1701,
+        0, 1212, 1231, 1710, 1719, 1728, 1242, 1259, 1737, 1746,
+     1755, 1764, 1268, 1277,  846,  863,  875,  880,  875,  897,
+      863,    0,  877,  880,  899,  891,  896,  891,  890,  909,
+      917,  923,  928,  946,  917,  937,  935,  948,  939,  953,
+      944,  966,  984,  971,    0, 1773, 1782, 1288, 1306, 1791,
+     1800, 1809, 1818, 1827, 1836, 1315, 1845, 1009, 1011,  979,
+      992, 1018,  999, 1013, 1018, 1046, 1054, 1043, 1020, 1058,
+     1038,  619, 1039, 1039, 1073, 1057, 1079, 1066,  676, 1065,
+
+     1071, 1095, 1104, 1093, 1119, 1133, 1854, 1331, 1340, 1863,
+     1872, 1355, 1106, 1105, 1115, 1146, 1114, 1131, 1126, 1128,
+     1141, 1135, 1165,    0, 1164, 1174, 1165, 1176, 1165, 1197,
+     1204, 1202,    0, 1207,  333,    0, 1194, 1226, 1200, 1212,
+        0, 1198, 1208, 1881, 1368, 1890, 1377, 1211, 1225, 1253,
+     1247, 1255, 1258, 1278, 1299, 1270, 1288, 1286, 1286, 1289,
+     1306, 1339, 1334, 1325, 1340, 1329, 1328, 1348, 1349, 1335,
+     1353,  683, 1355, 1383, 1380, 1899, 1386, 1371, 1381, 1425,
+     1406, 1407, 1408, 1440, 1406, 1425, 1411, 1433, 1455, 1436,
+        0,    0, 1464, 1432, 1445, 1450, 1446, 1473, 1470, 1466,
+
+     1485, 1475, 1485, 1489,    0, 1477, 1398, 1491, 1499, 1523,
+     1525, 1532, 1547, 1551, 1573, 1577, 1587,    0, 1583, 1589,
+     1601, 1608, 1625, 1631, 1635, 1642, 1669,    0, 1663, 1682,
+     1688, 1684,    0, 1408, 1703, 1722, 1727, 1740, 1740, 1748,
+     1771, 1761, 1785, 1781, 1803, 1797, 1821, 1836, 1839, 1832,
+     1863, 1883, 1892,    0, 1867, 1893,    0, 1429, 1940, 1926,
+     1934, 1932, 1949, 1935, 1937, 1946, 1932, 1940, 1938, 1958,
+     1942,    0, 1955, 1940,    0, 1944, 1945, 1960,    0, 1444,
+     1951, 1947, 1963, 1948,    0,    0, 1965, 1953, 1969, 1972,
+     1962,    0, 1963, 1988, 1978, 1969, 1970,    0, 1453, 1968,
+
+     1962, 1983, 1963, 1965, 1972, 1978, 1969, 1979, 1980, 1971,
+        0, 1965, 1966, 1468,    0,    0,    0, 1994, 1978, 1994,
+     1997, 1986, 1995, 1996, 1995, 1996, 1997, 1477,    0, 2002,
+     1986,    0, 2006, 2005, 2006, 1990, 2010, 2011, 1486, 2008,
+     2001,    0, 1994, 2026, 1993,    0,    0, 1908, 2011, 2018,
+     2019, 2001, 2015,    0,    0,    0, 2016, 2004, 2022, 2005,
+     2021, 2027,    0,    0,    1
     } ;
 
-static yyconst flex_int16_t yy_def[543] =
+static yyconst flex_int16_t yy_def[566] =
     {   0,
-      537,    1,  537,  537,  537,  537,  537,  538,  537,  537,
-      539,  537,  539,  539,  539,  539,  539,  539,  539,  539,
-      539,  539,  539,  539,  539,  540,  538,  537,  538,  537,
-      537,  541,  541,  541,  537,  541,  541,  541,  541,  541,
-      541,  541,  541,  541,  541,  542,  541,  541,  541,  541,
-      541,  541,  541,  540,  537,   30,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,   56,   56,   56,   56,  537,
-      541,  541,  541,  537,  541,  541,  541,  541,  541,  541,
-      541,  541,  541,  541,  541,  542,   86,  541,  541,  541,
-      541,  541,  541,  541,   56,   56,   56,   56,   56,   56,
-
-       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,  537,  541,  541,  541,  537,
-      541,  541,  541,  541,  541,  541,  541,  541,  541,  541,
-      541,  541,  541,  541,   56,   56,   56,   56,   56,   56,
-      537,   56,   56,   56,   56,   56,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,   56,   56,   56,  537,  541,
-      541,  537,  541,  541,  541,  541,  541,  541,  541,  541,
-      541,  541,  541,  541,  541,  541,   56,   56,   56,   56,
-       56,   56,   56,  537,  537,  537,   56,   56,   56,   56,
-       56,   56,  537,   56,   56,   56,  537,   56,   56,   56,
-
-      537,  537,   56,   56,  537,  541,  541,  537,  541,  541,
-      541,  541,  541,  541,  541,  541,  541,  541,  541,   56,
-       56,   56,   56,   56,   56,  537,  537,  537,  537,  537,
-       56,   56,   56,  537,  537,   56,  537,   56,   56,   56,
-      537,   56,  537,   56,  537,  537,  537,  537,   56,  537,
-      541,  541,  541,  541,  541,  541,  541,  541,  541,  541,
-      541,   56,   56,   56,   56,   56,  537,  537,  537,  537,
-      537,   56,   56,   56,  537,  537,   56,  537,   56,  537,
-       56,  537,   56,  537,   56,  537,  537,  537,  537,   56,
-      541,  541,  541,  541,  541,  537,  537,   56,   56,   56,
-
-      537,  537,  537,  537,  537,   56,   56,  537,  537,  537,
-      537,   56,  537,  537,  537,  537,  537,  537,  537,  537,
-       56,  537,  537,  537,  537,  537,  541,  541,  541,  537,
-      537,   56,  537,   56,  537,  537,  537,  537,  537,   56,
-      537,  537,  537,  537,   56,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  541,  537,  537,
-       56,  537,   56,  537,  537,  537,  537,  537,   56,  537,
-      537,  537,  537,   56,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,   56,  537,  537,  537,  537,  537,  537,  537,  537,
-
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,   56,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-       56,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,    0,  537,  537,  537,
-      537,  537
+      565,    1,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,   12,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,  565,    8,  565,
+      565,  565,  565,   15,   15,   12,  565,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,    8,   36,
+       36,   36,   36,   36,   36,   36,   36,   28,  565,    8,
+       32,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,  565,   36,   36,   36,  565,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   49,   49,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,  565,   36,   36,   36,  565,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   61,   61,   61,   61,   61,
+       61,  565,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,  565,
+       36,   36,  565,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   61,
+       61,   61,   61,   61,   61,   61,  565,  565,  565,   61,
+
+       61,   61,   61,   61,   61,  565,   61,   61,   61,  565,
+       61,   61,   61,  565,  565,   61,   61,  565,   36,   36,
+      565,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   61,   61,   61,   61,   61,   61,
+      565,  565,  565,  565,  565,   61,   61,   61,  565,  565,
+       61,  565,   61,   61,   61,  565,   61,  565,   61,  565,
+      565,  565,  565,   61,  565,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   61,   61,   61,
+       61,   61,  565,  565,  565,  565,  565,   61,   61,   61,
+      565,  565,   61,  565,   61,  565,   61,  565,   61,  565,
+
+       61,  565,  565,  565,  565,   61,   36,   36,   36,   36,
+       36,   36,  565,  565,   61,   61,   61,  565,  565,  565,
+      565,  565,   61,   61,  565,  565,  565,  565,   61,  565,
+      565,  565,  565,  565,  565,  565,  565,   61,  565,  565,
+      565,  565,  565,   36,   36,   36,   36,  565,  565,   61,
+      565,   61,  565,  565,  565,  565,  565,   61,  565,  565,
+      565,  565,   61,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,   36,   36,  565,  565,   61,
+      565,   61,  565,  565,  565,  565,  565,   61,  565,  565,
+      565,  565,   61,  565,  565,  565,  565,  565,  565,  565,
+
+      565,  565,  565,  565,  565,  565,   36,  565,  565,  565,
+      565,   61,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,   36,  565,  565,  565,  565,   61,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,   36,  565,  565,
+      565,  565,   61,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,   36,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,   36,  565,
+
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,   36,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,   36,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,   36,  565,
+      565,  565,  565,  565,  565,  565,  565,   36,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[1838] =
+static yyconst flex_int16_t yy_nxt[2076] =
     {   0,
-        4,    5,    6,    7,    8,    4,    7,    9,    4,   10,
-       11,   11,   11,   11,   11,   11,   11,   12,    7,    4,
-       13,   13,   14,   15,   16,   17,   13,   18,   19,   20,
-       13,   21,   22,   13,   13,   13,   13,   23,   24,   25,
-       13,   13,   13,   13,   13,   13,    4,    4,   13,   13,
-       14,   15,   16,   17,   13,   18,   19,   20,   13,   21,
-       22,   13,   13,   13,   13,   23,   24,   25,   13,   13,
-       13,   13,   13,   13,   28,   33,   39,   34,   34,   34,
-       34,   34,   34,   34,   35,   35,   35,   35,   35,   35,
-       35,   36,   40,   41,   37,   38,   43,   44,   45,   50,
-
-       47,   52,   53,   51,   39,   28,   42,   97,   98,   99,
-      100,   48,  101,  105,  113,  114,   29,   49,  115,   36,
-       40,   41,   37,   38,   43,   44,   45,   50,   47,   52,
-       53,   51,   71,  226,   42,   97,   98,   99,  100,   48,
-      101,  105,  113,  114,  227,   49,  115,   29,   56,   56,
-       56,   56,   56,   56,   56,   32,  135,  136,   56,   57,
-       58,   59,   56,   60,   56,   61,   62,   56,   56,   56,
-       56,   63,   56,   64,   56,   65,   66,   67,   68,   69,
-       56,   56,   56,   56,  135,  136,   56,   57,   58,   59,
-       56,   60,   56,   61,   62,   56,   56,   56,   56,   63,
-
-       56,   64,   56,   65,   66,   67,   68,   69,   56,   56,
-       56,   56,   70,   70,   70,   70,   70,   70,   70,   32,
-      536,   32,   32,   32,   32,   32,  528,   72,   72,   72,
-       72,   72,   72,   72,   32,  527,  524,   32,   33,  520,
-       73,   73,   73,   73,   73,   73,   73,   74,   74,   74,
-       74,   74,   74,   74,   32,  519,   32,   32,   32,   32,
-       32,  515,   32,   32,   32,   32,   32,   32,   32,   32,
-      137,  506,   32,  138,   76,   32,   32,   32,  503,  139,
-      492,   95,   78,   75,  487,   32,  140,  486,   32,   32,
-       77,   79,   32,   96,  318,   32,   32,   32,  137,   32,
-
-       32,  138,   76,   32,   32,  319,   32,  139,   32,   95,
-       78,   75,   80,   32,  140,   32,   32,   32,   77,   79,
-      469,   96,   32,  462,   82,   32,   32,  142,   32,   81,
-       32,   83,  455,   32,   32,   32,  454,  453,  450,  143,
-       80,   88,  401,   32,  399,  398,  106,  144,  107,  394,
-      108,   84,   82,  390,  373,  142,   32,   81,   32,   83,
-       32,   32,   32,   32,   32,   32,   32,  143,   32,   32,
-       32,   32,   32,   32,  106,  144,  107,   89,  108,   84,
-       27,   27,   27,   27,   85,   27,   27,   86,   86,   27,
-      372,  366,  102,   90,  353,   91,  147,   27,   27,   27,
-
-      148,   32,   92,   32,   32,   89,  103,   32,   32,   32,
-       32,   32,  104,   32,   32,   32,  333,  326,   32,   32,
-      102,   90,  109,   91,  147,  316,   29,   86,  148,  151,
-       92,  110,  111,  145,  103,  152,  146,   93,  112,  314,
-      104,   32,  308,  305,   32,   32,   94,   32,  304,  297,
-      109,  296,  155,   32,  280,  149,  267,  151,   32,  110,
-      111,  145,  150,  152,  146,   93,  112,  116,  116,  116,
-      116,  116,  116,  116,   94,   56,   56,   56,  156,   56,
-      155,   56,   56,  149,   32,  157,  158,   56,  177,   56,
-      150,   56,   56,   56,   56,   56,  120,  120,  120,  120,
-
-      120,  120,  120,   56,   56,   56,  156,   56,   32,   56,
-       56,   32,   32,  157,  158,   56,  177,   56,  248,   56,
-       56,   56,   56,   56,   32,  243,  235,   32,  117,  234,
-      118,  118,  118,  118,  118,  118,  118,   32,  201,  197,
-       32,   33,  121,  119,  119,  119,  119,  119,  119,  119,
-       32,   32,   32,   32,   32,   32,   32,   32,  193,  141,
-       32,   32,   32,   55,  153,   32,   32,   32,   32,  178,
-      121,   32,   32,  181,   32,  125,  179,   32,   32,  154,
-       32,  537,   32,   55,  180,   32,   32,   32,  123,   46,
-       32,   32,  153,  122,  126,   32,  124,  178,   31,   32,
-
-       32,  181,   32,   32,  179,   32,  182,  154,  183,  127,
-       30,   32,  180,  128,  537,   32,  123,   32,   32,   32,
-       26,  537,  126,   32,  124,   32,   32,   32,   32,  187,
-       32,   32,   32,  537,  182,   32,  183,  127,   32,   32,
-      537,  128,   32,   27,   27,   27,   27,   85,   27,   27,
-       86,   86,   27,  537,  131,  188,  130,  187,   32,  129,
-       27,   27,   27,  189,  190,   32,   32,  191,   32,   32,
-      537,   32,   32,  537,  537,   32,   32,   32,   32,  537,
-       32,   32,  131,  188,  130,  132,  192,  129,  194,   29,
-       86,  189,  190,  195,  196,  191,  198,  134,  159,  159,
-
-      159,  159,  159,  159,  159,  537,  537,   32,   32,  133,
-       32,   32,  537,  132,  192,   32,  194,  537,  537,  537,
-       32,  195,  196,   32,  198,  134,   32,   32,  537,  160,
-      160,  160,  160,  160,  160,  160,   32,  133,  537,   32,
-      117,  537,  161,  161,  161,  161,  161,  161,  161,   32,
-       32,  537,   32,   32,  537,  119,  119,  119,  119,  119,
-      119,  119,  537,  537,  537,  537,   32,  162,  162,  162,
-      162,  162,  162,  162,   32,  537,  537,   32,   32,   32,
-       32,  537,   32,   32,   32,   32,   32,   32,  202,  537,
-       32,   32,   32,   32,  537,  537,   32,   32,  163,   32,
-
-      164,  199,   32,   32,  165,  200,  537,  166,   32,  167,
-       32,   32,   32,   32,   32,  537,   32,   32,  203,   32,
-       32,  537,  169,   32,  537,   32,  163,  537,  164,  199,
-       32,  537,  165,  200,  171,  166,  168,  167,  204,  220,
-      221,  222,   32,  172,  170,   32,  203,  223,   32,   32,
-      169,   32,   32,   32,   32,   32,   32,   32,   32,   32,
-       32,  537,  171,   32,   32,  184,  204,  220,  221,  222,
-      224,  172,  170,  225,  185,  223,  186,  228,  229,  230,
-      176,  173,  174,   32,  231,  232,   32,  117,   32,  175,
-      537,  537,  537,  184,  537,   32,  537,   32,  224,  233,
-
-      537,  225,  185,   32,  186,  228,  229,  230,  176,  173,
-      174,   32,  231,  232,   32,   32,  537,  175,  205,  205,
-      205,  205,  205,  205,  205,   32,   32,  233,   32,  206,
-      537,  207,  207,  207,  207,  207,  207,  207,  208,  208,
-      208,  208,  208,  208,  208,  209,   32,  236,   32,   32,
-       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
-       32,  537,   32,   32,   32,   32,   32,   32,   32,  212,
-       32,   32,  213,  209,  237,  236,  238,   32,  537,  210,
-       32,   32,  537,  239,   32,  537,  214,   32,   32,   32,
-       32,   32,  537,   32,   32,  537,   32,  537,  211,  537,
-
-      216,  240,  237,   32,  238,   32,  215,  210,  241,   32,
-       32,  239,   32,   32,  214,   32,  242,  244,   32,   32,
-       32,   32,  247,  217,   32,   32,  537,   32,  216,  240,
-      537,  249,  245,   32,  215,  246,  241,  218,  537,  537,
-      537,  537,  537,  537,  242,  244,  262,  537,  263,  537,
-      247,  217,   32,  537,  219,  537,  537,  537,   32,  249,
-      245,  537,  537,  246,   32,  218,  250,  250,  250,  250,
-      250,  250,  250,  537,  262,   32,  263,   32,   32,   32,
-       32,   32,  219,  251,  251,  251,  251,  251,  251,  251,
-       32,  537,  537,   32,  206,  537,  252,  252,  252,  252,
-
-      252,  252,  252,   32,  537,   32,   32,   32,   32,   32,
-      253,  537,   32,  537,  255,   32,   32,  256,   32,   32,
-       32,  537,   32,   32,  537,   32,  537,  257,   32,   32,
-      537,  264,  259,   32,  537,  258,  254,   32,  253,   32,
-       32,   32,   32,   32,  265,  266,   32,   32,   32,   32,
-       32,   32,   32,   32,   32,   32,  268,   32,   32,  264,
-      259,  269,   32,  270,  254,  271,  272,  273,   32,  537,
-      274,  260,  265,  266,  275,  276,  277,  278,  279,  281,
-       32,  282,   32,  283,  268,  284,  285,  286,  261,  269,
-       32,  270,   32,  271,  272,  273,  287,   32,  274,  260,
-
-      288,  289,  275,  276,  277,  278,  279,  281,  290,  282,
-      537,  283,  537,  284,  285,  286,  261,   32,  298,   32,
-       32,  206,   32,   32,  287,  537,  537,  537,  288,  289,
-      537,   32,  537,  299,   32,   32,  290,  291,  291,  291,
-      291,  291,  291,  291,   32,  537,  298,   32,   32,  293,
-       32,  300,   32,   32,   32,   32,   32,  301,  294,  537,
-       32,  299,   32,   32,  292,   32,   32,   32,   32,   32,
-      302,  303,   32,  295,   32,   32,   32,  293,   32,  300,
-       32,   32,   32,   32,   32,  301,  306,   32,  307,  309,
-      312,  313,  292,   32,  310,   32,  315,  317,  302,  303,
-
-      320,  321,  311,  322,  323,  324,   32,  325,   32,  537,
-      537,  330,  537,  537,  306,   32,  307,  309,  312,  313,
-      331,   32,  310,   32,  315,  317,  537,  332,  320,  321,
-      311,  322,  323,  324,   32,  325,  334,   32,   32,  330,
-      327,  327,  327,  327,  327,  327,  327,   32,  331,   32,
-       32,   32,   32,   32,   32,  332,   32,   32,   32,   32,
-       32,  335,  537,  336,  334,  337,  338,  339,  340,  537,
-      341,  537,  342,  343,  344,  345,  328,   32,  346,  347,
-      348,  349,  329,  350,  351,  352,  354,  355,  356,  335,
-       32,  336,   32,  337,  338,  339,  340,   32,  341,   32,
-
-      342,  343,  344,  345,  328,  357,  346,  347,  348,  349,
-      329,  350,  351,  352,  354,  355,  356,   32,  359,   32,
-       32,   32,   32,   32,   32,  360,  537,   32,   32,  361,
-      362,  363,  537,  357,  537,  364,  365,  367,  368,  537,
-      369,  370,  371,  374,  375,  376,  359,  377,  378,  379,
-      380,  381,  382,  360,  358,  385,  386,  361,  362,  363,
-       32,  537,   32,  364,  365,  367,  368,   32,  369,  370,
-      371,  374,  375,  376,  387,  377,  378,  379,  380,  381,
-      382,  383,  358,  385,  386,  388,  389,   32,  391,  384,
-       32,   32,  392,  393,  395,  396,  397,  400,  402,  403,
-
-      404,  405,  387,  406,  407,  408,  409,  410,  411,  383,
-      412,  413,  414,  388,  389,  415,  391,  384,  416,  417,
-      392,  393,  395,  396,  397,  400,  402,  403,  404,  405,
-       32,  406,  407,  408,  409,  410,  411,  418,  412,  413,
-      414,  419,  420,  415,  421,  422,  416,  417,  423,  424,
-      425,  426,  427,  428,  429,  430,  431,  432,  433,  434,
-      435,  436,  437,  438,  439,  418,  440,  441,  442,  419,
-      420,  443,  421,  422,  444,  445,  423,  424,  425,  426,
-      427,  428,  429,  430,  431,  432,  433,  434,  435,  436,
-      437,  438,  439,  446,  440,  441,  442,  447,  448,  443,
-
-      449,  451,  444,  445,  452,  456,  457,  458,  459,  460,
-      461,  463,  464,  465,  466,  467,  468,  470,  471,  472,
-      473,  446,  474,  475,  476,  447,  448,  477,  449,  451,
-      478,  479,  452,  456,  457,  458,  459,  460,  461,  463,
-      464,  465,  466,  467,  468,  470,  471,  472,  473,  480,
-      474,  475,  476,  481,  482,  477,  483,  484,  478,  479,
-      485,  488,  489,  490,  491,  493,  494,  495,  496,  497,
-      498,  499,  500,  501,  502,  504,  505,  480,  507,  508,
-      509,  481,  482,  510,  483,  484,  511,  512,  485,  488,
-      489,  490,  491,  493,  494,  495,  496,  497,  498,  499,
-
-      500,  501,  502,  504,  505,  513,  507,  508,  509,  514,
-      516,  510,  517,  518,  511,  512,  521,  522,  523,  525,
-      526,  529,  530,  531,  532,  533,  534,  535,  537,  537,
-      537,  537,  537,  513,  537,  537,  537,  514,  516,  537,
-      517,  518,  537,  537,  521,  522,  523,  525,  526,  529,
-      530,  531,  532,  533,  534,  535,   27,   27,   54,   54,
-       87,   87,    3,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537
+        3,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,    4,
+        5,    6,    7,    8,    4,    9,   10,    4,   11,   12,
+       12,   12,   12,   12,   12,   12,   13,   14,    4,   15,
+       15,   16,   17,   18,   19,   15,   20,   21,   22,   15,
+       23,   24,   15,   15,   15,   15,   25,   26,   27,   15,
+       15,   15,   15,   15,   15,    4,    4,   29,   29,   29,
+
+       29,   30,   29,   29,   29,   29,   29,   29,   29,   29,
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+       29,   29,   29,   31,   29,   58,   58,   59,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   60,   60,   28,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   34,   43,  156,   34,   35,  157,   36,   36,   36,
+       36,   36,   36,   36,  565,   44,   32,   34,   34,   34,
+       34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+       34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+       34,   34,   34,   91,   34,  103,   92,   92,  192,   93,
+       93,   93,   93,   93,   93,   93,  193,  104,   33,   93,
+
+       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+       93,   93,   93,   93,   93,  197,   92,   61,   61,   61,
+       61,   61,   61,   61,  198,   41,  199,   61,   62,   63,
+       64,   61,   65,   61,   66,   67,   61,   61,   61,   61,
+       68,   61,   69,   61,   70,   71,   72,   73,   74,   61,
+       61,   61,   61,   76,   76,   76,   76,   76,   76,   76,
+      368,  369,   42,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   77,
+
+       77,   77,   77,   77,   77,   77,   45,   46,   49,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   78,   78,   78,   78,   78,
+       78,   78,   56,   57,  105,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   61,   61,   61,  160,   61,   38,   61,   61,   39,
+       40,  161,  114,   61,  115,   61,  116,   61,   61,   61,
+       61,   61,   34,  106,   76,   76,   76,   76,   76,   76,
+
+       76,   34,  117,   76,   76,   76,   76,   76,   76,   76,
+       54,  118,  119,  178,   55,   47,  260,   99,  120,  261,
+      107,   34,  100,   76,   76,   76,   76,   76,   76,   76,
+       34,   48,   76,   76,   76,   76,   76,   76,   76,  108,
+      179,  109,  113,  121,   81,   34,   80,   76,   76,   76,
+       76,   76,   76,   76,   34,  164,   76,   76,   76,   76,
+       76,   76,   76,  215,  122,  123,  146,   83,   82,   34,
+      165,   76,   76,   76,   76,   76,   76,   76,  147,  148,
+      149,  150,  151,   34,   84,   76,   76,   76,   76,   76,
+       76,   76,   34,  216,   76,   76,   76,   76,   76,   76,
+
+       76,  152,  153,  154,  155,  158,   85,   34,  159,   76,
+       76,   76,   76,   76,   76,   76,   34,  241,   76,   76,
+       76,   76,   76,   76,   76,   86,  162,   87,  242,   34,
+       88,   76,   76,   76,   76,   76,   76,   76,   34,  327,
+       76,   76,   76,   76,   76,   76,   76,  328,  163,  166,
+      167,  168,  169,   34,   89,   76,   76,   76,   76,   76,
+       76,   76,   90,   37,   37,   37,   37,   37,   37,   37,
+       34,   94,   76,   76,   76,   76,   76,   76,   76,  190,
+      191,  194,  195,  335,   34,   96,   76,   76,   76,   76,
+       76,   76,   76,   34,  336,   76,   76,   76,   76,   76,
+
+       76,   76,   34,  402,   76,   76,   76,   76,   76,   76,
+       76,  403,  196,   97,  200,  201,  202,   34,   98,   76,
+       76,   76,   76,   76,   76,   76,  203,  204,  205,  206,
+       34,  101,   76,   76,   76,   76,   76,   76,   76,   34,
+      207,   76,   76,   76,   76,   76,   76,   76,   34,  102,
+       76,   76,   76,   76,   76,   76,   76,  208,  209,   34,
+      129,   76,   76,   76,   76,   76,   76,   76,   34,  210,
+       76,   76,   76,   76,   76,   76,   76,  211,  130,  212,
+      131,  213,  214,  217,  134,  235,  236,  237,   34,  132,
+       76,   76,   76,   76,   76,   76,   76,   34,  238,   76,
+
+       76,   76,   76,   76,   76,   76,  239,  240,  243,  244,
+       34,  135,   76,   76,   76,   76,   76,   76,   76,  136,
+       34,  245,   76,   76,   76,   76,   76,   76,   76,   75,
+       75,   75,   75,   75,   75,   75,  246,  137,  247,  248,
+      249,  250,   34,  138,   76,   76,   76,   76,   76,   76,
+       76,   34,  251,   76,   76,   76,   76,   76,   76,   76,
+      252,   34,  253,   76,   76,   76,   76,   76,   76,   76,
+      254,  255,  256,  257,  139,  140,  141,   34,  258,   76,
+       76,   76,   76,   76,   76,   76,  259,  262,  263,  264,
+      278,   34,  142,   76,   76,   76,   76,   76,   76,   76,
+
+      279,  280,  281,  282,  283,  284,   34,  143,   76,   76,
+       76,   76,   76,   76,   76,   34,  285,   76,   76,   76,
+       76,   76,   76,   76,  286,  287,  288,  289,  290,  291,
+       34,  145,   76,   76,   76,   76,   76,   76,   76,  144,
+       34,  292,   76,   76,   76,   76,   76,   76,   76,  293,
+      174,  294,  295,  296,  297,   34,  175,   76,   76,   76,
+       76,   76,   76,   76,   34,  298,   76,   76,   76,   76,
+       76,   76,   76,  176,  299,  300,  301,  302,  303,   34,
+      177,   76,   76,   76,   76,   76,   76,   76,   34,  304,
+       76,   76,   76,   76,   76,   76,   76,   34,  180,   76,
+
+       76,   76,   76,   76,   76,   76,   34,  305,   76,   76,
+       76,   76,   76,   76,   76,  306,  313,  182,  314,  315,
+      181,   34,  183,   76,   76,   76,   76,   76,   76,   76,
+       34,  316,   76,   76,   76,   76,   76,   76,   76,  317,
+      318,  319,  320,   34,  184,   76,   76,   76,   76,   76,
+       76,   76,   34,  321,   76,   76,   76,   76,   76,   76,
+       76,  322,  185,  323,  324,  325,  326,  329,  187,  186,
+       34,  330,   76,   76,   76,   76,   76,   76,   76,   34,
+      331,   76,   76,   76,   76,   76,   76,   76,   79,   79,
+       79,   79,   79,   79,   79,  189,  332,  333,  334,  337,
+
+       34,  188,   76,   76,   76,   76,   76,   76,   76,   34,
+      338,   76,   76,   76,   76,   76,   76,   76,   34,  339,
+       76,   76,   76,   76,   76,   76,   76,  340,  341,   34,
+      222,   76,   76,   76,   76,   76,   76,   76,  223,  342,
+      343,  348,  349,   34,  227,   76,   76,   76,   76,   76,
+       76,   76,  350,  351,  352,  353,   34,  224,   76,   76,
+       76,   76,   76,   76,   76,  354,  355,   34,  228,   76,
+       76,   76,   76,   76,   76,   76,  356,  357,   34,  230,
+       76,   76,   76,   76,   76,   76,   76,  358,   34,  229,
+       76,   76,   76,   76,   76,   76,   76,   34,  359,   76,
+
+       76,   76,   76,   76,   76,   76,  360,  231,  361,  362,
+      363,   34,  232,   76,   76,   76,   76,   76,   76,   76,
+       34,  364,   76,   76,   76,   76,   76,   76,   76,  365,
+      366,  367,  370,  371,  233,  372,  373,  374,  375,   34,
+      234,   76,   76,   76,   76,   76,   76,   76,  378,  379,
+       34,  268,   76,   76,   76,   76,   76,   76,   76,  124,
+      124,  124,  124,  124,  124,  124,  274,   34,  269,   76,
+       76,   76,   76,   76,   76,   76,   34,  380,   76,   76,
+       76,   76,   76,   76,   76,   34,  381,   76,   76,   76,
+       76,   76,   76,   76,  382,  383,   34,  275,   76,   76,
+
+       76,   76,   76,   76,   76,  384,  385,  386,  387,  276,
+      388,  389,  308,  390,   34,  277,   76,   76,   76,   76,
+       76,   76,   76,   34,  391,   76,   76,   76,   76,   76,
+       76,   76,  127,  127,  127,  127,  127,  127,  127,   34,
+      309,   76,   76,   76,   76,   76,   76,   76,   34,  312,
+       76,   76,   76,   76,   76,   76,   76,  392,  393,  394,
+      395,  396,  397,   34,  345,   76,   76,   76,   76,   76,
+       76,   76,  398,  399,  400,  401,   34,  346,   76,   76,
+       76,   76,   76,   76,   76,   34,  404,   76,   76,   76,
+       76,   76,   76,   76,   34,  347,   76,   76,   76,   76,
+
+       76,   76,   76,  405,  406,  408,   34,  376,   76,   76,
+       76,   76,   76,   76,   76,  377,   34,  409,   76,   76,
+       76,   76,   76,   76,   76,  128,  128,  128,  128,  128,
+      128,  128,  410,  407,  411,  412,  434,   34,  458,   76,
+       76,   76,   76,   76,   76,   76,  413,  414,  415,  416,
+      417,  418,   34,  480,   76,   76,   76,   76,   76,   76,
+       76,   34,  419,   76,   76,   76,   76,   76,   76,   76,
+      420,  421,  422,  423,  424,  499,   34,  514,   76,   76,
+       76,   76,   76,   76,   76,   34,  425,   76,   76,   76,
+       76,   76,   76,   76,   34,  426,   76,   76,   76,   76,
+
+       76,   76,   76,  427,  428,  429,  430,  528,  431,  432,
+       34,  539,   34,   34,   34,   34,   34,   34,   34,  548,
+       34,  433,   76,   76,   76,   76,   76,   95,   76,   34,
+      435,   76,   76,   76,   76,   76,   76,   76,  125,  436,
+      126,  126,  126,  126,  126,  126,  126,   34,  437,   76,
+       76,   76,   76,   76,   76,   76,   34,  438,   76,   76,
+       76,   76,   76,   76,   76,   34,  439,   76,  133,   76,
+       76,   76,   76,   76,   34,  440,   76,   76,   76,   76,
+       76,   76,   76,   34,  441,   76,   76,   76,   76,   76,
+       76,   76,   34,  442,  171,  171,  171,  171,  171,  171,
+
+      171,  125,  443,  172,  172,  172,  172,  172,  172,  172,
+       34,  444,  127,  127,  127,  127,  127,  127,  127,   34,
+      445,   76,   76,   76,   76,   76,   76,   76,   34,  446,
+       76,   76,   76,   76,   76,   76,   76,  219,  447,  220,
+      220,  220,  220,  220,  220,  220,  125,  448,   76,   76,
+       76,   76,   76,   76,   76,   34,  449,   76,   76,   76,
+       76,   76,   76,   76,   34,  450,   76,   76,   76,   76,
+       76,   76,   76,   34,  451,   76,   76,   76,  225,   76,
+       76,  226,   34,  452,   76,   76,   76,   76,   76,   76,
+       76,   34,  453,   76,   76,   76,   76,   76,   76,   76,
+
+       34,  454,  266,  266,  266,  266,  266,  266,  266,  219,
+      455,  267,  267,  267,  267,  267,  267,  267,   34,  456,
+       76,   76,   76,  270,   76,   76,  271,   34,  457,   76,
+       76,  272,   76,   76,   76,   76,   34,  459,   76,   76,
+       76,   76,  273,   76,   76,   34,  460,   76,   76,   76,
+       76,   76,   76,   76,   34,  461,   76,   76,   76,   76,
+       76,   76,   76,   34,  462,   76,   76,   76,   76,   76,
+       76,   76,   34,  463,   76,   76,   76,   76,   76,   76,
+       76,   34,  464,  307,  307,  307,  307,  307,  307,  307,
+      219,  465,   76,   76,   76,   76,   76,   76,   76,   34,
+
+      466,   76,   76,  310,   76,   76,   76,   76,   34,  467,
+       76,   76,   76,   76,  311,   76,   76,   34,  468,   76,
+       76,   76,   76,   76,   76,   76,   34,  469,   76,   76,
+       76,   76,   76,   76,   76,   34,  470,   76,   76,   76,
+       76,   76,   76,   76,   34,  471,   76,   76,   76,   76,
+       76,   76,   76,   34,  472,   76,   76,   76,   76,   76,
+       76,   76,   34,  473,  344,  344,  344,  344,  344,  344,
+      344,   34,  474,   76,   76,   76,   76,   76,   76,   76,
+       34,  475,   76,   76,   76,   76,   76,   76,   76,   34,
+      476,   76,   76,   76,   76,   76,   76,   76,   34,  477,
+
+       76,   76,   76,   76,   76,   76,   76,   34,  478,   76,
+       76,   76,   76,   76,   76,   76,   34,  479,   76,   76,
+       76,   76,   76,   76,   76,  170,  170,  170,  170,  170,
+      170,  170,  173,  173,  173,  173,  173,  173,  173,  218,
+      218,  218,  218,  218,  218,  218,  221,  221,  221,  221,
+      221,  221,  221,  265,  265,  265,  265,  265,  265,  265,
+       50,  110,  481,   51,  482,  483,  484,  485,  486,  487,
+      488,  489,  490,  491,   52,  111,  492,  493,  494,  495,
+       53,  112,  496,  497,  498,  500,  501,  502,  503,  504,
+      505,  506,  507,  508,  509,  510,  511,  512,  513,  515,
+
+      516,  517,  518,  519,  520,  521,  522,  523,  524,  525,
+      526,  527,  529,  530,  531,  532,  533,  534,  535,  536,
+      537,  538,  540,  541,  542,  543,  544,  545,  546,  547,
+      549,  550,  551,  552,  553,  554,  555,  556,  557,  558,
+      559,  560,  561,  562,  563,  564,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0
     } ;
 
-static yyconst flex_int16_t yy_chk[1838] =
+static yyconst flex_int16_t yy_chk[2076] =
     {   0,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    8,   11,   15,   11,   11,   11,
-       11,   11,   11,   11,   12,   12,   12,   12,   12,   12,
-       12,   14,   16,   17,   14,   14,   18,   19,   20,   23,
-
-       22,   24,   25,   23,   15,   27,   17,   58,   59,   60,
-       61,   22,   62,   64,   67,   68,    8,   22,   69,   14,
-       16,   17,   14,   14,   18,   19,   20,   23,   22,   24,
-       25,   23,  541,  183,   17,   58,   59,   60,   61,   22,
-       62,   64,   67,   68,  183,   22,   69,   27,   30,   30,
-       30,   30,   30,   30,   30,  539,   95,   96,   30,   30,
-       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
-       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
-       30,   30,   30,   30,   95,   96,   30,   30,   30,   30,
-       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
-
-       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
-       30,   30,   31,   31,   31,   31,   31,   31,   31,   32,
-      534,   33,   32,   32,   33,   33,  523,   33,   33,   33,
-       33,   33,   33,   33,   34,  522,  517,   34,   34,  512,
-       34,   34,   34,   34,   34,   34,   34,   35,   35,   35,
-       35,   35,   35,   35,   36,  511,   37,   36,   36,   37,
-       37,  507,   32,   38,   33,   39,   38,   38,   39,   39,
-       97,  496,   40,   98,   37,   40,   40,   34,  493,   99,
-      478,   57,   39,   36,  472,   41,  100,  471,   41,   41,
-       38,   40,   42,   57,  283,   42,   42,   36,   97,   37,
-
-       43,   98,   37,   43,   43,  283,   38,   99,   39,   57,
-       39,   36,   41,   44,  100,   40,   44,   44,   38,   40,
-      448,   57,   45,  441,   43,   45,   45,  102,   41,   42,
-       47,   44,  432,   47,   47,   42,  431,  430,  427,  103,
-       41,   47,  374,   43,  370,  369,   65,  104,   65,  365,
-       65,   45,   43,  361,  344,  102,   44,   42,   48,   44,
-       49,   48,   48,   49,   49,   45,   50,  103,   51,   50,
-       50,   51,   51,   47,   65,  104,   65,   48,   65,   45,
-       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
-      343,  337,   63,   49,  321,   50,  106,   46,   46,   46,
-
-      107,   48,   51,   49,   52,   48,   63,   52,   52,   50,
-       53,   51,   63,   53,   53,   71,  299,  290,   71,   71,
-       63,   49,   66,   50,  106,  281,   46,   46,  107,  109,
-       51,   66,   66,  105,   63,  110,  105,   52,   66,  279,
-       63,   76,  274,  271,   76,   76,   53,   52,  270,  263,
-       66,  262,  112,   53,  239,  108,  225,  109,   71,   66,
-       66,  105,  108,  110,  105,   52,   66,   70,   70,   70,
-       70,   70,   70,   70,   53,   56,   56,   56,  113,   56,
-      112,   56,   56,  108,   76,  114,  115,   56,  135,   56,
-      108,   56,   56,   56,   56,   56,   74,   74,   74,   74,
-
-       74,   74,   74,   56,   56,   56,  113,   56,   75,   56,
-       56,   75,   75,  114,  115,   56,  135,   56,  203,   56,
-       56,   56,   56,   56,   72,  199,  191,   72,   72,  190,
-       72,   72,   72,   72,   72,   72,   72,   73,  156,  152,
-       73,   73,   75,   73,   73,   73,   73,   73,   73,   73,
-       77,   75,   78,   77,   77,   78,   78,   79,  148,  101,
-       79,   79,   80,   54,  111,   80,   80,   72,   81,  136,
-       75,   81,   81,  138,   82,   81,  137,   82,   82,  111,
-       73,   29,   83,   26,  137,   83,   83,   84,   78,   21,
-       84,   84,  111,   77,   82,   78,   80,  136,   10,   85,
-
-       79,  138,   85,   85,  137,   80,  139,  111,  140,   83,
-        9,   81,  137,   84,    3,   88,   78,   82,   88,   88,
-        2,    0,   82,   89,   80,   83,   89,   89,   90,  142,
-       84,   90,   90,    0,  139,   91,  140,   83,   91,   91,
-        0,   84,   85,   86,   86,   86,   86,   86,   86,   86,
-       86,   86,   86,    0,   91,  143,   90,  142,   88,   89,
-       86,   86,   86,  144,  145,   92,   89,  146,   92,   92,
-        0,   90,   93,    0,    0,   93,   93,   94,   91,    0,
-       94,   94,   91,  143,   90,   92,  147,   89,  149,   86,
-       86,  144,  145,  150,  151,  146,  153,   94,  116,  116,
-
-      116,  116,  116,  116,  116,    0,    0,  134,   92,   93,
-      134,  134,    0,   92,  147,   93,  149,    0,    0,    0,
-       94,  150,  151,  117,  153,   94,  117,  117,    0,  117,
-      117,  117,  117,  117,  117,  117,  118,   93,    0,  118,
-      118,    0,  118,  118,  118,  118,  118,  118,  118,  119,
-      134,    0,  119,  119,    0,  119,  119,  119,  119,  119,
-      119,  119,    0,    0,    0,    0,  117,  120,  120,  120,
-      120,  120,  120,  120,  121,    0,    0,  121,  121,  118,
-      122,    0,  123,  122,  122,  123,  123,  124,  157,    0,
-      124,  124,  119,  125,    0,    0,  125,  125,  121,  126,
-
-      122,  154,  126,  126,  123,  155,    0,  124,  127,  125,
-      128,  127,  127,  128,  128,    0,  129,  121,  157,  129,
-      129,    0,  126,  122,    0,  123,  121,    0,  122,  154,
-      124,    0,  123,  155,  128,  124,  125,  125,  158,  177,
-      178,  179,  126,  129,  127,  130,  157,  180,  130,  130,
-      126,  127,  131,  128,  132,  131,  131,  132,  132,  129,
-      133,    0,  128,  133,  133,  141,  158,  177,  178,  179,
-      181,  129,  127,  182,  141,  180,  141,  184,  185,  186,
-      133,  130,  131,  161,  187,  188,  161,  161,  130,  132,
-        0,    0,    0,  141,    0,  131,    0,  132,  181,  189,
-
-        0,  182,  141,  133,  141,  184,  185,  186,  133,  130,
-      131,  163,  187,  188,  163,  163,    0,  132,  159,  159,
-      159,  159,  159,  159,  159,  160,  161,  189,  160,  160,
-        0,  160,  160,  160,  160,  160,  160,  160,  162,  162,
-      162,  162,  162,  162,  162,  163,  164,  192,  165,  164,
-      164,  165,  165,  166,  163,  167,  166,  166,  167,  167,
-      168,    0,  169,  168,  168,  169,  169,  170,  160,  168,
-      170,  170,  168,  163,  193,  192,  194,  171,    0,  164,
-      171,  171,    0,  195,  172,    0,  170,  172,  172,  164,
-      173,  165,    0,  173,  173,    0,  166,    0,  167,    0,
-
-      172,  196,  193,  168,  194,  169,  171,  164,  197,  174,
-      170,  195,  174,  174,  170,  175,  198,  200,  175,  175,
-      171,  176,  202,  173,  176,  176,    0,  172,  172,  196,
-        0,  204,  201,  173,  171,  201,  197,  174,    0,    0,
-        0,    0,    0,    0,  198,  200,  220,    0,  221,    0,
-      202,  173,  174,    0,  176,    0,    0,    0,  175,  204,
-      201,    0,    0,  201,  176,  174,  205,  205,  205,  205,
-      205,  205,  205,    0,  220,  209,  221,  206,  209,  209,
-      206,  206,  176,  206,  206,  206,  206,  206,  206,  206,
-      207,    0,    0,  207,  207,    0,  207,  207,  207,  207,
-
-      207,  207,  207,  210,    0,  211,  210,  210,  211,  211,
-      209,    0,  214,    0,  211,  214,  214,  211,  209,  212,
-      206,    0,  212,  212,    0,  213,    0,  212,  213,  213,
-        0,  222,  214,  207,    0,  213,  210,  215,  209,  216,
-      215,  215,  216,  216,  223,  224,  210,  217,  211,  218,
-      217,  217,  218,  218,  219,  214,  226,  219,  219,  222,
-      214,  228,  212,  229,  210,  230,  231,  232,  213,    0,
-      233,  215,  223,  224,  234,  235,  236,  237,  238,  240,
-      215,  241,  216,  242,  226,  243,  244,  245,  219,  228,
-      217,  229,  218,  230,  231,  232,  246,  219,  233,  215,
-
-      247,  248,  234,  235,  236,  237,  238,  240,  249,  241,
-        0,  242,    0,  243,  244,  245,  219,  252,  264,  254,
-      252,  252,  254,  254,  246,    0,    0,    0,  247,  248,
-        0,  251,    0,  265,  251,  251,  249,  251,  251,  251,
-      251,  251,  251,  251,  253,    0,  264,  253,  253,  254,
-      255,  266,  257,  255,  255,  257,  257,  267,  255,    0,
-      252,  265,  254,  256,  253,  258,  256,  256,  258,  258,
-      268,  269,  259,  256,  251,  259,  259,  254,  260,  266,
-      261,  260,  260,  261,  261,  267,  272,  253,  273,  275,
-      277,  278,  253,  255,  276,  257,  280,  282,  268,  269,
-
-      284,  285,  276,  286,  287,  288,  256,  289,  258,    0,
-        0,  296,    0,    0,  272,  259,  273,  275,  277,  278,
-      297,  260,  276,  261,  280,  282,    0,  298,  284,  285,
-      276,  286,  287,  288,  291,  289,  300,  291,  291,  296,
-      291,  291,  291,  291,  291,  291,  291,  292,  297,  293,
-      292,  292,  293,  293,  294,  298,  295,  294,  294,  295,
-      295,  301,    0,  302,  300,  303,  304,  305,  306,    0,
-      308,    0,  309,  310,  311,  312,  292,  291,  313,  314,
-      315,  317,  293,  318,  318,  320,  322,  323,  325,  301,
-      292,  302,  293,  303,  304,  305,  306,  294,  308,  295,
-
-      309,  310,  311,  312,  292,  326,  313,  314,  315,  317,
-      293,  318,  318,  320,  322,  323,  325,  327,  330,  328,
-      327,  327,  328,  328,  329,  331,    0,  329,  329,  332,
-      333,  334,    0,  326,    0,  335,  336,  338,  339,    0,
-      340,  341,  342,  345,  346,  347,  330,  348,  349,  350,
-      351,  352,  353,  331,  328,  355,  356,  332,  333,  334,
-      327,    0,  328,  335,  336,  338,  339,  329,  340,  341,
-      342,  345,  346,  347,  357,  348,  349,  350,  351,  352,
-      353,  354,  328,  355,  356,  359,  360,  358,  362,  354,
-      358,  358,  363,  364,  366,  367,  368,  371,  375,  376,
-
-      377,  378,  357,  379,  380,  381,  382,  383,  384,  354,
-      385,  387,  388,  359,  360,  389,  362,  354,  390,  391,
-      363,  364,  366,  367,  368,  371,  375,  376,  377,  378,
-      358,  379,  380,  381,  382,  383,  384,  392,  385,  387,
-      388,  393,  394,  389,  395,  396,  390,  391,  397,  399,
-      400,  401,  402,  403,  404,  405,  406,  407,  409,  410,
-      411,  412,  414,  415,  416,  392,  417,  418,  419,  393,
-      394,  420,  395,  396,  421,  422,  397,  399,  400,  401,
-      402,  403,  404,  405,  406,  407,  409,  410,  411,  412,
-      414,  415,  416,  423,  417,  418,  419,  424,  425,  420,
-
-      426,  428,  421,  422,  429,  434,  435,  437,  438,  439,
-      440,  442,  443,  444,  445,  446,  447,  449,  451,  452,
-      454,  423,  455,  456,  458,  424,  425,  459,  426,  428,
-      460,  461,  429,  434,  435,  437,  438,  439,  440,  442,
-      443,  444,  445,  446,  447,  449,  451,  452,  454,  464,
-      455,  456,  458,  465,  466,  459,  467,  468,  460,  461,
-      470,  473,  474,  476,  477,  479,  480,  481,  482,  483,
-      484,  485,  486,  488,  489,  494,  495,  464,  497,  498,
-      499,  465,  466,  500,  467,  468,  501,  502,  470,  473,
-      474,  476,  477,  479,  480,  481,  482,  483,  484,  485,
-
-      486,  488,  489,  494,  495,  504,  497,  498,  499,  505,
-      508,  500,  509,  510,  501,  502,  513,  514,  516,  518,
-      521,  524,  525,  529,  530,  531,  532,  533,    0,    0,
-        0,    0,    0,  504,    0,    0,    0,  505,  508,    0,
-      509,  510,    0,    0,  513,  514,  516,  518,  521,  524,
-      525,  529,  530,  531,  532,  533,  538,  538,  540,  540,
-      542,  542,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  537,  537,  537,  537,  537
+        1,    1,    1,    1,    1,    1,    1,    8,    8,    8,
+
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   31,   31,    2,   31,   31,   31,   31,
+
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   12,   19,  113,   12,   12,  113,   12,   12,   12,
+       12,   12,   12,   12,    3,   19,   10,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   49,   12,   62,   49,   49,  148,   49,
+       49,   49,   49,   49,   49,   49,  148,   62,   11,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,  152,   49,   32,   32,   32,
+       32,   32,   32,   32,  152,   17,  152,   32,   32,   32,
+       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+       32,   32,   32,   34,   34,   34,   34,   34,   34,   34,
+      335,  335,   18,   34,   34,   34,   34,   34,   34,   34,
+       34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+       34,   34,   34,   34,   34,   34,   34,   34,   34,   35,
+
+       35,   35,   35,   35,   35,   35,   20,   21,   23,   35,
+       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,   35,   36,   36,   36,   36,   36,
+       36,   36,   26,   27,   63,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   61,   61,   61,  116,   61,   16,   61,   61,   16,
+       16,  116,   70,   61,   70,   61,   70,   61,   61,   61,
+       61,   61,   55,   64,   55,   55,   55,   55,   55,   55,
+
+       55,  133,   71,  133,  133,  133,  133,  133,  133,  133,
+       25,   71,   71,  133,   25,   22,  214,   55,   71,  214,
+       65,   38,   55,   38,   38,   38,   38,   38,   38,   38,
+       39,   22,   39,   39,   39,   39,   39,   39,   39,   66,
+      133,   67,   69,   72,   39,   40,   38,   40,   40,   40,
+       40,   40,   40,   40,   41,  119,   41,   41,   41,   41,
+       41,   41,   41,  168,   73,   74,  103,   41,   40,   42,
+      119,   42,   42,   42,   42,   42,   42,   42,  104,  105,
+      106,  107,  108,   43,   42,   43,   43,   43,   43,   43,
+       43,   43,   44,  168,   44,   44,   44,   44,   44,   44,
+
+       44,  109,  110,  111,  112,  114,   43,   45,  115,   45,
+       45,   45,   45,   45,   45,   45,   46,  196,   46,   46,
+       46,   46,   46,   46,   46,   44,  117,   45,  196,   47,
+       46,   47,   47,   47,   47,   47,   47,   47,   48,  292,
+       48,   48,   48,   48,   48,   48,   48,  292,  118,  120,
+      121,  122,  123,   50,   47,   50,   50,   50,   50,   50,
+       50,   50,   48,   13,   13,   13,   13,   13,   13,   13,
+       52,   50,   52,   52,   52,   52,   52,   52,   52,  146,
+      147,  149,  150,  299,   53,   52,   53,   53,   53,   53,
+       53,   53,   53,   54,  299,   54,   54,   54,   54,   54,
+
+       54,   54,   56,  372,   56,   56,   56,   56,   56,   56,
+       56,  372,  151,   53,  153,  154,  155,   57,   54,   57,
+       57,   57,   57,   57,   57,   57,  156,  157,  158,  159,
+       80,   56,   80,   80,   80,   80,   80,   80,   80,   82,
+      160,   82,   82,   82,   82,   82,   82,   82,   83,   57,
+       83,   83,   83,   83,   83,   83,   83,  161,  162,   85,
+       80,   85,   85,   85,   85,   85,   85,   85,   87,  163,
+       87,   87,   87,   87,   87,   87,   87,  164,   82,  165,
+       83,  166,  167,  169,   87,  190,  191,  192,   88,   85,
+       88,   88,   88,   88,   88,   88,   88,   89,  193,   89,
+
+       89,   89,   89,   89,   89,   89,  194,  195,  197,  198,
+       90,   88,   90,   90,   90,   90,   90,   90,   90,   89,
+       94,  199,   94,   94,   94,   94,   94,   94,   94,   33,
+       33,   33,   33,   33,   33,   33,  200,   90,  201,  202,
+      203,  204,   96,   94,   96,   96,   96,   96,   96,   96,
+       96,   97,  205,   97,   97,   97,   97,   97,   97,   97,
+      206,   98,  207,   98,   98,   98,   98,   98,   98,   98,
+      208,  209,  210,  211,   96,   97,   98,   99,  212,   99,
+       99,   99,   99,   99,   99,   99,  213,  215,  216,  217,
+      235,  100,   99,  100,  100,  100,  100,  100,  100,  100,
+
+      236,  237,  238,  239,  240,  241,  101,  100,  101,  101,
+      101,  101,  101,  101,  101,  102,  243,  102,  102,  102,
+      102,  102,  102,  102,  244,  245,  246,  247,  248,  249,
+      129,  102,  129,  129,  129,  129,  129,  129,  129,  101,
+      130,  250,  130,  130,  130,  130,  130,  130,  130,  251,
+      129,  252,  253,  254,  255,  131,  130,  131,  131,  131,
+      131,  131,  131,  131,  132,  256,  132,  132,  132,  132,
+      132,  132,  132,  131,  257,  258,  259,  260,  261,  134,
+      132,  134,  134,  134,  134,  134,  134,  134,  135,  262,
+      135,  135,  135,  135,  135,  135,  135,  136,  134,  136,
+
+      136,  136,  136,  136,  136,  136,  138,  263,  138,  138,
+      138,  138,  138,  138,  138,  264,  278,  136,  279,  280,
+      135,  139,  138,  139,  139,  139,  139,  139,  139,  139,
+      140,  281,  140,  140,  140,  140,  140,  140,  140,  282,
+      283,  284,  285,  141,  139,  141,  141,  141,  141,  141,
+      141,  141,  142,  286,  142,  142,  142,  142,  142,  142,
+      142,  287,  140,  288,  289,  290,  291,  293,  142,  141,
+      143,  294,  143,  143,  143,  143,  143,  143,  143,  144,
+      295,  144,  144,  144,  144,  144,  144,  144,   37,   37,
+       37,   37,   37,   37,   37,  144,  296,  297,  298,  300,
+
+      174,  143,  174,  174,  174,  174,  174,  174,  174,  175,
+      301,  175,  175,  175,  175,  175,  175,  175,  178,  302,
+      178,  178,  178,  178,  178,  178,  178,  303,  304,  181,
+      174,  181,  181,  181,  181,  181,  181,  181,  175,  305,
+      306,  313,  314,  182,  181,  182,  182,  182,  182,  182,
+      182,  182,  315,  316,  317,  318,  183,  178,  183,  183,
+      183,  183,  183,  183,  183,  319,  320,  184,  182,  184,
+      184,  184,  184,  184,  184,  184,  321,  322,  185,  184,
+      185,  185,  185,  185,  185,  185,  185,  323,  186,  183,
+      186,  186,  186,  186,  186,  186,  186,  187,  325,  187,
+
+      187,  187,  187,  187,  187,  187,  326,  185,  327,  328,
+      329,  189,  186,  189,  189,  189,  189,  189,  189,  189,
+      222,  330,  222,  222,  222,  222,  222,  222,  222,  331,
+      332,  334,  337,  338,  187,  339,  340,  342,  343,  223,
+      189,  223,  223,  223,  223,  223,  223,  223,  348,  349,
+      227,  222,  227,  227,  227,  227,  227,  227,  227,   75,
+       75,   75,   75,   75,   75,   75,  227,  228,  223,  228,
+      228,  228,  228,  228,  228,  228,  233,  350,  233,  233,
+      233,  233,  233,  233,  233,  234,  351,  234,  234,  234,
+      234,  234,  234,  234,  352,  353,  268,  228,  268,  268,
+
+      268,  268,  268,  268,  268,  354,  355,  356,  357,  233,
+      358,  359,  268,  360,  269,  234,  269,  269,  269,  269,
+      269,  269,  269,  276,  361,  276,  276,  276,  276,  276,
+      276,  276,   78,   78,   78,   78,   78,   78,   78,  308,
+      269,  308,  308,  308,  308,  308,  308,  308,  309,  276,
+      309,  309,  309,  309,  309,  309,  309,  362,  363,  364,
+      365,  366,  367,  312,  308,  312,  312,  312,  312,  312,
+      312,  312,  368,  369,  370,  371,  345,  309,  345,  345,
+      345,  345,  345,  345,  345,  347,  373,  347,  347,  347,
+      347,  347,  347,  347,  377,  312,  377,  377,  377,  377,
+
+      377,  377,  377,  374,  375,  378,  407,  345,  407,  407,
+      407,  407,  407,  407,  407,  347,  434,  379,  434,  434,
+      434,  434,  434,  434,  434,   79,   79,   79,   79,   79,
+       79,   79,  380,  377,  381,  382,  407,  458,  434,  458,
+      458,  458,  458,  458,  458,  458,  383,  384,  385,  386,
+      387,  388,  480,  458,  480,  480,  480,  480,  480,  480,
+      480,  499,  389,  499,  499,  499,  499,  499,  499,  499,
+      390,  393,  394,  395,  396,  480,  514,  499,  514,  514,
+      514,  514,  514,  514,  514,  528,  397,  528,  528,  528,
+      528,  528,  528,  528,  539,  398,  539,  539,  539,  539,
+
+      539,  539,  539,  399,  400,  401,  402,  514,  403,  404,
+       15,  528,   15,   15,   15,   15,   15,   15,   15,  539,
+       51,  406,   51,   51,   51,   51,   51,   51,   51,   76,
+      408,   76,   76,   76,   76,   76,   76,   76,   77,  409,
+       77,   77,   77,   77,   77,   77,   77,   81,  410,   81,
+       81,   81,   81,   81,   81,   81,   84,  411,   84,   84,
+       84,   84,   84,   84,   84,   86,  412,   86,   86,   86,
+       86,   86,   86,   86,   91,  413,   91,   91,   91,   91,
+       91,   91,   91,   95,  414,   95,   95,   95,   95,   95,
+       95,   95,  125,  415,  125,  125,  125,  125,  125,  125,
+
+      125,  126,  416,  126,  126,  126,  126,  126,  126,  126,
+      127,  417,  127,  127,  127,  127,  127,  127,  127,  137,
+      419,  137,  137,  137,  137,  137,  137,  137,  145,  420,
+      145,  145,  145,  145,  145,  145,  145,  171,  421,  171,
+      171,  171,  171,  171,  171,  171,  172,  422,  172,  172,
+      172,  172,  172,  172,  172,  176,  423,  176,  176,  176,
+      176,  176,  176,  176,  177,  424,  177,  177,  177,  177,
+      177,  177,  177,  179,  425,  179,  179,  179,  179,  179,
+      179,  179,  180,  426,  180,  180,  180,  180,  180,  180,
+      180,  188,  427,  188,  188,  188,  188,  188,  188,  188,
+
+      219,  429,  219,  219,  219,  219,  219,  219,  219,  220,
+      430,  220,  220,  220,  220,  220,  220,  220,  224,  431,
+      224,  224,  224,  224,  224,  224,  224,  225,  432,  225,
+      225,  225,  225,  225,  225,  225,  226,  435,  226,  226,
+      226,  226,  226,  226,  226,  229,  436,  229,  229,  229,
+      229,  229,  229,  229,  230,  437,  230,  230,  230,  230,
+      230,  230,  230,  231,  438,  231,  231,  231,  231,  231,
+      231,  231,  232,  439,  232,  232,  232,  232,  232,  232,
+      232,  266,  440,  266,  266,  266,  266,  266,  266,  266,
+      267,  441,  267,  267,  267,  267,  267,  267,  267,  270,
+
+      442,  270,  270,  270,  270,  270,  270,  270,  271,  443,
+      271,  271,  271,  271,  271,  271,  271,  272,  444,  272,
+      272,  272,  272,  272,  272,  272,  273,  445,  273,  273,
+      273,  273,  273,  273,  273,  274,  446,  274,  274,  274,
+      274,  274,  274,  274,  275,  447,  275,  275,  275,  275,
+      275,  275,  275,  277,  448,  277,  277,  277,  277,  277,
+      277,  277,  307,  449,  307,  307,  307,  307,  307,  307,
+      307,  310,  450,  310,  310,  310,  310,  310,  310,  310,
+      311,  451,  311,  311,  311,  311,  311,  311,  311,  344,
+      452,  344,  344,  344,  344,  344,  344,  344,  346,  453,
+
+      346,  346,  346,  346,  346,  346,  346,  376,  455,  376,
+      376,  376,  376,  376,  376,  376,  548,  456,  548,  548,
+      548,  548,  548,  548,  548,  124,  124,  124,  124,  124,
+      124,  124,  128,  128,  128,  128,  128,  128,  128,  170,
+      170,  170,  170,  170,  170,  170,  173,  173,  173,  173,
+      173,  173,  173,  218,  218,  218,  218,  218,  218,  218,
+       24,   68,  459,   24,  460,  461,  462,  463,  464,  465,
+      466,  467,  468,  469,   24,   68,  470,  471,  473,  474,
+       24,   68,  476,  477,  478,  481,  482,  483,  484,  487,
+      488,  489,  490,  491,  493,  494,  495,  496,  497,  500,
+
+      501,  502,  503,  504,  505,  506,  507,  508,  509,  510,
+      512,  513,  518,  519,  520,  521,  522,  523,  524,  525,
+      526,  527,  530,  531,  533,  534,  535,  536,  537,  538,
+      540,  541,  543,  544,  545,  549,  550,  551,  552,  553,
+      557,  558,  559,  560,  561,  562,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1104,7 +1160,7 @@ static yyconst flex_int16_t yy_chk[1838] =
 #define YY_INPUT(buffer, result, max_size) get_lex_chars(buffer, result, max_size, PARAM)
 
 #define YY_NO_INPUT 1
-#line 1108 "libmemcached/csl/scanner.cc"
+#line 1164 "libmemcached/csl/scanner.cc"
 
 #define INITIAL 0
 
@@ -1346,7 +1402,7 @@ YY_DECL
 
 
 
-#line 1350 "libmemcached/csl/scanner.cc"
+#line 1406 "libmemcached/csl/scanner.cc"
 
     yylval = yylval_param;
 
@@ -1402,13 +1458,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 538 )
+				if ( yy_current_state >= 566 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 537 );
+		while ( yy_current_state != 565 );
 		yy_cp = yyg->yy_last_accepting_cpos;
 		yy_current_state = yyg->yy_last_accepting_state;
 
@@ -1699,60 +1755,80 @@ YY_RULE_SETUP
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 187 "libmemcached/csl/scanner.l"
-{ return MD5; }
+#line 186 "libmemcached/csl/scanner.l"
+{ return JUMP; }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 188 "libmemcached/csl/scanner.l"
-{ return CRC; }
+#line 187 "libmemcached/csl/scanner.l"
+{ return RENDEZVOUS; }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 189 "libmemcached/csl/scanner.l"
-{ return FNV1_64; }
+#line 188 "libmemcached/csl/scanner.l"
+{ return RENDEZVOUS_SKELETON; }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 190 "libmemcached/csl/scanner.l"
-{ return FNV1A_64; }
+#line 189 "libmemcached/csl/scanner.l"
+{ return MAGLEV; }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 191 "libmemcached/csl/scanner.l"
-{ return FNV1_32; }
+{ return MD5; }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 192 "libmemcached/csl/scanner.l"
-{ return FNV1A_32; }
+{ return CRC; }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 193 "libmemcached/csl/scanner.l"
-{ return HSIEH; }
+{ return FNV1_64; }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 194 "libmemcached/csl/scanner.l"
-{ return MURMUR; }
+{ return FNV1A_64; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 195 "libmemcached/csl/scanner.l"
-{ return JENKINS; }
+{ return FNV1_32; }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
+#line 196 "libmemcached/csl/scanner.l"
+{ return FNV1A_32; }
+	YY_BREAK
+case 63:
+YY_RULE_SETUP
 #line 197 "libmemcached/csl/scanner.l"
+{ return HSIEH; }
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+#line 198 "libmemcached/csl/scanner.l"
+{ return MURMUR; }
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+#line 199 "libmemcached/csl/scanner.l"
+{ return JENKINS; }
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+#line 201 "libmemcached/csl/scanner.l"
 {
       yyextra->hostname(yytext, yyleng, yylval->server);
       return IPADDRESS;
     }
 	YY_BREAK
-case 63:
+case 67:
 YY_RULE_SETUP
-#line 202 "libmemcached/csl/scanner.l"
+#line 206 "libmemcached/csl/scanner.l"
 {
       if (yyextra->is_server())
       {
@@ -1766,30 +1842,30 @@ YY_RULE_SETUP
       return STRING;
     }
 	YY_BREAK
-case 64:
-/* rule 64 can match eol */
+case 68:
+/* rule 68 can match eol */
 YY_RULE_SETUP
-#line 215 "libmemcached/csl/scanner.l"
+#line 219 "libmemcached/csl/scanner.l"
 {
       config_get_text(yyscanner)[yyleng -1]= 0;
       yyextra->string_buffer(yytext +1, yyleng -2, yylval->string);
       return QUOTED_STRING;
     }
 	YY_BREAK
-case 65:
+case 69:
 YY_RULE_SETUP
-#line 221 "libmemcached/csl/scanner.l"
+#line 225 "libmemcached/csl/scanner.l"
 {
       yyextra->begin= yytext;
       return UNKNOWN;
     }
 	YY_BREAK
-case 66:
+case 70:
 YY_RULE_SETUP
-#line 226 "libmemcached/csl/scanner.l"
+#line 230 "libmemcached/csl/scanner.l"
 YY_FATAL_ERROR( "flex scanner jammed" );
 	YY_BREAK
-#line 1793 "libmemcached/csl/scanner.cc"
+#line 1869 "libmemcached/csl/scanner.cc"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2085,7 +2161,7 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 538 )
+			if ( yy_current_state >= 566 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -2114,11 +2190,11 @@ static int yy_get_next_buffer (yyscan_t yyscanner)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 538 )
+		if ( yy_current_state >= 566 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 537);
+	yy_is_jam = (yy_current_state == 565);
 
 	(void)yyg;
 	return yy_is_jam ? 0 : yy_current_state;
@@ -2919,7 +2995,7 @@ void config_free (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 226 "libmemcached/csl/scanner.l"
+#line 230 "libmemcached/csl/scanner.l"
 
 
 
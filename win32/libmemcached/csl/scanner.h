@@ -366,7 +366,7 @@ extern int config_lex \
 #undef YY_DECL
 #endif
 
-#line 226 "libmemcached/csl/scanner.l"
+#line 230 "libmemcached/csl/scanner.l"
 
 
 #line 373 "libmemcached/csl/scanner.h"